@@ -1,10 +1,15 @@
 # 複数サイズを一度に生成
 # python f2d.py Mplus2-Light.ttf --fallback-font mgenplus-1m-light.ttf --charset joyo_joyogai_jinmei_griflist.txt --multiple-sizes 12,18,26,34
+# 実行時に読み込むバイナリ形式で生成（epd_font_blob.h）
+# python f2d.py Mplus2-Light.ttf --fallback-font mgenplus-1m-light.ttf --charset joyo_joyogai_jinmei_griflist.txt --multiple-sizes 12,16,18 --binary
+# グリフを圧縮して生成（ヘッダ・バイナリ形式のどちらにも指定可）
+# python f2d.py Mplus2-Light.ttf --fallback-font mgenplus-1m-light.ttf --charset joyo_joyogai_jinmei_griflist.txt --multiple-sizes 26,34 --compress
 
 import os
 import re
 import argparse
 import datetime
+import struct
 import unicodedata
 from PIL import Image, ImageDraw, ImageFont
 import numpy as np
@@ -196,8 +201,95 @@ def create_char_bitmap(font, char, font_size, calculated_height, optimize=False,
     
     return img, char_width, img_width, img_height, x_offset, y_offset
 
-def generate_font_header(font_path, font_size, charset, output_file, fallback_font_path=None, optimize_width=True):
-    """フォントデータをCヘッダファイルに変換"""
+# バイナリ形式（epd_font_blob.h の EPDFontBlobHeader と FontCharInfo に合わせる）
+FONT_BLOB_MAGIC = b'EPDF'
+FONT_BLOB_VERSION = 1
+FONT_BLOB_HEADER_FORMAT = '<4sHHBBBBHBBIIIII12s'  # 48バイト
+FONT_BLOB_CHAR_FORMAT = '<IIBBBBbbxx'             # 16バイト
+
+# グリフの形式（epd_text.h の EPD_FONT_ENCODING_* に合わせる）
+FONT_ENCODING_RAW = 0
+FONT_ENCODING_RLE = 1
+
+def glyph_runs(pixels):
+    """行優先に並べたピクセル（Trueが文字部分）を、白から始まる白黒交互のランの長さに変換"""
+    runs = []
+    current = False
+    length = 0
+    for pixel in pixels:
+        if pixel != current:
+            runs.append(length)
+            current = pixel
+            length = 0
+        length += 1
+    if pixels:
+        runs.append(length)
+    return runs
+
+def exp_golomb_bits(value, order):
+    """k次のExp-Golomb符号のビット数"""
+    return 2 * ((value + (1 << order)).bit_length() - 1) - order + 1
+
+def encode_glyph_rle(runs, white_order, black_order):
+    """ランの長さを符号化する（白は長さ、黒は長さ-1。epd_text.c の decode_rle_glyph に合わせる）"""
+    bits = []
+    for i, run in enumerate(runs):
+        order = white_order if i % 2 == 0 else black_order
+        value = (run if i % 2 == 0 else run - 1) + (1 << order)
+        n = value.bit_length()
+        bits.append('0' * (n - 1 - order) + format(value, 'b'))
+    bits = ''.join(bits)
+    bits += '0' * (-len(bits) % 8)  # グリフごとにバイト境界に揃える
+    return bytes(int(bits[i:i + 8], 2) for i in range(0, len(bits), 8))
+
+def compress_glyphs(char_infos, glyph_pixels):
+    """全グリフを圧縮し、合計が最も小さくなる符号の次数を選ぶ
+
+    文字情報のデータ位置を圧縮後のものに置き換え、(ビットマップ, run_orders) を返す。
+    """
+    glyph_run_lists = [glyph_runs(pixels) for pixels in glyph_pixels]
+    best = None
+    for white_order in range(4):
+        for black_order in range(3):
+            size = 0
+            for runs in glyph_run_lists:
+                bits = sum(exp_golomb_bits(run if i % 2 == 0 else run - 1,
+                                           white_order if i % 2 == 0 else black_order)
+                           for i, run in enumerate(runs))
+                size += (bits + 7) // 8
+            if best is None or size < best[0]:
+                best = (size, white_order, black_order)
+    _, white_order, black_order = best
+
+    bitmap_data = bytearray()
+    for i, runs in enumerate(glyph_run_lists):
+        info = list(char_infos[i])
+        info[1] = len(bitmap_data)
+        char_infos[i] = tuple(info)
+        bitmap_data.extend(encode_glyph_rle(runs, white_order, black_order))
+    return bitmap_data, (white_order << 4) | black_order
+
+def write_font_blob(output_file, font_size, max_width, max_height, baseline, style, char_infos, bitmap_data,
+                    encoding=FONT_ENCODING_RAW, run_orders=0):
+    """フォントデータを実行時に読み込むバイナリ形式で保存"""
+    header_size = struct.calcsize(FONT_BLOB_HEADER_FORMAT)
+    chars_offset = header_size
+    bitmap_offset = chars_offset + len(char_infos) * struct.calcsize(FONT_BLOB_CHAR_FORMAT)
+    # 連結してもヘッダと文字情報が4バイト境界に揃うよう、全体を4バイト単位にする
+    total_size = (bitmap_offset + len(bitmap_data) + 3) // 4 * 4
+
+    with open(output_file, 'wb') as f:
+        f.write(struct.pack(FONT_BLOB_HEADER_FORMAT, FONT_BLOB_MAGIC, FONT_BLOB_VERSION, header_size,
+                            font_size, max_width, max_height, encoding, baseline, run_orders, 0,
+                            len(char_infos), chars_offset, bitmap_offset, len(bitmap_data), total_size,
+                            style.encode('ascii')[:11]))
+        for info in char_infos:
+            f.write(struct.pack(FONT_BLOB_CHAR_FORMAT, *info))
+        f.write(bitmap_data)
+        f.write(b'\0' * (total_size - bitmap_offset - len(bitmap_data)))
+
+def generate_font_header(font_path, font_size, charset, output_file, fallback_font_path=None, optimize_width=True, binary=False, compress=False):
+    """フォントデータをCヘッダファイル（binaryの場合はバイナリ形式）に変換"""
     # 出力ファイル名から変数名を生成
     base_name = os.path.basename(output_file)
     font_var_name = os.path.splitext(base_name)[0]
@@ -241,6 +333,7 @@ def generate_font_header(font_path, font_size, charset, output_file, fallback_fo
     
     char_infos = []
     bitmap_data = bytearray()
+    glyph_pixels = []  # 圧縮用に保持する各文字のピクセル（行優先）
     failed_chars = []
     fallback_count = 0
     
@@ -349,6 +442,7 @@ def generate_font_header(font_path, font_size, charset, output_file, fallback_fo
             # データを追加
             data_offset = len(bitmap_data)
             bitmap_data.extend(row_bytes)
+            glyph_pixels.append([bool(pixels[y, x] == 0) for y in range(img_height) for x in range(img_width)])
             
             # タイポグラフィ情報からフラグを生成
             typo_flags = 0
@@ -395,11 +489,28 @@ def generate_font_header(font_path, font_size, charset, output_file, fallback_fo
             print(f"  U+{ord(char):04X} '{char}'", end=", " if (i + 1) % 10 != 0 else "\n")
         print()
     
+    # 圧縮（データ位置が変わるため、文字情報と保持したピクセルの並びが揃っているソート前に行う）
+    encoding = FONT_ENCODING_RAW
+    run_orders = 0
+    if compress:
+        raw_size = len(bitmap_data)
+        bitmap_data, run_orders = compress_glyphs(char_infos, glyph_pixels)
+        encoding = FONT_ENCODING_RLE
+        print(f"圧縮: {raw_size} → {len(bitmap_data)} バイト ({len(bitmap_data) * 100 // max(raw_size, 1)}%), "
+              f"次数 白={run_orders >> 4} 黒={run_orders & 0x0F}")
+
     # ソートして検索を高速化
     char_infos.sort(key=lambda x: x[0])  # コードポイントでソート
     
     print(f"処理結果: 成功={len(char_infos)}, フォールバック使用={fallback_count}, 失敗={len(failed_chars)}")
     
+    if binary:
+        write_font_blob(output_file, font_size, max_width, max_height, baseline, style, char_infos, bitmap_data,
+                        encoding, run_orders)
+        print(f"フォントデータを {output_file} に保存しました。")
+        print(f"文字数: {len(char_infos)}, データサイズ: {len(bitmap_data)} バイト")
+        return True
+    
     # ヘッダーファイル生成
     with open(output_file, 'w', encoding='utf-8') as f:
         # ヘッダガード
@@ -451,7 +562,12 @@ def generate_font_header(font_path, font_size, charset, output_file, fallback_fo
         f.write(f"    .style = \"{style}\",\n")
         f.write(f"    .chars_count = {len(char_infos)},\n")
         f.write(f"    .chars = {chars_var_name},\n")
-        f.write(f"    .bitmap_data = {bitmap_var_name}\n")
+        if compress:
+            f.write(f"    .bitmap_data = {bitmap_var_name},\n")
+            f.write("    .encoding = EPD_FONT_ENCODING_RLE,\n")
+            f.write(f"    .run_orders = 0x{run_orders:02X}\n")
+        else:
+            f.write(f"    .bitmap_data = {bitmap_var_name}\n")
         f.write("};\n")
     
     print(f"フォントデータを {output_file} に保存しました。")
@@ -467,7 +583,10 @@ def main():
     parser.add_argument('--optimize', action='store_true', help='文字幅を最適化')
     parser.add_argument('--multiple-sizes', type=str, help='複数サイズを生成（カンマ区切り、例: 12,16,24）')
     parser.add_argument('--fallback-font', help='フォールバックフォントのパス')
+    parser.add_argument('--binary', action='store_true', help='実行時に読み込むバイナリ形式(.bin)で出力')
+    parser.add_argument('--compress', action='store_true', help='グリフをランレングス（Exp-Golomb符号）で圧縮')
     args = parser.parse_args()
+    extension = '.bin' if args.binary else '.h'
     
     # 文字セット読み込み
     charset = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789 あいうえおかきくけこさしすせそたちつてとなにぬねのはひふへほまみむめもやゆよらりるれろわをん　" # 全角スペースを追加
@@ -486,20 +605,20 @@ def main():
         for size in sizes:
             output = args.output
             if not output:
-                output = f"{font_basename}_{size}.h"
+                output = f"{font_basename}_{size}{extension}"
             else:
                 output_base = os.path.splitext(output)[0]
-                output = f"{output_base}_{size}.h"
+                output = f"{output_base}_{size}{extension}"
             
-            generate_font_header(args.font_file, size, charset, output, args.fallback_font, args.optimize)
+            generate_font_header(args.font_file, size, charset, output, args.fallback_font, args.optimize, args.binary, args.compress)
     else:
         # 単一サイズ処理
         output = args.output
         if not output:
             font_basename = os.path.splitext(os.path.basename(args.font_file))[0]
-            output = f"{font_basename}_{args.size}.h"
+            output = f"{font_basename}_{args.size}{extension}"
         
-        generate_font_header(args.font_file, args.size, charset, output, args.fallback_font, args.optimize)
+        generate_font_header(args.font_file, args.size, charset, output, args.fallback_font, args.optimize, args.binary, args.compress)
 
 if __name__ == "__main__":
     main()
\ No newline at end of file
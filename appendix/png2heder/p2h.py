@@ -11,10 +11,13 @@ from PIL import Image, ImageEnhance
 import sys
 import os
 import argparse
+import struct
+import rle4
 
 def convert_png_to_4bit_grayscale(input_file, output_file, brightness=1.0, contrast=1.0, 
                                   invert=False, black_threshold=None, white_threshold=None, 
-                                  gamma=1.0, transparent_white=True, trim_width=540, trim_height=960):
+                                  gamma=1.0, transparent_white=True, trim_width=540, trim_height=960,
+                                  rle=False, name="logo", binary=False):
     if trim_width is None:
         trim_width=540
     if trim_height is None:
@@ -34,6 +37,9 @@ def convert_png_to_4bit_grayscale(input_file, output_file, brightness=1.0, contr
     - transparent_white: 透明部分を白として扱うかどうか
     - trim_width: トリミング後の幅 (None=トリミングなし)
     - trim_height: トリミング後の高さ (None=トリミングなし)
+    - rle: epd_rle.c で展開できる圧縮形式で出力するかどうか
+    - name: 出力する変数名の接頭辞（rle=True の場合のみ使用）
+    - binary: epd_image_file_draw() で読み込めるバイナリファイルで出力するかどうか
     """
     # 画像を開く
     try:
@@ -146,6 +152,36 @@ def convert_png_to_4bit_grayscale(input_file, output_file, brightness=1.0, contr
             byte = gray1 | (gray2 << 4)
             bytes_data.append(byte)
     
+    # SDカード用のバイナリ形式で出力（"EPD4" + 幅 + 高さ + 4ビットデータ）
+    if binary:
+        try:
+            with open(output_file, 'wb') as f:
+                f.write(b"EPD4")
+                f.write(struct.pack('<HH', width, height))
+                f.write(bytes(bytes_data))
+            print(f"変換成功: {output_file} に保存しました")
+            return True
+        except Exception as e:
+            print(f"エラー: ファイル書き込み中 - {e}")
+            return False
+
+    # 圧縮形式で出力
+    if rle:
+        encoded = rle4.encode(bytes(bytes_data), width, height)
+        options = [f"4-bit grayscale image data converted from {os.path.basename(input_file)}",
+                   f"Original dimensions: {original_width} x {original_height}",
+                   f"Trimmed dimensions: {width} x {height}",
+                   f"Conversion options: brightness={brightness}, contrast={contrast}, "
+                   f"inverted={invert}, gamma={gamma}, transparent as white={transparent_white}"]
+        try:
+            with open(output_file, 'w') as f:
+                rle4.write_header(f, name, width, height, encoded, options)
+            print(f"変換成功: {output_file} に保存しました ({len(bytes_data)} -> {len(encoded)} bytes)")
+            return True
+        except Exception as e:
+            print(f"エラー: ファイル書き込み中 - {e}")
+            return False
+
     # Cの配列としてファイルに出力
     try:
         with open(output_file, 'w') as f:
@@ -206,6 +242,11 @@ if __name__ == "__main__":
     # トリミング機能のオプションを追加
     parser.add_argument('--trim-width', type=int, help='トリミング後の幅 (指定しない場合は元のサイズ)')
     parser.add_argument('--trim-height', type=int, help='トリミング後の高さ (指定しない場合は元のサイズ)')
+    # 圧縮形式（epd_rle.h）での出力
+    parser.add_argument('--rle', action='store_true', help='ランレングス圧縮した形式で出力する (epd_rle_draw() で描画)')
+    parser.add_argument('--name', default='logo', help='--rle 使用時の変数名の接頭辞 (デフォルト: logo)')
+    # SDカードから読み込むバイナリ形式（epd_image_file.h）での出力
+    parser.add_argument('--bin', action='store_true', help='ヘッダ付きのバイナリファイルで出力する (epd_image_file_draw() で描画)')
     
     args = parser.parse_args()
     
@@ -251,7 +292,10 @@ if __name__ == "__main__":
         gamma=args.gamma,
         transparent_white=not args.transparent_black,
         trim_width=args.trim_width,
-        trim_height=args.trim_height
+        trim_height=args.trim_height,
+        rle=args.rle,
+        name=args.name,
+        binary=args.bin
     )
     
     if not success:
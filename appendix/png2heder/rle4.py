@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+"""
+4-bit Grayscale RLE Encoder
+
+4ビットグレースケール画像（偶数ピクセルが下位4ビット）を、epd_rle.c で展開できる
+ニブル単位のランレングス形式に変換します。p2h.py の --rle オプションから使うほか、
+p2h.py で生成済みの非圧縮ヘッダを直接変換することもできます。
+
+    python3 rle4.py ../../main/bg2.h ../../main/bg2_rle.h --name bg2
+
+形式（各行は次の符号の並びで、行をまたぐ符号はありません）:
+  0x00-0x7F  ラン         : 下位4ビットが色、ビット4-6の n が長さ
+                            （n < 7 の場合は n + 1、n == 7 の場合は次の1バイト + 8）
+  0x80-0xBF  リテラル     : 下位6ビット + 1 ピクセルの生データが続く
+                            （(個数 + 1) / 2 バイト、偶数ピクセルが下位4ビット）
+  0xC0-0xFF  上の行と同じ : 下位6ビットの n が長さ
+                            （n < 63 の場合は n + 1、n == 63 の場合は次の1バイト + 64）
+先頭行の「上の行」は白（0x0F）として扱います。
+"""
+
+import argparse
+import os
+import re
+import sys
+
+RUN_SHORT_MAX = 7
+RUN_LONG_MAX = 255 + 8
+LITERAL_MAX = 64
+COPY_SHORT_MAX = 63
+COPY_LONG_MAX = 255 + 64
+# これより短い並びはリテラルに含めた方が小さくなる
+MIN_RUN = 3
+MIN_COPY = 4
+WHITE = 0x0F
+
+
+def unpack_rows(packed, width, height):
+    """4ビット/ピクセルのバイト列を行ごとのピクセル値のリストに展開する"""
+    stride = (width + 1) // 2
+    rows = []
+    for y in range(height):
+        row = []
+        for x in range(width):
+            byte = packed[y * stride + x // 2]
+            row.append((byte >> 4) & 0x0F if x % 2 else byte & 0x0F)
+        rows.append(row)
+    return rows
+
+
+def _emit_literal(out, pixels):
+    """リテラル符号を出力する"""
+    for start in range(0, len(pixels), LITERAL_MAX):
+        chunk = pixels[start:start + LITERAL_MAX]
+        out.append(0x80 | (len(chunk) - 1))
+        for i in range(0, len(chunk), 2):
+            lo = chunk[i]
+            hi = chunk[i + 1] if i + 1 < len(chunk) else 0
+            out.append(lo | (hi << 4))
+
+
+def _emit_run(out, color, length):
+    """ラン符号を出力する"""
+    while length > 0:
+        if length <= RUN_SHORT_MAX:
+            out.append(((length - 1) << 4) | color)
+            return
+        chunk = min(length, RUN_LONG_MAX)
+        out.append((7 << 4) | color)
+        out.append(chunk - 8)
+        length -= chunk
+
+
+def _emit_copy(out, length):
+    """上の行と同じ区間の符号を出力する"""
+    while length > 0:
+        if length <= COPY_SHORT_MAX:
+            out.append(0xC0 | (length - 1))
+            return
+        chunk = min(length, COPY_LONG_MAX)
+        out.append(0xFF)
+        out.append(chunk - 64)
+        length -= chunk
+
+
+def encode_row(row, above):
+    """1行分のピクセル値を符号化する"""
+    out = bytearray()
+    literal = []
+    x = 0
+    width = len(row)
+    while x < width:
+        color = row[x]
+        run = 1
+        while x + run < width and row[x + run] == color:
+            run += 1
+        copy = 0
+        while x + copy < width and row[x + copy] == above[x + copy]:
+            copy += 1
+
+        if copy >= MIN_COPY and copy >= run:
+            length = copy
+        elif run >= MIN_RUN:
+            length = run
+        else:
+            literal.append(color)
+            x += 1
+            continue
+
+        if literal:
+            _emit_literal(out, literal)
+            literal = []
+        if length == copy:
+            _emit_copy(out, copy)
+        else:
+            _emit_run(out, color, run)
+        x += length
+    if literal:
+        _emit_literal(out, literal)
+    return out
+
+
+def encode(packed, width, height):
+    """4ビット/ピクセルのバイト列全体を符号化する"""
+    out = bytearray()
+    above = [WHITE] * width
+    for row in unpack_rows(packed, width, height):
+        out += encode_row(row, above)
+        above = row
+    return bytes(out)
+
+
+def decode(data, width, height):
+    """符号化したデータを4ビット/ピクセルのバイト列に戻す（検証用）"""
+    stride = (width + 1) // 2
+    packed = bytearray(stride * height)
+    pos = 0
+    above = [WHITE] * width
+    for y in range(height):
+        row = []
+        while len(row) < width:
+            token = data[pos]
+            pos += 1
+            if token & 0xC0 == 0xC0:
+                n = token & 0x3F
+                if n < 63:
+                    count = n + 1
+                else:
+                    count = data[pos] + 64
+                    pos += 1
+                pixels = above[len(row):len(row) + count]
+            elif token & 0x80:
+                count = (token & 0x3F) + 1
+                pixels = []
+                for i in range((count + 1) // 2):
+                    pixels += [data[pos + i] & 0x0F, data[pos + i] >> 4]
+                pos += (count + 1) // 2
+                pixels = pixels[:count]
+            else:
+                n = token >> 4
+                if n < 7:
+                    count = n + 1
+                else:
+                    count = data[pos] + 8
+                    pos += 1
+                pixels = [token & 0x0F] * count
+            row += pixels
+        if len(row) != width:
+            raise ValueError(f"row {y} overruns the image width")
+        for x, value in enumerate(row):
+            packed[y * stride + x // 2] |= value << 4 if x % 2 else value
+        above = row
+    return bytes(packed)
+
+
+def write_header(f, name, width, height, data, comment_lines=()):
+    """符号化したデータをCヘッダとして出力する"""
+    upper = name.upper()
+    for line in comment_lines:
+        f.write(f"// {line}\n")
+    f.write(f"// RLE compressed: {len(data)} bytes "
+            f"(raw {(width + 1) // 2 * height} bytes)\n\n")
+    f.write("#include <stdint.h>\n")
+    f.write("#include \"epd_rle.h\"\n\n")
+    f.write(f"#define {upper}_WIDTH {width}\n")
+    f.write(f"#define {upper}_HEIGHT {height}\n\n")
+    f.write(f"const uint8_t {name}_rle_data[] = {{\n    ")
+    for i, byte in enumerate(data):
+        f.write(f"0x{byte:02X}")
+        if i < len(data) - 1:
+            f.write(", ")
+        if (i + 1) % 12 == 0:
+            f.write("\n    ")
+    f.write("\n};\n\n")
+    f.write(f"const EPDRleImage {name}_rle = {{\n")
+    f.write(f"    .width = {width},\n")
+    f.write(f"    .height = {height},\n")
+    f.write(f"    .data_len = {len(data)},\n")
+    f.write(f"    .data = {name}_rle_data,\n")
+    f.write("};\n")
+
+
+def read_raw_header(path):
+    """p2h.py で生成した非圧縮ヘッダから幅・高さ・データを読み込む"""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    width = re.search(r"#define\s+\w+_WIDTH\s+(\d+)", text)
+    height = re.search(r"#define\s+\w+_HEIGHT\s+(\d+)", text)
+    body = re.search(r"\[\]\s*=\s*\{(.*?)\}", text, re.S)
+    if not (width and height and body):
+        raise ValueError(f"{path}: WIDTH/HEIGHT or data array not found")
+    data = bytes(int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", body.group(1)))
+    return int(width.group(1)), int(height.group(1)), data
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='非圧縮の4ビット画像ヘッダをRLE形式のヘッダに変換します')
+    parser.add_argument('input', help='p2h.py で生成した入力ヘッダファイル')
+    parser.add_argument('output', help='出力Cヘッダファイル')
+    parser.add_argument('--name', default='logo', help='出力する変数名の接頭辞 (デフォルト: logo)')
+    args = parser.parse_args()
+
+    width, height, raw = read_raw_header(args.input)
+    if len(raw) != (width + 1) // 2 * height:
+        print(f"エラー: データサイズが {width} x {height} と一致しません")
+        sys.exit(1)
+
+    encoded = encode(raw, width, height)
+    if decode(encoded, width, height) != raw:
+        print("エラー: 符号化したデータを元に戻せませんでした")
+        sys.exit(1)
+
+    with open(args.output, 'w') as f:
+        write_header(f, args.name, width, height, encoded,
+                     [f"4-bit grayscale image data converted from {os.path.basename(args.input)}",
+                      f"Dimensions: {width} x {height}"])
+    print(f"変換成功: {args.output} に保存しました ({len(raw)} -> {len(encoded)} bytes)")
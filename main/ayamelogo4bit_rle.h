@@ -0,0 +1,214 @@
+// 4-bit grayscale image data converted from ayamelogo4bit.h
+// Dimensions: 150 x 217
+// RLE compressed: 2332 bytes (raw 16275 bytes)
+
+#include <stdint.h>
+#include "epd_rle.h"
+
+#define LOGO_WIDTH 150
+#define LOGO_HEIGHT 217
+
+const uint8_t logo_rle_data[] = {
+    0xFF, 0x1D, 0x83, 0xBA, 0xAB, 0xF4, 0xFF, 0x1A, 0x5B, 0x7F, 0x2E, 0xFF, 
+    0x18, 0x80, 0x0A, 0x6B, 0xF5, 0xFF, 0x17, 0x7B, 0x01, 0xF5, 0xFF, 0x13, 
+    0x80, 0x0A, 0x7B, 0x04, 0xF5, 0xFF, 0x11, 0x80, 0x09, 0x7B, 0x06, 0xF5, 
+    0xFF, 0x0F, 0x7B, 0x0A, 0xF4, 0xFF, 0x0D, 0x81, 0xA0, 0xFF, 0x07, 0xF7, 
+    0x83, 0xA9, 0xBB, 0xCF, 0x80, 0x0A, 0x7B, 0x0D, 0xF3, 0xF7, 0x4B, 0xCD, 
+    0x7B, 0x0F, 0xF3, 0xF6, 0x5B, 0xCC, 0x80, 0x0A, 0xD6, 0x80, 0x0A, 0xF2, 
+    0xF5, 0x6B, 0x80, 0x0A, 0xCB, 0x7B, 0x11, 0xF2, 0xFC, 0x80, 0x0B, 0xCA, 
+    0x7B, 0x13, 0xF1, 0xF4, 0x80, 0x0A, 0xD1, 0x80, 0x0A, 0xDA, 0x80, 0x07, 
+    0xF0, 0xF4, 0x7B, 0x01, 0xC8, 0x7B, 0x16, 0xF0, 0xF3, 0x80, 0x0A, 0xC8, 
+    0x80, 0x0A, 0xD6, 0x80, 0x0A, 0x7B, 0x07, 0xEF, 0xF3, 0x7B, 0x03, 0xC6, 
+    0x7B, 0x18, 0xEF, 0xF2, 0x80, 0x0A, 0xC9, 0x80, 0x0A, 0xE6, 0x80, 0x0B, 
+    0xEE, 0xF1, 0x80, 0x07, 0x7B, 0x05, 0xC4, 0x7B, 0x1A, 0xEE, 0xF1, 0x80, 
+    0x0A, 0xF3, 0x80, 0x0B, 0xED, 0xF1, 0x7B, 0x06, 0x80, 0x0A, 0xC2, 0x7B, 
+    0x1C, 0xED, 0xF0, 0x7B, 0x08, 0xE6, 0x80, 0x00, 0xEC, 0xF0, 0x80, 0x0A, 
+    0xF5, 0x80, 0x0B, 0xEC, 0xF0, 0x7B, 0x08, 0x81, 0xFF, 0x7B, 0x1E, 0xEC, 
+    0xEF, 0x80, 0x07, 0xD1, 0x80, 0x0A, 0x7B, 0x1E, 0xEB, 0xEF, 0x7B, 0x09, 
+    0x81, 0xFF, 0x7B, 0x1E, 0x80, 0x0A, 0xEB, 0xFF, 0x29, 0x80, 0x0B, 0xEB, 
+    0xEE, 0x80, 0x07, 0xFF, 0x26, 0xEE, 0x7B, 0x09, 0x80, 0x0A, 0xE8, 0x80, 
+    0x0B, 0xEA, 0xED, 0x7B, 0x0B, 0xFF, 0x15, 0xFF, 0x56, 0xEC, 0x7B, 0x36, 
+    0xEA, 0xFF, 0x56, 0xEB, 0x80, 0x0A, 0xFF, 0x29, 0xEB, 0x7B, 0x37, 0xEA, 
+    0xFF, 0x56, 0xEA, 0x80, 0x07, 0xFF, 0x2A, 0xEA, 0x80, 0x0A, 0xFD, 0x81, 
+    0x00, 0xE9, 0xFF, 0x56, 0xEA, 0x7B, 0x37, 0xEB, 0xFF, 0x56, 0xFF, 0x56, 
+    0xFF, 0x56, 0xFF, 0x56, 0xFF, 0x56, 0xFF, 0x56, 0xFF, 0x56, 0xFF, 0x29, 
+    0x80, 0x0F, 0xEB, 0xFF, 0x04, 0x80, 0x0F, 0xE2, 0x80, 0x0A, 0xEC, 0xDD, 
+    0x81, 0xBA, 0xCA, 0x80, 0x0A, 0xD6, 0x82, 0xFF, 0x0A, 0x7B, 0x1B, 0xEC, 
+    0xDC, 0x81, 0xBA, 0xCB, 0x80, 0x07, 0xD8, 0x7B, 0x1C, 0xEC, 0xDB, 0x80, 
+    0x0A, 0x3B, 0x7F, 0x03, 0xCD, 0x80, 0x0A, 0xC9, 0x80, 0x0F, 0xE1, 0x80, 
+    0x0A, 0xEC, 0xDB, 0x4B, 0xFF, 0x07, 0x80, 0x0F, 0xEC, 0xDA, 0x80, 0x0A, 
+    0xCF, 0x80, 0x0F, 0x7B, 0x0C, 0x81, 0x24, 0x30, 0x80, 0x03, 0x74, 0x05, 
+    0x81, 0x33, 0x74, 0x07, 0x81, 0x13, 0x50, 0x21, 0x70, 0x1D, 0xD9, 0x7B, 
+    0x00, 0x7F, 0x04, 0xD2, 0x70, 0x4D, 0xD8, 0x7B, 0x01, 0x80, 0x0A, 0x7F, 
+    0x04, 0xCB, 0x80, 0x0A, 0x6B, 0x3F, 0x7B, 0x18, 0x82, 0xFF, 0x0A, 0x7B, 
+    0x04, 0x7F, 0x06, 0xC2, 0x7F, 0x07, 0xE1, 0x80, 0x0B, 0x7F, 0x05, 0x7B, 
+    0x0B, 0x80, 0x0A, 0xC2, 0x80, 0x0A, 0xDD, 0x80, 0x0F, 0x7B, 0x08, 0x80, 
+    0x0A, 0xCD, 0x7F, 0x08, 0xD7, 0x7B, 0x04, 0xCB, 0x80, 0x07, 0x7B, 0x0B, 
+    0xE1, 0x7B, 0x0A, 0x81, 0xBA, 0xC8, 0x20, 0xCF, 0xE3, 0x80, 0x0B, 0x7F, 
+    0x04, 0x80, 0x0A, 0xC7, 0x80, 0x0A, 0x7B, 0x02, 0xF2, 0x3B, 0xC8, 0x7F, 
+    0x09, 0xE4, 0x80, 0x07, 0x7F, 0x04, 0x7B, 0x0B, 0x81, 0xFF, 0x7B, 0x2E, 
+    0x80, 0x00, 0xD7, 0xE4, 0x80, 0x0B, 0xC4, 0x81, 0xB7, 0x5F, 0xE1, 0x80, 
+    0x0A, 0x7B, 0x21, 0xC2, 0x20, 0xD0, 0xE5, 0x7B, 0x04, 0x81, 0xF9, 0xC8, 
+    0x80, 0x0A, 0xC8, 0x80, 0x0A, 0xC9, 0x81, 0xA0, 0x7B, 0x24, 0x83, 0xFC, 
+    0x00, 0x7F, 0x0A, 0xF1, 0x2B, 0x80, 0x0A, 0x7B, 0x07, 0x82, 0xF7, 0x0F, 
+    0xCA, 0x80, 0x07, 0x7B, 0x26, 0xD3, 0xD7, 0x80, 0x00, 0x7B, 0x25, 0xCB, 
+    0x81, 0x08, 0xEC, 0x20, 0xD1, 0x7F, 0x11, 0xF8, 0x82, 0x0B, 0x09, 0xD1, 
+    0x80, 0x0F, 0xD9, 0x81, 0xA4, 0xD1, 0x7F, 0x12, 0x80, 0x0A, 0x7B, 0x24, 
+    0xCC, 0x80, 0x05, 0xCC, 0x80, 0x0A, 0x5F, 0xD8, 0x81, 0xB8, 0xD1, 0x7F, 
+    0x13, 0xF8, 0x81, 0xA2, 0xC9, 0x7F, 0x03, 0xD4, 0x84, 0x10, 0xBA, 0x0B, 
+    0xD0, 0x7F, 0x14, 0xC5, 0x80, 0x0A, 0x7B, 0x29, 0x81, 0x80, 0xC7, 0x7F, 
+    0x05, 0x80, 0x07, 0xD0, 0x84, 0xBA, 0x0B, 0x06, 0x3B, 0xCF, 0xD9, 0x80, 
+    0x07, 0x7B, 0x24, 0x80, 0x0A, 0xCC, 0x80, 0x03, 0xC5, 0x80, 0x0A, 0x7F, 
+    0x07, 0x80, 0x0A, 0xD3, 0x80, 0x09, 0x4B, 0xCE, 0xD9, 0x7B, 0x32, 0x82, 
+    0x30, 0x09, 0xC3, 0x80, 0x07, 0x7F, 0x09, 0x7B, 0x0A, 0x81, 0x20, 0x6B, 
+    0xCD, 0xD8, 0x7B, 0x34, 0x81, 0x60, 0xC2, 0x7F, 0x0B, 0xD2, 0x80, 0x06, 
+    0xC6, 0x80, 0x07, 0xCC, 0xD7, 0x7B, 0x35, 0x83, 0x20, 0xBA, 0x7F, 0x0C, 
+    0xD0, 0x82, 0x10, 0x0A, 0x7B, 0x00, 0xCC, 0xF1, 0x81, 0xAA, 0xE1, 0x81, 
+    0x46, 0x7F, 0x0D, 0xD1, 0x80, 0x07, 0x7B, 0x02, 0xCB, 0xD5, 0x7B, 0x2E, 
+    0x80, 0x0A, 0x7B, 0x01, 0x20, 0xE3, 0x82, 0x10, 0x0A, 0x7B, 0x03, 0xCA, 
+    0xD3, 0x80, 0x07, 0x7B, 0x14, 0x80, 0x0A, 0x2F, 0x80, 0x07, 0x7B, 0x18, 
+    0xE7, 0x80, 0x06, 0x7B, 0x05, 0xC9, 0xD1, 0x81, 0xA7, 0x7B, 0x15, 0x6F, 
+    0xDC, 0x81, 0xFF, 0x20, 0xD2, 0x80, 0x0A, 0xCD, 0x82, 0x10, 0x0A, 0x7B, 
+    0x06, 0xC8, 0xD0, 0x7B, 0x18, 0x7F, 0x01, 0x80, 0x0A, 0xD7, 0x81, 0x0A, 
+    0xD7, 0x80, 0x0F, 0xCE, 0x80, 0x06, 0x7B, 0x07, 0x80, 0x0A, 0xC7, 0xCE, 
+    0x7B, 0x19, 0x7F, 0x04, 0x7B, 0x10, 0x3F, 0x20, 0xD2, 0x80, 0x0A, 0xCB, 
+    0x82, 0x10, 0x0A, 0x7B, 0x08, 0x80, 0x07, 0xC6, 0xCD, 0x7B, 0x1A, 0x7F, 
+    0x05, 0xD5, 0x4F, 0xD5, 0x7B, 0x05, 0x81, 0x60, 0x7B, 0x09, 0x80, 0x0A, 
+    0xC6, 0xCB, 0x7B, 0x1C, 0x7F, 0x06, 0xD3, 0x6F, 0x20, 0xD1, 0x80, 0x07, 
+    0xCA, 0x82, 0x10, 0x0A, 0x7B, 0x0A, 0x80, 0x0A, 0xC5, 0xCA, 0x80, 0x0A, 
+    0xE2, 0x7F, 0x08, 0xEE, 0x80, 0x0F, 0xCB, 0x80, 0x05, 0x7B, 0x0B, 0xC6, 
+    0xC9, 0x80, 0x0A, 0x7B, 0x1C, 0x7F, 0x09, 0xD0, 0x7F, 0x01, 0x20, 0xC3, 
+    0x81, 0xBB, 0xCB, 0x80, 0x07, 0xC8, 0x82, 0x10, 0x0A, 0x7B, 0x0C, 0xC5, 
+    0xC7, 0x80, 0x07, 0x7B, 0x1E, 0xE0, 0x80, 0x0A, 0xCE, 0x83, 0xBA, 0xAB, 
+    0x7F, 0x04, 0xC9, 0x80, 0x06, 0x7B, 0x0D, 0xC5, 0xC7, 0x7B, 0x1E, 0x7F, 
+    0x0B, 0xCE, 0x7F, 0x03, 0x20, 0x81, 0xFF, 0x3B, 0x7F, 0x05, 0xC6, 0x82, 
+    0x30, 0x0A, 0xD4, 0x80, 0x07, 0xC4, 0xC6, 0x7B, 0x1F, 0xD2, 0x80, 0x0A, 
+    0xD8, 0x80, 0x0F, 0x20, 0x80, 0x0A, 0xD0, 0x80, 0x0F, 0xC4, 0x82, 0x00, 
+    0x09, 0x7B, 0x0E, 0x80, 0x0A, 0xC4, 0xC5, 0x7B, 0x20, 0x7F, 0x0C, 0xDC, 
+    0x4B, 0x7F, 0x07, 0xC4, 0x80, 0x06, 0x7B, 0x10, 0xC4, 0xC4, 0x80, 0x09, 
+    0xFF, 0x16, 0x83, 0x0F, 0x80, 0x4B, 0x7F, 0x07, 0x84, 0xBB, 0x20, 0x0A, 
+    0xD6, 0x80, 0x0A, 0xC4, 0xC4, 0x7B, 0x20, 0x80, 0x0A, 0xEE, 0x83, 0x0F, 
+    0xA3, 0xD2, 0x83, 0x0F, 0x90, 0x7B, 0x10, 0x80, 0x07, 0xC4, 0xC3, 0x7B, 
+    0x20, 0x80, 0x0A, 0x7F, 0x0E, 0xDA, 0x82, 0x0A, 0x06, 0xD4, 0x80, 0x03, 
+    0x7B, 0x11, 0x5F, 0xD4, 0x80, 0x0A, 0x7B, 0x0F, 0xF0, 0x83, 0xAB, 0x80, 
+    0xC2, 0x80, 0x0A, 0xCD, 0x20, 0xDE, 0xC2, 0x80, 0x0A, 0x7B, 0x21, 0xE1, 
+    0x80, 0x0A, 0xCC, 0x2B, 0x82, 0x20, 0x0A, 0x2B, 0xCC, 0x20, 0x82, 0xFF, 
+    0x0A, 0xD5, 0x80, 0x0A, 0xC5, 0xC2, 0x7B, 0x21, 0x80, 0x0A, 0xD5, 0x80, 
+    0x0A, 0x7B, 0x04, 0xCF, 0x82, 0x0B, 0x05, 0xCE, 0x20, 0x3F, 0xDC, 0x81, 
+    0xFF, 0x7B, 0x22, 0x80, 0x07, 0xD5, 0x80, 0x07, 0xDC, 0x82, 0x0A, 0x07, 
+    0xD4, 0x80, 0x0A, 0xD4, 0x6F, 0xEB, 0x7F, 0x10, 0xDC, 0x83, 0x9B, 0x90, 
+    0xCB, 0x20, 0x5F, 0xD3, 0x80, 0x0A, 0xC6, 0xFF, 0x1C, 0x80, 0x0A, 0x5B, 
+    0x82, 0x08, 0x08, 0xC9, 0x20, 0x6F, 0x80, 0x0A, 0xD2, 0x80, 0x07, 0xC6, 
+    0x81, 0xAF, 0xE8, 0x80, 0x0A, 0xEF, 0x7B, 0x00, 0x82, 0x10, 0x00, 0xC7, 
+    0x20, 0x7F, 0x01, 0xD1, 0x80, 0x0A, 0x7F, 0x00, 0x80, 0x0F, 0x7B, 0x22, 
+    0x7F, 0x11, 0x80, 0x0A, 0xDE, 0x80, 0x0B, 0x20, 0xC5, 0x20, 0x7F, 0x02, 
+    0x80, 0x0A, 0xD0, 0x7F, 0x01, 0xFF, 0x04, 0x7B, 0x04, 0xCA, 0x80, 0x0C, 
+    0x7B, 0x02, 0x20, 0xC3, 0x20, 0x7F, 0x03, 0x7B, 0x09, 0x7F, 0x02, 0x7B, 
+    0x22, 0x80, 0x0A, 0x7F, 0x12, 0xD5, 0x7B, 0x04, 0x20, 0x81, 0xFF, 0x20, 
+    0x7F, 0x04, 0x80, 0x0A, 0xCE, 0x80, 0x0A, 0xC9, 0x7B, 0x23, 0xD9, 0x80, 
+    0x0A, 0x7B, 0x03, 0xD8, 0x40, 0xDB, 0x7F, 0x03, 0xE9, 0x80, 0x0A, 0xD9, 
+    0x7B, 0x03, 0x80, 0x0A, 0xD5, 0x80, 0x0F, 0xC5, 0x7F, 0x05, 0x7B, 0x07, 
+    0x7F, 0x04, 0xFF, 0x1A, 0x80, 0x0A, 0xCC, 0x80, 0x0F, 0xC3, 0x7F, 0x07, 
+    0xCC, 0x7F, 0x05, 0xE9, 0x7F, 0x14, 0xE1, 0x50, 0xE7, 0xFF, 0x1A, 0x7B, 
+    0x04, 0x30, 0x81, 0xFF, 0x30, 0xD7, 0x80, 0x0C, 0xCC, 0xD4, 0x80, 0x07, 
+    0x72, 0x0C, 0x70, 0x15, 0x72, 0x01, 0x80, 0x01, 0x70, 0x01, 0x80, 0x01, 
+    0x72, 0x02, 0x30, 0x3F, 0x30, 0xCA, 0x80, 0x07, 0xCA, 0x7F, 0x06, 0xD4, 
+    0x70, 0x48, 0x82, 0x52, 0x03, 0x5F, 0x30, 0x7F, 0x03, 0xD8, 0x7B, 0x22, 
+    0x7F, 0x0B, 0x81, 0x00, 0x7F, 0x00, 0x80, 0x0A, 0x7B, 0x01, 0x7F, 0x00, 
+    0x7B, 0x01, 0x85, 0x00, 0x81, 0xBB, 0x7F, 0x00, 0x30, 0x7F, 0x02, 0xD7, 
+    0xE8, 0x80, 0x00, 0xDC, 0x80, 0x0F, 0xD8, 0x83, 0x50, 0x93, 0x2B, 0x7F, 
+    0x01, 0x30, 0xE0, 0xE8, 0x7F, 0x0C, 0xCA, 0x80, 0x0A, 0xD5, 0x84, 0x00, 
+    0x61, 0x0A, 0x3B, 0x7F, 0x02, 0x40, 0x7F, 0x00, 0xD6, 0xE7, 0x7F, 0x0C, 
+    0x20, 0x7F, 0x02, 0xD3, 0x84, 0x00, 0x43, 0x09, 0x5B, 0x7F, 0x04, 0x40, 
+    0x6F, 0xC6, 0x80, 0x0A, 0xCD, 0xE6, 0x7F, 0x0D, 0x81, 0x00, 0x7F, 0x04, 
+    0x81, 0xAA, 0xCB, 0x3B, 0x83, 0x50, 0x82, 0x7B, 0x00, 0x7F, 0x05, 0x40, 
+    0xC5, 0x80, 0x09, 0x6B, 0xCD, 0x80, 0x0F, 0xFF, 0x09, 0x80, 0x0F, 0x6B, 
+    0xC7, 0x84, 0x00, 0x61, 0x0A, 0x7B, 0x01, 0x7F, 0x07, 0x40, 0xC3, 0x80, 
+    0x0A, 0xD4, 0xE5, 0x7F, 0x0E, 0xCE, 0x80, 0x0F, 0xCB, 0x84, 0x00, 0x42, 
+    0x0A, 0x7B, 0x03, 0x7F, 0x09, 0x40, 0x81, 0xFF, 0x7B, 0x00, 0xCD, 0x81, 
+    0xFF, 0xE2, 0x7F, 0x0F, 0xD9, 0x84, 0x00, 0x23, 0x08, 0x7B, 0x05, 0x7F, 
+    0x0B, 0x40, 0x80, 0x0A, 0xC2, 0x7F, 0x0A, 0xE3, 0x7F, 0x0F, 0x20, 0xCD, 
+    0x80, 0x0A, 0xC6, 0x30, 0x81, 0xA7, 0x7B, 0x06, 0x7F, 0x0C, 0x50, 0x7F, 
+    0x0C, 0x2F, 0xDE, 0x80, 0x0A, 0x7F, 0x10, 0x81, 0x00, 0x7F, 0x08, 0xC4, 
+    0x40, 0x80, 0x07, 0x7B, 0x08, 0x7F, 0x0F, 0x40, 0xD1, 0xDF, 0x80, 0x0A, 
+    0x7F, 0x12, 0xD4, 0x40, 0x81, 0xFF, 0x7B, 0x09, 0x7F, 0x11, 0x50, 0xCE, 
+    0x3F, 0xDA, 0x80, 0x0A, 0x7F, 0x12, 0x20, 0xD0, 0x84, 0x00, 0x61, 0x08, 
+    0x3F, 0xD0, 0x80, 0x0A, 0x7F, 0x12, 0x50, 0xCC, 0xDD, 0x7F, 0x14, 0x81, 
+    0x00, 0x7F, 0x07, 0x20, 0x84, 0x71, 0xBA, 0x0B, 0xEF, 0x81, 0xFF, 0x60, 
+    0xC9, 0x4F, 0xD6, 0x7F, 0x16, 0xCD, 0x50, 0x80, 0x0A, 0x3B, 0xC2, 0x80, 
+    0x0A, 0x7B, 0x0A, 0x7F, 0x16, 0x70, 0x00, 0xC6, 0xC4, 0x80, 0x0A, 0xD3, 
+    0x7F, 0x17, 0x20, 0xC8, 0x60, 0x81, 0xFF, 0x4B, 0x83, 0xFA, 0x9F, 0xD0, 
+    0x80, 0x0A, 0x7F, 0x19, 0x60, 0xC4, 0x5F, 0xD0, 0x80, 0x0A, 0x7F, 0x19, 
+    0x81, 0x00, 0x6F, 0x60, 0x4F, 0xC7, 0x80, 0x0A, 0x7B, 0x0A, 0x7F, 0x1C, 
+    0x60, 0x81, 0xFF, 0x6F, 0xCB, 0x81, 0xBA, 0x2F, 0x70, 0x45, 0xE7, 0x2F, 
+    0x40, 0x80, 0x0F, 0x7F, 0x00, 0xC9, 0x5F, 0xF6, 0x80, 0x01, 0x22, 0x80, 
+    0x01, 0xC2, 0x72, 0x04, 0x81, 0x30, 0xEA, 0x81, 0xFF, 0xC3, 0xC7, 0x80, 
+    0x0A, 0xC6, 0x7F, 0x00, 0x81, 0x00, 0x7F, 0x0B, 0xC2, 0x7F, 0x15, 0x82, 
+    0x00, 0x0A, 0x4B, 0x80, 0x0F, 0x7B, 0x05, 0xC4, 0x80, 0x0A, 0x7F, 0x25, 
+    0x7F, 0x02, 0xFF, 0x05, 0x80, 0x07, 0xD7, 0x80, 0x0B, 0xEC, 0x7F, 0x03, 
+    0xFF, 0x04, 0x80, 0x00, 0xFF, 0x06, 0x7F, 0x04, 0xC2, 0x80, 0x07, 0xFF, 
+    0x05, 0x7B, 0x06, 0xF2, 0x7F, 0x10, 0xFF, 0x3E, 0xFF, 0x10, 0x80, 0x09, 
+    0xFF, 0x05, 0xFF, 0x10, 0x80, 0x0F, 0xFF, 0x05, 0xFF, 0x56, 0xFF, 0x56, 
+    0xFF, 0x11, 0x80, 0x07, 0xFF, 0x04, 0xFF, 0x11, 0x80, 0x0F, 0xFF, 0x04, 
+    0xFF, 0x56, 0xFF, 0x56, 0xFF, 0x12, 0x80, 0x0F, 0xFF, 0x03, 0xFF, 0x56, 
+    0xFF, 0x56, 0xFF, 0x13, 0x80, 0x0A, 0xFF, 0x02, 0xEF, 0x70, 0x18, 0x3F, 
+    0xFF, 0x02, 0xFF, 0x28, 0x80, 0x0A, 0xEC, 0xFF, 0x28, 0x80, 0x0B, 0xEC, 
+    0xEF, 0x7F, 0x15, 0xDA, 0x80, 0x0A, 0xEC, 0xFF, 0x14, 0x80, 0x0A, 0xD2, 
+    0x7F, 0x26, 0xFF, 0x14, 0x80, 0x0F, 0xFF, 0x01, 0xFF, 0x27, 0x80, 0x0A, 
+    0xED, 0xFF, 0x15, 0x80, 0x0A, 0xD0, 0x80, 0x0B, 0xED, 0xFF, 0x27, 0x7F, 
+    0x27, 0xFF, 0x26, 0x80, 0x0A, 0xEE, 0xFF, 0x15, 0x80, 0x0F, 0xFF, 0x00, 
+    0xFF, 0x26, 0x7F, 0x28, 0xFF, 0x16, 0x80, 0x0A, 0xCC, 0x81, 0xA2, 0xEF, 
+    0xFF, 0x16, 0x80, 0x09, 0xFE, 0xFF, 0x16, 0x80, 0x0F, 0xCD, 0x7F, 0x29, 
+    0xFF, 0x24, 0x80, 0x01, 0xF0, 0xFF, 0x24, 0x80, 0x00, 0xF0, 0xFF, 0x17, 
+    0x80, 0x0F, 0xFD, 0xFF, 0x56, 0xEF, 0x70, 0x18, 0xFF, 0x06, 0xFF, 0x56, 
+    0xFF, 0x18, 0x80, 0x0F, 0xC8, 0x80, 0x0A, 0xF2, 0xEF, 0x7F, 0x15, 0xD4, 
+    0x80, 0x0B, 0xF2, 0xFF, 0x56, 0xFF, 0x22, 0x80, 0x0A, 0xF2, 0xFF, 0x19, 
+    0x80, 0x0F, 0x7B, 0x01, 0xF2, 0xFF, 0x56, 0xFF, 0x56, 0xFF, 0x56, 0xFF, 
+    0x56, 0xFF, 0x1A, 0x80, 0x0A, 0xFA, 0xFF, 0x1A, 0x80, 0x07, 0xFA, 0xFF, 
+    0x1A, 0x80, 0x0F, 0xC6, 0x80, 0x0A, 0xF2, 0xFF, 0x56, 0xFF, 0x22, 0x80, 
+    0x0B, 0xF2, 0xFF, 0x22, 0x80, 0x0A, 0xF2, 0xFF, 0x22, 0x80, 0x0B, 0xF2, 
+    0xFF, 0x56, 0xFF, 0x56, 0xD9, 0x70, 0x43, 0xF0, 0xFF, 0x1B, 0x80, 0x01, 
+    0x53, 0xF3, 0xD9, 0x7F, 0x3A, 0x5B, 0x80, 0x0F, 0xF2, 0xFF, 0x1C, 0x6F, 
+    0xF2, 0xFF, 0x56, 0xFF, 0x56, 0xFF, 0x56, 0x7F, 0x8E, 0xFF, 0x56, 0xFF, 
+    0x56, 0xFF, 0x56, 0xFF, 0x56, 0xE5, 0x81, 0x00, 0xCA, 0x81, 0x00, 0xCE, 
+    0x81, 0x00, 0xCA, 0x81, 0x00, 0xCD, 0x81, 0x00, 0xCC, 0x81, 0x00, 0xC6, 
+    0x70, 0x06, 0xCE, 0xE7, 0x80, 0x00, 0xF9, 0x80, 0x00, 0xF1, 0xE4, 0x30, 
+    0x7F, 0x03, 0x81, 0x00, 0xCC, 0x81, 0x00, 0x7F, 0x03, 0x30, 0xDA, 0x20, 
+    0xC8, 0x7F, 0x13, 0xE6, 0x80, 0x0F, 0xCD, 0x80, 0x00, 0xFF, 0x1F, 0xE8, 
+    0x80, 0x00, 0x7F, 0x03, 0xCC, 0x81, 0x00, 0x7F, 0x03, 0x83, 0x00, 0xFF, 
+    0xCE, 0x80, 0x0F, 0xCC, 0x80, 0x0F, 0xE4, 0xE3, 0x82, 0x00, 0x0F, 0xCD, 
+    0x82, 0x0F, 0x00, 0xC8, 0x81, 0x00, 0x7F, 0x04, 0xC4, 0x80, 0x00, 0xCE, 
+    0x80, 0x00, 0xCC, 0x80, 0x00, 0xE2, 0xE7, 0x80, 0x0F, 0xCE, 0x80, 0x00, 
+    0xD6, 0x2F, 0xDA, 0x80, 0x00, 0xE6, 0xE4, 0x3F, 0x81, 0x00, 0x7F, 0x04, 
+    0xC8, 0x81, 0x00, 0x7F, 0x04, 0x80, 0x00, 0xC3, 0x82, 0x0F, 0x00, 0xC9, 
+    0x83, 0x00, 0xFF, 0xF1, 0xE2, 0x80, 0x00, 0xD2, 0x82, 0x0F, 0x00, 0xC4, 
+    0x81, 0x00, 0x7F, 0x05, 0xD6, 0x80, 0x00, 0xC8, 0x2F, 0xE3, 0xE8, 0x82, 
+    0x0F, 0x00, 0xCD, 0x80, 0x00, 0xD3, 0x5F, 0xD7, 0x80, 0x00, 0xE7, 0xE3, 
+    0x5F, 0xCD, 0x80, 0x0F, 0xC4, 0x81, 0x00, 0x7F, 0x05, 0x80, 0x00, 0xC7, 
+    0x80, 0x00, 0xC9, 0x2F, 0xF1, 0xE1, 0x80, 0x00, 0xC6, 0x80, 0x0F, 0xCD, 
+    0x85, 0x0F, 0xF0, 0x00, 0x7F, 0x06, 0xD6, 0x80, 0x0F, 0xC8, 0x3F, 0xC8, 
+    0x70, 0x04, 0xCE, 0xEB, 0x80, 0x00, 0xCE, 0x20, 0xCC, 0x81, 0x00, 0x7F, 
+    0x00, 0xCF, 0x80, 0x00, 0xCB, 0x80, 0x00, 0xC6, 0x7F, 0x13, 0xE0, 0x81, 
+    0x00, 0x7F, 0x00, 0xCE, 0x80, 0x0F, 0xC2, 0x7F, 0x06, 0xCA, 0x80, 0x00, 
+    0xD3, 0x80, 0x00, 0xE8, 0xEA, 0x80, 0x0F, 0xCE, 0x81, 0x0F, 0x7F, 0x07, 
+    0x80, 0x00, 0x7F, 0x01, 0xC8, 0x80, 0x00, 0xC4, 0x80, 0x0F, 0xEF, 0xCF, 
+    0x70, 0x02, 0xC7, 0x7F, 0x02, 0x81, 0x00, 0xDC, 0x80, 0x00, 0xC9, 0x80, 
+    0x0F, 0xD5, 0x4F, 0xD9, 0x70, 0x02, 0x7F, 0x18, 0x70, 0x06, 0xDE, 0x70, 
+    0x04, 0xCD, 0x80, 0x00, 0xC2, 0x80, 0x00, 0xC5, 0x80, 0x0F, 0xD8, 0x7F, 
+    0x02, 0xE1, 0x7F, 0x03, 0x81, 0x00, 0xDC, 0x7F, 0x03, 0xFE, 0xE0, 0x7F, 
+    0x04, 0xDC, 0x80, 0x00, 0xCB, 0x82, 0x0F, 0x00, 0xCB, 0x80, 0x0F, 0xEE, 
+    0xDE, 0x80, 0x00, 0xCC, 0x80, 0x0F, 0xF1, 0x6F, 0x84, 0x00, 0x0F, 0x00, 
+    0x6F, 0xE2, 0xEE, 0x80, 0x00, 0xDA, 0x7F, 0x06, 0xDA, 0x80, 0x00, 0xE0, 
+    0xDD, 0x81, 0x00, 0x7F, 0x06, 0xDA, 0x80, 0x00, 0xCF, 0x80, 0x00, 0xCB, 
+    0x80, 0x0F, 0xED, 0xED, 0x80, 0x0F, 0xEE, 0x80, 0x00, 0xCB, 0x7F, 0x00, 
+    0xE2, 0xDE, 0x7F, 0x08, 0x81, 0x00, 0xD6, 0x81, 0x00, 0x7F, 0x08, 0xCE, 
+    0x80, 0x00, 0xEB, 0xDC, 0x80, 0x00, 0xFC, 0x80, 0x00, 0xD6, 0x80, 0x0F, 
+    0xC6, 0x70, 0x04, 0xCE
+};
+
+const EPDRleImage logo_rle = {
+    .width = 150,
+    .height = 217,
+    .data_len = 2332,
+    .data = logo_rle_data,
+};
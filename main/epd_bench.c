@@ -0,0 +1,440 @@
+/**
+ * @file epd_bench.c
+ * @brief 描画処理のベンチマークの実装
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#else
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#include "esp_attr.h"
+#endif
+
+#include "epd_bench.h"
+#include "epd_transition.h"
+#include "epd_text.h"
+#include "epd_rle.h"
+
+// 固定の入力画像（540x960、4ビット/ピクセル）と、その圧縮版
+#include "bg1.h"
+#include "ichi.h"
+#include "bg1_rle.h"
+#include "ichi_rle.h"
+
+static const char *TAG = "epd_bench";
+
+// フォントデータはアプリケーション側（Mplus2-Light_16.h を含むファイル）で定義される
+extern const FontInfo Mplus2_Light_16;
+
+// 全画面のピクセル数とバイト数
+#define BENCH_SCREEN_PIXELS (EPD_DISPLAY_WIDTH * EPD_DISPLAY_HEIGHT)
+#define BENCH_SCREEN_BYTES (BENCH_SCREEN_PIXELS / 2)
+
+// テキスト計測で見本文を繰り返す回数（1ページを埋める長さにする）
+#define BENCH_TEXT_REPEAT 6
+
+// 見本文（夏目漱石「吾輩は猫である」冒頭）
+static const char BENCH_SAMPLE_TEXT[] =
+    "吾輩は猫である。名前はまだ無い。"
+    "どこで生れたかとんと見当がつかぬ。何でも薄暗いじめじめした所でニャーニャー泣いていた事だけは記憶している。"
+    "吾輩はここで始めて人間というものを見た。しかもあとで聞くとそれは書生という人間中で一番どうあくな種族であったそうだ。"
+    "この書生というのは時々我々を捕えて煮て食うという話である。しかしその当時は何という考もなかったから別段恐しいとも思わなかった。"
+    "ただ彼の掌に載せられてスーと持ち上げられた時何だかフワフワした感じがあったばかりである。\n";
+
+/**
+ * @brief 計測中に参照する状態
+ */
+typedef struct
+{
+    EPDWrapper *wrapper;
+    uint8_t *image;            // 回転結果の格納先（全画面）
+    EPDTextConfig text_config; // テキスト計測の設定
+    EpdRect text_rect;         // テキスト計測の描画領域
+    const char *text;          // テキスト計測の入力
+    EPDTransition transition;  // トランジション計測の状態
+    uint8_t color;             // 塗りつぶし計測で交互に使う色
+} BenchContext;
+
+typedef void (*BenchFunc)(BenchContext *ctx);
+
+// メモリ確保回数を数えられるか（実機は起動時ベンチマーク用のビルドでのheapのフック、
+// ホストはリンカの --wrap を使う）
+#define BENCH_COUNT_ALLOCS ((EPD_BENCH_ON_BOOT && CONFIG_HEAP_USE_HOOKS) || CONFIG_IDF_TARGET_LINUX)
+
+#if BENCH_COUNT_ALLOCS
+static volatile uint32_t s_alloc_count;
+#endif
+
+#if CONFIG_IDF_TARGET_LINUX
+// ホストでは malloc/calloc/realloc を置き換えて数える（main/CMakeLists.txt で -Wl,--wrap を指定）
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    __atomic_fetch_add(&s_alloc_count, 1, __ATOMIC_RELAXED);
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    __atomic_fetch_add(&s_alloc_count, 1, __ATOMIC_RELAXED);
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    __atomic_fetch_add(&s_alloc_count, 1, __ATOMIC_RELAXED);
+    return __real_realloc(ptr, size);
+}
+#elif BENCH_COUNT_ALLOCS
+// メモリ確保フック（heapコンポーネントから呼ばれる。sdkconfig.defaults.bench で有効にする）
+// 割り込みやフラッシュキャッシュ無効中の確保からも呼ばれるためIRAMに置く
+IRAM_ATTR void esp_heap_trace_alloc_hook(void *ptr, size_t size, uint32_t caps)
+{
+    s_alloc_count++;
+}
+
+IRAM_ATTR void esp_heap_trace_free_hook(void *ptr)
+{
+}
+#endif
+
+/**
+ * @brief 現在時刻をナノ秒で返す
+ */
+static inline int64_t bench_now_ns(void)
+{
+#if CONFIG_IDF_TARGET_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#else
+    return esp_timer_get_time() * 1000LL;
+#endif
+}
+
+/**
+ * @brief CPUサイクルカウンタを返す（ホストでは0）
+ */
+static inline uint32_t bench_cycles(void)
+{
+#if CONFIG_IDF_TARGET_LINUX
+    return 0;
+#else
+    return esp_cpu_get_cycle_count();
+#endif
+}
+
+/**
+ * @brief これまでのメモリ確保回数を返す（計測できない場合は0）
+ */
+static inline uint32_t bench_alloc_count(void)
+{
+#if BENCH_COUNT_ALLOCS
+    return __atomic_load_n(&s_alloc_count, __ATOMIC_RELAXED);
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief 1項目を繰り返し実行して計測する
+ * @param setup 各回の前に実行する準備処理（計測対象外、NULL可）
+ * @param func 計測する処理
+ */
+static void bench_run(BenchContext *ctx, EPDBenchResult *result, const char *name,
+                      const char *unit, uint32_t units, BenchFunc setup, BenchFunc func)
+{
+    memset(result, 0, sizeof(*result));
+    result->name = name;
+    result->unit = unit;
+    result->units = units;
+    result->best_ns = INT64_MAX;
+
+    uint32_t allocs = 0;
+    for (int i = 0; i < EPD_BENCH_ITERATIONS; i++)
+    {
+        if (setup != NULL)
+        {
+            setup(ctx);
+        }
+
+        uint32_t alloc_start = bench_alloc_count();
+        uint32_t cycle_start = bench_cycles();
+        int64_t start = bench_now_ns();
+
+        func(ctx);
+
+        int64_t elapsed = bench_now_ns() - start;
+        uint32_t cycles = bench_cycles() - cycle_start;
+        allocs += bench_alloc_count() - alloc_start;
+
+        result->total_ns += elapsed;
+        if (elapsed < result->best_ns)
+        {
+            result->best_ns = elapsed;
+            result->best_cycles = cycles;
+        }
+
+        // 非同期更新が有効な場合は画面更新の完了を待ってから次の回に進む
+        epd_wrapper_wait_idle(ctx->wrapper, portMAX_DELAY);
+    }
+
+    result->iterations = EPD_BENCH_ITERATIONS;
+#if BENCH_COUNT_ALLOCS
+    result->allocs_per_call = (int32_t)(allocs / EPD_BENCH_ITERATIONS);
+#else
+    (void)allocs;
+    result->allocs_per_call = -1;
+#endif
+
+    ESP_LOGI(TAG, "%s: best %lld us", name, (long long)(result->best_ns / 1000));
+}
+
+// 1ピクセルずつ全画面を描画する（ダーティ矩形は最後に1回だけ記録する）
+static void bench_draw_pixel(BenchContext *ctx)
+{
+    // 4ビットの階調を上位・下位ニブルに複製し、どちらのニブルを使う描画関数でも同じ階調にする
+    uint8_t color = (ctx->color++ & 0x0F) * 0x11;
+    for (int y = 0; y < EPD_DISPLAY_HEIGHT; y++)
+    {
+        for (int x = 0; x < EPD_DISPLAY_WIDTH; x++)
+        {
+            epd_wrapper_put_pixel(ctx->wrapper, x, y, color);
+        }
+    }
+    epd_wrapper_mark_dirty(ctx->wrapper, 0, 0, EPD_DISPLAY_WIDTH, EPD_DISPLAY_HEIGHT);
+}
+
+// 全画面を矩形で塗りつぶす
+static void bench_fill_rect(BenchContext *ctx)
+{
+    uint8_t color = (ctx->color++ & 1) ? 0x00 : 0xFF;
+    epd_wrapper_fill_rect(ctx->wrapper, 0, 0, epd_wrapper_get_width(ctx->wrapper),
+                          epd_wrapper_get_height(ctx->wrapper), color);
+}
+
+// 縦長の画像を90度回転する
+static void bench_rotate_90(BenchContext *ctx)
+{
+    rotate_image_data(bg1_data, BG1_WIDTH, BG1_HEIGHT, 1, ctx->image);
+}
+
+// 縦長の画像を270度回転する
+static void bench_rotate_270(BenchContext *ctx)
+{
+    rotate_image_data(ich_data, ICH_WIDTH, ICH_HEIGHT, 3, ctx->image);
+}
+
+// 圧縮した縦長の画像を90度回転しながら展開する
+static void bench_rle_decode_90(BenchContext *ctx)
+{
+    epd_rle_decode_to_framebuffer(&bg1_rle, 0, 0, 1, ctx->image);
+}
+
+// 圧縮した縦長の画像を270度回転しながら展開する
+static void bench_rle_decode_270(BenchContext *ctx)
+{
+    epd_rle_decode_to_framebuffer(&ichi_rle, 0, 0, 3, ctx->image);
+}
+
+// 描画領域を白で塗りつぶす（テキスト計測の準備）
+static void bench_text_setup(BenchContext *ctx)
+{
+    epd_wrapper_fill(ctx->wrapper, 0xFF);
+}
+
+// 1ページ分の複数行テキストを描画する
+static void bench_text(BenchContext *ctx)
+{
+    EpdRect rect = ctx->text_rect;
+    epd_text_draw_multiline(ctx->wrapper, &rect, ctx->text, &ctx->text_config);
+}
+
+// トランジションを最初のステップから始められる状態にする
+static void bench_transition_setup(BenchContext *ctx)
+{
+    epd_wrapper_fill(ctx->wrapper, 0xFF);
+    // 画面は更新しないため、塗りつぶしで記録されたダーティ矩形も破棄する
+    epd_wrapper_clear_dirty(ctx->wrapper);
+    // 前回の計測で1ステップだけ進めたトランジションは黙って破棄する
+    ctx->transition.is_active = false;
+    epd_transition_prepare(ctx->wrapper, &ctx->transition, TRANSITION_SLIDE_LEFT, MODE_DU);
+}
+
+// トランジションの1ステップ分をフレームバッファに合成する（画面更新の時間は含めない）
+static void bench_transition_merge(BenchContext *ctx)
+{
+    epd_transition_compose_step(ctx->wrapper, &ctx->transition);
+}
+
+/**
+ * @brief 1ページに収まるグリフ数を数える
+ *
+ * epd_text_draw_multiline() と同じ条件で行分割し、収まる行のコードポイント数を合計します。
+ */
+static uint32_t count_page_glyphs(const BenchContext *ctx)
+{
+    int wrap_limit = 0;
+    int max_lines = epd_text_multiline_capacity(&ctx->text_rect, &ctx->text_config, &wrap_limit);
+
+    EPDTextLineBreaker breaker;
+    epd_text_line_breaker_init(&breaker, ctx->text, strlen(ctx->text), &ctx->text_config, wrap_limit);
+
+    uint32_t glyphs = 0;
+    EPDTextLine line;
+    for (int i = 0; i < max_lines && epd_text_line_breaker_next(&breaker, &line); i++)
+    {
+        for (size_t j = 0; j < line.length; j++)
+        {
+            // UTF-8の継続バイト以外を数える
+            if ((ctx->text[line.offset + j] & 0xC0) != 0x80)
+            {
+                glyphs++;
+            }
+        }
+    }
+    return glyphs;
+}
+
+int epd_bench_run_all(EPDWrapper *wrapper, EPDBenchResult *results, int max_results)
+{
+    if (wrapper == NULL || !wrapper->is_initialized || results == NULL || max_results <= 0)
+    {
+        ESP_LOGE(TAG, "Invalid parameters for benchmark");
+        return 0;
+    }
+
+    BenchContext ctx = {
+        .wrapper = wrapper,
+    };
+
+    // 回転結果の格納先（トランジションの次画面にも使う）
+    ctx.image = heap_caps_malloc(BENCH_SCREEN_BYTES, MALLOC_CAP_SPIRAM);
+    // 見本文を繰り返して1ページ分以上の長さにする
+    size_t sample_length = strlen(BENCH_SAMPLE_TEXT);
+    char *text = heap_caps_malloc(sample_length * BENCH_TEXT_REPEAT + 1, MALLOC_CAP_SPIRAM);
+    if (ctx.image == NULL || text == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate benchmark buffers");
+        heap_caps_free(ctx.image);
+        heap_caps_free(text);
+        return 0;
+    }
+    for (int i = 0; i < BENCH_TEXT_REPEAT; i++)
+    {
+        memcpy(text + sample_length * i, BENCH_SAMPLE_TEXT, sample_length);
+    }
+    text[sample_length * BENCH_TEXT_REPEAT] = '\0';
+    ctx.text = text;
+
+    epd_text_config_init(&ctx.text_config, &Mplus2_Light_16);
+    ctx.text_config.text_color = 0x00;
+    ctx.text_config.char_spacing = 2;
+    ctx.text_config.line_spacing = 5;
+    ctx.text_config.box_padding = 5;
+    ctx.text_rect = (EpdRect){
+        .x = 0,
+        .y = 0,
+        .width = epd_wrapper_get_width(wrapper),
+        .height = epd_wrapper_get_height(wrapper)};
+
+    ESP_LOGI(TAG, "Running benchmarks (%d iterations each)", EPD_BENCH_ITERATIONS);
+
+    int count = 0;
+
+    if (count < max_results)
+    {
+        bench_run(&ctx, &results[count++], "draw_pixel", "px", BENCH_SCREEN_PIXELS,
+                  NULL, bench_draw_pixel);
+    }
+    if (count < max_results)
+    {
+        bench_run(&ctx, &results[count++], "fill_rect", "px", BENCH_SCREEN_PIXELS,
+                  NULL, bench_fill_rect);
+    }
+    if (count < max_results)
+    {
+        bench_run(&ctx, &results[count++], "rotate_90", "px", BG1_WIDTH * BG1_HEIGHT,
+                  NULL, bench_rotate_90);
+    }
+    if (count < max_results)
+    {
+        bench_run(&ctx, &results[count++], "rotate_270", "px", ICH_WIDTH * ICH_HEIGHT,
+                  NULL, bench_rotate_270);
+    }
+    if (count < max_results)
+    {
+        bench_run(&ctx, &results[count++], "rle_decode_90", "px", BG1_WIDTH * BG1_HEIGHT,
+                  NULL, bench_rle_decode_90);
+    }
+    if (count < max_results)
+    {
+        bench_run(&ctx, &results[count++], "rle_decode_270", "px", ICHI_WIDTH * ICHI_HEIGHT,
+                  NULL, bench_rle_decode_270);
+    }
+    if (count < max_results)
+    {
+        bench_run(&ctx, &results[count++], "text_page", "glyph", count_page_glyphs(&ctx),
+                  bench_text_setup, bench_text);
+    }
+
+    // トランジションの次画面は90度回転したbg1を使う
+    if (count < max_results && epd_transition_init(wrapper, &ctx.transition, 16))
+    {
+        rotate_image_data(bg1_data, BG1_WIDTH, BG1_HEIGHT, 1, ctx.image);
+        memcpy(epd_transition_get_next_framebuffer(&ctx.transition), ctx.image, BENCH_SCREEN_BYTES);
+        bench_run(&ctx, &results[count++], "transition_merge", "px", BENCH_SCREEN_PIXELS,
+                  bench_transition_setup, bench_transition_merge);
+        ctx.transition.is_active = false;
+        epd_transition_deinit(wrapper, &ctx.transition);
+    }
+
+    // 計測で書き換えた内容を破棄する
+    epd_wrapper_fill(wrapper, 0xFF);
+    epd_wrapper_clear_dirty(wrapper);
+
+    heap_caps_free(text);
+    heap_caps_free(ctx.image);
+    return count;
+}
+
+void epd_bench_print(const EPDBenchResult *results, int count)
+{
+    if (results == NULL)
+    {
+        return;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        const EPDBenchResult *r = &results[i];
+        double units = r->units > 0 ? (double)r->units : 1.0;
+        double ns_per_unit = (double)r->best_ns / units;
+        double units_per_s = r->best_ns > 0 ? units * 1e9 / (double)r->best_ns : 0.0;
+
+        // ホストではCPUサイクル数を計測できないため n/a とする
+        char cycles_per_unit[16];
+#if CONFIG_IDF_TARGET_LINUX
+        snprintf(cycles_per_unit, sizeof(cycles_per_unit), "n/a");
+#else
+        snprintf(cycles_per_unit, sizeof(cycles_per_unit), "%.2f", (double)r->best_cycles / units);
+#endif
+
+        printf("EPD_BENCH name=%s iters=%d units=%u unit=%s best_us=%.1f avg_us=%.1f "
+               "ns_per_unit=%.2f cycles_per_unit=%s units_per_s=%.0f allocs_per_call=%d\n",
+               r->name, r->iterations, (unsigned)r->units, r->unit,
+               (double)r->best_ns / 1000.0,
+               r->iterations > 0 ? (double)r->total_ns / r->iterations / 1000.0 : 0.0,
+               ns_per_unit, cycles_per_unit, units_per_s, (int)r->allocs_per_call);
+    }
+}
@@ -0,0 +1,77 @@
+/**
+ * @file epd_bench.h
+ * @brief 描画処理のベンチマーク
+ *
+ * 同梱の画像（bg1.h, ichi.h とその圧縮版）と日本語の長文を固定の入力として
+ * 描画処理の主要な経路を繰り返し実行し、1ピクセル（1グリフ）あたりの時間・サイクル数と
+ * 1回あたりのメモリ確保回数を計測します。
+ * 実機ではesp_timerとCPUサイクルカウンタ、ホストビルドではclock_gettimeで計時します。
+ *
+ * メモリ確保回数はCONFIG_HEAP_USE_HOOKSが有効な場合のみ計測できます。
+ */
+
+#ifndef EPD_BENCH_H
+#define EPD_BENCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "epd_wrapper.h"
+
+/**
+ * @brief 起動時にベンチマークを実行するか（実機用）
+ *
+ * idf.py -D EPD_BENCH_ON_BOOT=1 で有効になります。メモリ確保回数も数える場合は
+ * sdkconfig.defaults.bench の手順で CONFIG_HEAP_USE_HOOKS を有効にしてビルドしてください。
+ */
+#ifndef EPD_BENCH_ON_BOOT
+#define EPD_BENCH_ON_BOOT 0
+#endif
+
+/**
+ * @brief 1項目あたりの繰り返し回数
+ */
+#ifndef EPD_BENCH_ITERATIONS
+#define EPD_BENCH_ITERATIONS 5
+#endif
+
+/**
+ * @brief 計測項目の最大数
+ */
+#define EPD_BENCH_MAX_RESULTS 8
+
+/**
+ * @brief 1項目の計測結果
+ */
+typedef struct
+{
+    const char *name;         // 項目名
+    const char *unit;         // 処理量の単位（"px" または "glyph"）
+    uint32_t units;           // 1回あたりの処理量
+    int iterations;           // 繰り返し回数
+    int64_t best_ns;          // 最短の所要時間（ナノ秒）
+    int64_t total_ns;         // 合計の所要時間（ナノ秒）
+    uint32_t best_cycles;     // 最短のCPUサイクル数（ホストでは計測できないため0）
+    int32_t allocs_per_call;  // 1回あたりのメモリ確保回数（計測できない場合は-1）
+} EPDBenchResult;
+
+/**
+ * @brief すべての項目を計測する
+ * @param wrapper 初期化済みのEPDラッパー
+ * @param results 計測結果の格納先
+ * @param max_results 格納できる結果の数
+ * @return 計測した項目数
+ *
+ * フレームバッファの内容は書き換えられ、終了時に白で塗りつぶされます（画面更新は行いません）。
+ */
+int epd_bench_run_all(EPDWrapper *wrapper, EPDBenchResult *results, int max_results);
+
+/**
+ * @brief 計測結果を1項目1行で出力する
+ * @param results 計測結果
+ * @param count 項目数
+ *
+ * "EPD_BENCH name=... ns_per_unit=..." 形式で標準出力に出力するため、CIで比較できます。
+ */
+void epd_bench_print(const EPDBenchResult *results, int count);
+
+#endif // EPD_BENCH_H
@@ -0,0 +1,623 @@
+/**
+ * @file epd_book.c
+ * @brief テキストファイルのページ分割と表示の実装
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+#include "epd_book.h"
+
+static const char *TAG = "epd_book";
+
+// 索引ファイルの識別子とバージョン（レイアウト方法を変えたら上げる）
+#define BOOK_INDEX_MAGIC 0x58494245 // "EBIX"
+#define BOOK_INDEX_VERSION 1
+
+// 本文のハッシュに使う先頭・末尾のバイト数
+#define BOOK_HASH_SAMPLE_SIZE 4096
+
+// ページ開始位置をまとめて書き込む数
+#define BOOK_OFFSET_BATCH 64
+// 最初の数ページはすぐに表示できるよう1ページずつ書き込む
+#define BOOK_EARLY_FLUSH_PAGES 4
+
+/**
+ * @brief 索引ファイルのヘッダー
+ *
+ * ヘッダーの後にページ開始位置（uint32_t）がページ数分続く。
+ */
+typedef struct
+{
+    uint32_t magic;        // BOOK_INDEX_MAGIC
+    uint32_t version;      // BOOK_INDEX_VERSION
+    uint32_t file_size;    // 本文ファイルのサイズ
+    uint32_t file_mtime;   // 本文ファイルの更新日時
+    uint32_t content_hash; // 本文の先頭・末尾のハッシュ
+    uint32_t layout_hash;  // フォント・レイアウト設定のハッシュ
+    uint32_t page_count;   // ページ数
+    uint32_t complete;     // レイアウトが完了していれば1
+} BookIndexHeader;
+
+/**
+ * @brief FNV-1aハッシュを更新する
+ */
+static uint32_t fnv1a(uint32_t hash, const void *data, size_t length)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ p[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t fnv1a_u32(uint32_t hash, uint32_t value)
+{
+    return fnv1a(hash, &value, sizeof(value));
+}
+
+/**
+ * @brief 本文ファイルの先頭と末尾からハッシュを求める
+ *
+ * ファイル全体を読むと開くたびにサイズに比例した時間がかかるため、
+ * サイズ・更新日時と合わせて先頭・末尾だけで変更を検出する。
+ */
+static uint32_t hash_content(EPDBook *book)
+{
+    uint32_t hash = fnv1a_u32(2166136261u, book->file_size);
+    size_t sample = book->file_size < BOOK_HASH_SAMPLE_SIZE ? book->file_size : BOOK_HASH_SAMPLE_SIZE;
+
+    fseek(book->text_file, 0, SEEK_SET);
+    size_t n = fread(book->page_buffer, 1, sample, book->text_file);
+    hash = fnv1a(hash, book->page_buffer, n);
+
+    if (book->file_size > sample)
+    {
+        fseek(book->text_file, (long)(book->file_size - sample), SEEK_SET);
+        n = fread(book->page_buffer, 1, sample, book->text_file);
+        hash = fnv1a(hash, book->page_buffer, n);
+    }
+    return hash;
+}
+
+/**
+ * @brief フォントとレイアウト設定からハッシュを求める
+ */
+static uint32_t hash_layout(const EPDBook *book)
+{
+    const EPDTextConfig *config = &book->config;
+    const FontInfo *font = config->font;
+    uint32_t hash = fnv1a_u32(2166136261u, BOOK_INDEX_VERSION);
+
+    // フォント（メトリクスと文字情報）
+    hash = fnv1a_u32(hash, font->size);
+    hash = fnv1a_u32(hash, font->max_width);
+    hash = fnv1a_u32(hash, font->max_height);
+    hash = fnv1a_u32(hash, font->baseline);
+    hash = fnv1a_u32(hash, font->chars_count);
+    for (int i = 0; i < font->chars_count; i++)
+    {
+        const FontCharInfo *c = &font->chars[i];
+        hash = fnv1a_u32(hash, c->code_point);
+        hash = fnv1a_u32(hash, (uint32_t)c->img_width | ((uint32_t)c->img_height << 8) |
+                                   ((uint32_t)c->typo_flags << 16) | ((uint32_t)c->rotation << 24));
+    }
+
+    // レイアウト設定
+    hash = fnv1a_u32(hash, book->rect.width);
+    hash = fnv1a_u32(hash, book->rect.height);
+    hash = fnv1a_u32(hash, config->vertical);
+    hash = fnv1a_u32(hash, config->mono_spacing);
+    hash = fnv1a_u32(hash, config->line_spacing);
+    hash = fnv1a_u32(hash, config->char_spacing);
+    hash = fnv1a_u32(hash, config->box_padding);
+    hash = fnv1a_u32(hash, EPD_BOOK_PAGE_BUFFER_SIZE);
+    return hash;
+}
+
+/**
+ * @brief 本文ファイルのパスから索引ファイルのパスを作る
+ *
+ * 長いファイル名が使えない（8.3形式）ため、拡張子を .idx に置き換える。
+ */
+static bool make_index_path(const char *path, char *index_path, size_t size)
+{
+    const char *slash = strrchr(path, '/');
+    const char *dot = strrchr(path, '.');
+    size_t base_len = (dot != NULL && (slash == NULL || dot > slash)) ? (size_t)(dot - path) : strlen(path);
+
+    int written = snprintf(index_path, size, "%.*s.idx", (int)base_len, path);
+    return written > 0 && (size_t)written < size;
+}
+
+/**
+ * @brief 書き込み済みの索引ファイルを読み込む
+ * @return 有効な索引があった場合はtrue
+ */
+static bool load_index(EPDBook *book)
+{
+    FILE *f = fopen(book->index_path, "rb");
+    if (f == NULL)
+    {
+        return false;
+    }
+
+    BookIndexHeader header;
+    bool valid = fread(&header, sizeof(header), 1, f) == 1 &&
+                 header.magic == BOOK_INDEX_MAGIC &&
+                 header.version == BOOK_INDEX_VERSION &&
+                 header.file_size == book->file_size &&
+                 header.file_mtime == book->file_mtime &&
+                 header.content_hash == book->content_hash &&
+                 header.layout_hash == book->layout_hash &&
+                 header.complete == 1 &&
+                 header.page_count > 0;
+
+    // ページ開始位置がすべて書き込まれているか
+    if (valid)
+    {
+        fseek(f, 0, SEEK_END);
+        long expected = (long)(sizeof(header) + header.page_count * sizeof(uint32_t));
+        valid = ftell(f) >= expected;
+    }
+
+    if (!valid)
+    {
+        fclose(f);
+        return false;
+    }
+
+    book->index_file = f;
+    book->pages_indexed = (int)header.page_count;
+    book->layout_complete = true;
+    ESP_LOGI(TAG, "Loaded page index %s (%lu pages)", book->index_path, (unsigned long)header.page_count);
+    return true;
+}
+
+/**
+ * @brief 索引ファイルのヘッダーを書き込む
+ */
+static bool write_header(EPDBook *book, uint32_t page_count, bool complete)
+{
+    BookIndexHeader header = {
+        .magic = BOOK_INDEX_MAGIC,
+        .version = BOOK_INDEX_VERSION,
+        .file_size = book->file_size,
+        .file_mtime = book->file_mtime,
+        .content_hash = book->content_hash,
+        .layout_hash = book->layout_hash,
+        .page_count = page_count,
+        .complete = complete ? 1 : 0,
+    };
+
+    xSemaphoreTake(book->index_lock, portMAX_DELAY);
+    fseek(book->index_file, 0, SEEK_SET);
+    bool ok = fwrite(&header, sizeof(header), 1, book->index_file) == 1 &&
+              fflush(book->index_file) == 0;
+    xSemaphoreGive(book->index_lock);
+    return ok;
+}
+
+/**
+ * @brief ページ開始位置を索引ファイルに追記する
+ */
+static bool flush_offsets(EPDBook *book, const uint32_t *offsets, int count)
+{
+    if (count == 0)
+    {
+        return true;
+    }
+
+    xSemaphoreTake(book->index_lock, portMAX_DELAY);
+    fseek(book->index_file, 0, SEEK_END);
+    bool ok = fwrite(offsets, sizeof(uint32_t), count, book->index_file) == (size_t)count &&
+              fflush(book->index_file) == 0;
+    if (ok)
+    {
+        book->pages_indexed += count;
+    }
+    xSemaphoreGive(book->index_lock);
+    return ok;
+}
+
+/**
+ * @brief 不完全なUTF-8シーケンスを除いた長さを返す
+ */
+static size_t utf8_complete_length(const uint8_t *data, size_t length)
+{
+    // 末尾から最大3バイト戻って、先頭バイトを探す
+    for (size_t back = 1; back <= 4 && back <= length; back++)
+    {
+        uint8_t c = data[length - back];
+        if ((c & 0xC0) == 0x80)
+        {
+            continue; // 継続バイト
+        }
+
+        size_t needed = 1;
+        if ((c & 0xE0) == 0xC0)
+            needed = 2;
+        else if ((c & 0xF0) == 0xE0)
+            needed = 3;
+        else if ((c & 0xF8) == 0xF0)
+            needed = 4;
+
+        return (needed > back) ? length - back : length;
+    }
+    return length;
+}
+
+/**
+ * @brief 本文ファイル全体をレイアウトしてページ開始位置を索引ファイルに書き込む
+ * @return 完了した場合はtrue（中止・失敗した場合はfalse）
+ *
+ * 読み込みバッファに収まった行から順に処理し、バッファ末尾で途切れた行は
+ * 読み足してからもう一度処理する。ページ分割は epd_text_draw_multiline() と
+ * 同じ行分割・行数で行う。
+ */
+static bool layout_book(EPDBook *book)
+{
+    int wrap_limit;
+    int max_lines = epd_text_multiline_capacity(&book->rect, &book->config, &wrap_limit);
+    if (max_lines <= 0)
+    {
+        ESP_LOGE(TAG, "Layout rect too small for a single line");
+        return false;
+    }
+
+    FILE *f = fopen(book->path, "rb");
+    if (f == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to open %s for layout", book->path);
+        return false;
+    }
+
+    uint8_t *buffer = heap_caps_malloc(EPD_BOOK_READ_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+    if (buffer == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate layout buffer");
+        fclose(f);
+        return false;
+    }
+
+    uint32_t offsets[BOOK_OFFSET_BATCH];
+    int offset_count = 0;
+    offsets[offset_count++] = 0; // 1ページ目は先頭から
+
+    size_t buffer_length = 0;   // バッファ内のバイト数
+    size_t consumed = 0;        // 処理済みのバイト数
+    uint32_t buffer_offset = 0; // buffer[0] のファイル上の位置
+    bool eof = false;
+
+    uint32_t page_start = 0;
+    int lines_in_page = 0;
+    bool ok = true;
+
+    while (ok)
+    {
+        if (book->layout_cancel)
+        {
+            ESP_LOGI(TAG, "Layout cancelled");
+            ok = false;
+            break;
+        }
+
+        // 処理済みの部分を捨てて読み足す
+        if (consumed > 0)
+        {
+            memmove(buffer, buffer + consumed, buffer_length - consumed);
+            buffer_length -= consumed;
+            buffer_offset += consumed;
+            consumed = 0;
+        }
+        if (!eof && buffer_length < EPD_BOOK_READ_BUFFER_SIZE)
+        {
+            size_t request = EPD_BOOK_READ_BUFFER_SIZE - buffer_length;
+            size_t n = fread(buffer + buffer_length, 1, request, f);
+            buffer_length += n;
+            if (n < request)
+            {
+                if (ferror(f))
+                {
+                    ESP_LOGE(TAG, "Read error during layout");
+                    ok = false;
+                    break;
+                }
+                eof = true;
+            }
+        }
+
+        size_t data_length = eof ? buffer_length : utf8_complete_length(buffer, buffer_length);
+        if (eof && data_length == 0)
+        {
+            break;
+        }
+
+        EPDTextLineBreaker breaker;
+        epd_text_line_breaker_init(&breaker, (const char *)buffer, data_length, &book->config, wrap_limit);
+        EPDTextLine line;
+
+        while (epd_text_line_breaker_next(&breaker, &line))
+        {
+            // バッファ末尾まで続く行は途中で切れている可能性があるので読み足す
+            // （バッファ全体が1行の場合はそこで区切る）
+            bool reached_end = !line.hard_break && breaker.pos >= data_length;
+            if (reached_end && !eof && consumed > 0)
+            {
+                break;
+            }
+
+            uint32_t line_start = buffer_offset + line.offset;
+            uint32_t line_next = buffer_offset + breaker.pos;
+
+            // ページが埋まった、またはページのバイト数が上限を超える場合は改ページ
+            if (lines_in_page > 0 &&
+                (lines_in_page >= max_lines || line_next - page_start > EPD_BOOK_PAGE_BUFFER_SIZE))
+            {
+                offsets[offset_count++] = line_start;
+                page_start = line_start;
+                lines_in_page = 0;
+
+                if (offset_count == BOOK_OFFSET_BATCH ||
+                    book->pages_indexed + offset_count <= BOOK_EARLY_FLUSH_PAGES)
+                {
+                    if (!flush_offsets(book, offsets, offset_count))
+                    {
+                        ESP_LOGE(TAG, "Failed to write page index");
+                        ok = false;
+                        break;
+                    }
+                    offset_count = 0;
+                }
+            }
+            lines_in_page++;
+            consumed = breaker.pos;
+        }
+
+        if (!ok)
+        {
+            break;
+        }
+
+        // ヌル文字で止まった場合は読み飛ばす
+        if (consumed < data_length && breaker.pos < data_length && buffer[breaker.pos] == '\0')
+        {
+            consumed = breaker.pos + 1;
+        }
+
+        if (eof && consumed >= data_length)
+        {
+            break;
+        }
+    }
+
+    if (ok)
+    {
+        ok = flush_offsets(book, offsets, offset_count) &&
+             write_header(book, (uint32_t)book->pages_indexed, true);
+        if (!ok)
+        {
+            ESP_LOGE(TAG, "Failed to finalize page index");
+        }
+    }
+
+    heap_caps_free(buffer);
+    fclose(f);
+
+    if (ok)
+    {
+        ESP_LOGI(TAG, "Layout complete: %d pages", book->pages_indexed);
+    }
+    return ok;
+}
+
+/**
+ * @brief バックグラウンドでレイアウトを行うタスク
+ */
+static void layout_task(void *pvParameters)
+{
+    EPDBook *book = (EPDBook *)pvParameters;
+
+    if (layout_book(book))
+    {
+        book->layout_complete = true;
+    }
+    else
+    {
+        book->layout_failed = true;
+    }
+
+    xSemaphoreGive(book->layout_done);
+    vTaskDelete(NULL);
+}
+
+bool epd_book_open(EPDBook *book, const char *path, const EpdRect *rect, const EPDTextConfig *config)
+{
+    if (book == NULL || path == NULL || rect == NULL || config == NULL || config->font == NULL)
+    {
+        ESP_LOGE(TAG, "Invalid parameters for opening book");
+        return false;
+    }
+
+    memset(book, 0, sizeof(EPDBook));
+    if (strlen(path) >= sizeof(book->path) ||
+        !make_index_path(path, book->index_path, sizeof(book->index_path)))
+    {
+        ESP_LOGE(TAG, "Path too long: %s", path);
+        return false;
+    }
+    strcpy(book->path, path);
+    book->rect = *rect;
+    book->config = *config;
+
+    struct stat st;
+    if (stat(path, &st) != 0)
+    {
+        ESP_LOGE(TAG, "Failed to stat %s", path);
+        return false;
+    }
+    book->file_size = (uint32_t)st.st_size;
+    book->file_mtime = (uint32_t)st.st_mtime;
+
+    book->text_file = fopen(path, "rb");
+    book->page_buffer = heap_caps_malloc(EPD_BOOK_PAGE_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+    book->index_lock = xSemaphoreCreateMutex();
+    book->layout_done = xSemaphoreCreateBinary();
+    if (book->text_file == NULL || book->page_buffer == NULL ||
+        book->index_lock == NULL || book->layout_done == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to open book %s", path);
+        epd_book_close(book);
+        return false;
+    }
+
+    book->content_hash = hash_content(book);
+    book->layout_hash = hash_layout(book);
+
+    // 有効な索引があればレイアウトは不要
+    if (load_index(book))
+    {
+        return true;
+    }
+
+    // 索引を作り直す
+    book->index_file = fopen(book->index_path, "w+b");
+    if (book->index_file == NULL || !write_header(book, 0, false))
+    {
+        ESP_LOGE(TAG, "Failed to create page index %s", book->index_path);
+        epd_book_close(book);
+        return false;
+    }
+
+    ESP_LOGI(TAG, "Starting layout of %s (%lu bytes)", path, (unsigned long)book->file_size);
+    if (xTaskCreate(layout_task, "book_layout", EPD_BOOK_LAYOUT_TASK_STACK, book,
+                    EPD_BOOK_LAYOUT_TASK_PRIORITY, &book->layout_task) != pdPASS)
+    {
+        ESP_LOGE(TAG, "Failed to create layout task");
+        book->layout_task = NULL;
+        epd_book_close(book);
+        return false;
+    }
+    return true;
+}
+
+void epd_book_close(EPDBook *book)
+{
+    if (book == NULL)
+    {
+        return;
+    }
+
+    // レイアウト中なら中止して終了を待つ
+    if (book->layout_task != NULL)
+    {
+        book->layout_cancel = true;
+        xSemaphoreTake(book->layout_done, portMAX_DELAY);
+        book->layout_task = NULL;
+    }
+
+    if (book->text_file != NULL)
+    {
+        fclose(book->text_file);
+    }
+    if (book->index_file != NULL)
+    {
+        fclose(book->index_file);
+    }
+    if (book->page_buffer != NULL)
+    {
+        heap_caps_free(book->page_buffer);
+    }
+    if (book->index_lock != NULL)
+    {
+        vSemaphoreDelete(book->index_lock);
+    }
+    if (book->layout_done != NULL)
+    {
+        vSemaphoreDelete(book->layout_done);
+    }
+    memset(book, 0, sizeof(EPDBook));
+}
+
+int epd_book_get_page_count(EPDBook *book)
+{
+    if (book == NULL)
+    {
+        return 0;
+    }
+    int indexed = book->pages_indexed;
+    if (book->layout_complete)
+    {
+        return indexed;
+    }
+    // レイアウト中は次のページの開始位置が分かっているページだけ表示できる
+    return indexed > 0 ? indexed - 1 : 0;
+}
+
+bool epd_book_is_layout_complete(EPDBook *book)
+{
+    return book != NULL && book->layout_complete;
+}
+
+bool epd_book_wait_for_page(EPDBook *book, int page, uint32_t timeout_ms)
+{
+    if (book == NULL)
+    {
+        return false;
+    }
+
+    uint32_t waited = 0;
+    while (page >= epd_book_get_page_count(book))
+    {
+        if (book->layout_complete || book->layout_failed || waited >= timeout_ms)
+        {
+            return false;
+        }
+        vTaskDelay(20 / portTICK_PERIOD_MS);
+        waited += 20;
+    }
+    return true;
+}
+
+int epd_book_render_page(EPDBook *book, EPDWrapper *wrapper, int page)
+{
+    if (book == NULL || wrapper == NULL || book->index_file == NULL)
+    {
+        return -1;
+    }
+    if (page < 0 || page >= epd_book_get_page_count(book))
+    {
+        ESP_LOGW(TAG, "Page %d is not available yet", page);
+        return -1;
+    }
+
+    // ページの開始位置と次のページの開始位置を読む
+    uint32_t range[2] = {0, book->file_size};
+    int count = (page + 1 < book->pages_indexed) ? 2 : 1;
+
+    xSemaphoreTake(book->index_lock, portMAX_DELAY);
+    fseek(book->index_file, (long)(sizeof(BookIndexHeader) + page * sizeof(uint32_t)), SEEK_SET);
+    bool ok = fread(range, sizeof(uint32_t), count, book->index_file) == (size_t)count;
+    xSemaphoreGive(book->index_lock);
+
+    if (!ok || range[1] < range[0])
+    {
+        ESP_LOGE(TAG, "Failed to read page index for page %d", page);
+        return -1;
+    }
+
+    // このページのバイト列だけを読み込む
+    size_t length = range[1] - range[0];
+    if (length > EPD_BOOK_PAGE_BUFFER_SIZE)
+    {
+        length = EPD_BOOK_PAGE_BUFFER_SIZE;
+    }
+    fseek(book->text_file, (long)range[0], SEEK_SET);
+    length = fread(book->page_buffer, 1, length, book->text_file);
+
+    return epd_text_draw_multiline_n(wrapper, &book->rect, (const char *)book->page_buffer, length, &book->config);
+}
@@ -0,0 +1,119 @@
+/**
+ * @file epd_book.h
+ * @brief テキストファイルのページ分割と表示
+ *
+ * SDカード上のテキストファイルをバックグラウンドで一度だけレイアウトし、
+ * 各ページの開始位置（バイトオフセット）を索引ファイルとして保存します。
+ * ページ表示時はそのページのバイト列だけを読み込んで描画するため、
+ * ファイルサイズに関係なく一定の時間・メモリでページをめくれます。
+ *
+ * 索引ファイルは本文と同じディレクトリに拡張子 .IDX で作成します
+ * （例: /sdcard/test.txt → /sdcard/test.idx）。
+ * ファイルの内容・フォント・レイアウト設定が変わった場合は作り直します。
+ */
+
+#ifndef EPD_BOOK_H
+#define EPD_BOOK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "epd_wrapper.h"
+#include "epd_text.h"
+
+/**
+ * @brief ページ分割の設定
+ */
+#define EPD_BOOK_PATH_MAX 64                 // ファイルパスの最大長
+#define EPD_BOOK_READ_BUFFER_SIZE (16 * 1024) // レイアウト時の読み込みバッファサイズ
+#define EPD_BOOK_PAGE_BUFFER_SIZE (16 * 1024) // 1ページの最大バイト数
+#define EPD_BOOK_LAYOUT_TASK_STACK 4096      // レイアウトタスクのスタックサイズ
+#define EPD_BOOK_LAYOUT_TASK_PRIORITY 3      // レイアウトタスクの優先度
+
+/**
+ * @brief 本（ページ分割されたテキストファイル）の状態
+ */
+typedef struct
+{
+    char path[EPD_BOOK_PATH_MAX];       // 本文ファイルのパス
+    char index_path[EPD_BOOK_PATH_MAX]; // 索引ファイルのパス
+    EpdRect rect;                       // 描画領域
+    EPDTextConfig config;               // テキスト描画設定
+
+    uint32_t file_size;    // 本文ファイルのサイズ
+    uint32_t file_mtime;   // 本文ファイルの更新日時
+    uint32_t content_hash; // 本文の先頭・末尾から求めたハッシュ
+    uint32_t layout_hash;  // フォント・レイアウト設定から求めたハッシュ
+
+    FILE *text_file;              // 本文ファイル（ページ読み込み用）
+    FILE *index_file;             // 索引ファイル
+    SemaphoreHandle_t index_lock; // 索引ファイルへのアクセスを保護する
+    uint8_t *page_buffer;         // 1ページ分の読み込みバッファ（PSRAM）
+
+    volatile int pages_indexed;        // 索引ファイルに書き込み済みのページ開始位置の数
+    volatile bool layout_complete;     // レイアウトが完了したかどうか
+    volatile bool layout_failed;       // レイアウトが失敗したかどうか
+    volatile bool layout_cancel;       // レイアウトの中止要求
+    TaskHandle_t layout_task;          // レイアウトタスク
+    SemaphoreHandle_t layout_done;     // レイアウトタスクの終了通知
+} EPDBook;
+
+/**
+ * @brief 本を開く
+ * @param book 初期化する本の構造体へのポインタ
+ * @param path 本文ファイルのパス（UTF-8テキスト）
+ * @param rect 1ページの描画領域
+ * @param config テキスト描画設定
+ * @return 成功した場合はtrue
+ *
+ * 有効な索引ファイルがあればそれを使い、なければバックグラウンドで
+ * レイアウトを開始します。レイアウト中でも索引済みのページは表示できます。
+ */
+bool epd_book_open(EPDBook *book, const char *path, const EpdRect *rect, const EPDTextConfig *config);
+
+/**
+ * @brief 本を閉じる
+ * @param book 本の構造体へのポインタ
+ *
+ * レイアウト中の場合は中止して終了を待ちます。
+ */
+void epd_book_close(EPDBook *book);
+
+/**
+ * @brief 現在表示できるページ数を返す
+ * @param book 本の構造体へのポインタ
+ * @return 表示できるページ数（レイアウト中は増えていく）
+ */
+int epd_book_get_page_count(EPDBook *book);
+
+/**
+ * @brief レイアウトが完了したかどうかを返す
+ * @param book 本の構造体へのポインタ
+ * @return 完了している場合はtrue
+ */
+bool epd_book_is_layout_complete(EPDBook *book);
+
+/**
+ * @brief 指定したページが表示できるようになるまで待つ
+ * @param book 本の構造体へのポインタ
+ * @param page ページ番号（0から）
+ * @param timeout_ms 最大待ち時間（ミリ秒）
+ * @return 表示できる場合はtrue
+ */
+bool epd_book_wait_for_page(EPDBook *book, int page, uint32_t timeout_ms);
+
+/**
+ * @brief ページを描画する
+ * @param book 本の構造体へのポインタ
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param page ページ番号（0から）
+ * @return 描画した行数。ページがまだ索引されていない場合などは-1
+ *
+ * 描画領域のクリアと画面更新は呼び出し側で行ってください。
+ */
+int epd_book_render_page(EPDBook *book, EPDWrapper *wrapper, int page);
+
+#endif // EPD_BOOK_H
@@ -0,0 +1,220 @@
+/**
+ * @file epd_diff.c
+ * @brief フレームバッファの差分から更新矩形を求める
+ */
+
+#include <string.h>
+#include "esp_log.h"
+#include "epd_diff.h"
+
+static const char *TAG = "epd_diff";
+
+#define DIFF_ROW_BYTES (EPD_DISPLAY_WIDTH / 2)
+#define DIFF_ROW_WORDS (DIFF_ROW_BYTES / 4)
+#define DIFF_GAP_WORDS (EPD_DIFF_COLUMN_GAP / 8)
+
+/**
+ * @brief 2つの矩形の和（外接矩形）を求める
+ */
+static EpdRect rect_union(EpdRect a, EpdRect b)
+{
+    int x0 = a.x < b.x ? a.x : b.x;
+    int y0 = a.y < b.y ? a.y : b.y;
+    int x1 = (a.x + a.width) > (b.x + b.width) ? (a.x + a.width) : (b.x + b.width);
+    int y1 = (a.y + a.height) > (b.y + b.height) ? (a.y + a.height) : (b.y + b.height);
+
+    EpdRect result = {
+        .x = x0,
+        .y = y0,
+        .width = x1 - x0,
+        .height = y1 - y0};
+    return result;
+}
+
+static inline long rect_area(EpdRect r)
+{
+    return (long)r.width * r.height;
+}
+
+/**
+ * @brief 統合による面積の増加が最も小さい矩形の組を探す
+ * @return 増加量（矩形が2つ未満の場合は-1）
+ */
+static long find_closest_pair(const EpdRect *rects, int count, int *best_i, int *best_j)
+{
+    long best_growth = -1;
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = i + 1; j < count; j++)
+        {
+            long growth = rect_area(rect_union(rects[i], rects[j])) - rect_area(rects[i]) - rect_area(rects[j]);
+            if (best_growth < 0 || growth < best_growth)
+            {
+                best_growth = growth;
+                *best_i = i;
+                *best_j = j;
+            }
+        }
+    }
+    return best_growth;
+}
+
+/**
+ * @brief 矩形jを矩形iに統合して取り除く
+ */
+static void merge_pair(EpdRect *rects, int *count, int i, int j)
+{
+    rects[i] = rect_union(rects[i], rects[j]);
+    rects[j] = rects[--(*count)];
+}
+
+/**
+ * @brief 1行分の変化区間を、直前の行まで続いている矩形に追加する
+ *
+ * 直前の行（またはこの行の別の区間で既に広げた矩形）と横方向に近接していれば下に広げ、
+ * なければ新しい矩形を作ります。作業用の矩形が一杯の場合は最も近い組を統合して空けます。
+ */
+static void add_segment(EpdRect *work, int *count, int x0, int x1, int y)
+{
+    EpdRect segment = {.x = x0, .y = y, .width = x1 - x0, .height = 1};
+
+    int target = -1;
+    for (int i = 0; i < *count; i++)
+    {
+        EpdRect r = work[i];
+        int bottom = r.y + r.height;
+        if ((bottom == y || bottom == y + 1) &&
+            x0 < r.x + r.width + EPD_DIFF_COLUMN_GAP && r.x < x1 + EPD_DIFF_COLUMN_GAP)
+        {
+            if (target < 0)
+            {
+                work[i] = rect_union(r, segment);
+                target = i;
+            }
+            else
+            {
+                // 区間が2つの矩形をつないだ場合は1つにまとめる
+                merge_pair(work, count, target, i);
+                i--;
+            }
+        }
+    }
+    if (target >= 0)
+    {
+        return;
+    }
+
+    if (*count >= EPD_DIFF_WORK_RECTS)
+    {
+        int i = 0, j = 1;
+        find_closest_pair(work, *count, &i, &j);
+        merge_pair(work, count, i, j);
+    }
+    work[(*count)++] = segment;
+}
+
+int epd_diff_framebuffers(const uint8_t *current, const uint8_t *previous,
+                          EpdRect *rects, int max_rects)
+{
+    if (current == NULL || previous == NULL || rects == NULL || max_rects <= 0)
+    {
+        return 0;
+    }
+
+    EpdRect work[EPD_DIFF_WORK_RECTS];
+    int count = 0;
+
+    for (int y = 0; y < EPD_DISPLAY_HEIGHT; y++)
+    {
+        const uint8_t *cur_row = current + y * DIFF_ROW_BYTES;
+        const uint8_t *prev_row = previous + y * DIFF_ROW_BYTES;
+        if (memcmp(cur_row, prev_row, DIFF_ROW_BYTES) == 0)
+        {
+            continue;
+        }
+
+        const uint32_t *a = (const uint32_t *)cur_row;
+        const uint32_t *b = (const uint32_t *)prev_row;
+        int i = 0;
+        while (i < DIFF_ROW_WORDS)
+        {
+            if (a[i] == b[i])
+            {
+                i++;
+                continue;
+            }
+
+            // EPD_DIFF_COLUMN_GAP 未満の一致は区間に含める
+            int first = i;
+            int last = i;
+            for (i++; i < DIFF_ROW_WORDS && i - last <= DIFF_GAP_WORDS; i++)
+            {
+                if (a[i] != b[i])
+                {
+                    last = i;
+                }
+            }
+
+            // 両端の語の中で変化した最初と最後のピクセル（偶数ピクセルが下位ビット側）
+            uint32_t first_diff = a[first] ^ b[first];
+            uint32_t last_diff = a[last] ^ b[last];
+            int x0 = first * 8 + __builtin_ctz(first_diff) / 4;
+            int x1 = last * 8 + (31 - __builtin_clz(last_diff)) / 4 + 1;
+            add_segment(work, &count, x0, x1, y);
+        }
+    }
+
+    // 面積の増加が許容範囲の組と、上限を超えた分を統合する
+    while (count > 1)
+    {
+        int i = 0, j = 1;
+        find_closest_pair(work, count, &i, &j);
+        long merged_area = rect_area(rect_union(work[i], work[j]));
+        long separate_area = rect_area(work[i]) + rect_area(work[j]);
+        if (count <= max_rects && merged_area * 100 > separate_area * (100 + EPD_DIFF_AREA_OVERHEAD_PERCENT))
+        {
+            break;
+        }
+        merge_pair(work, &count, i, j);
+    }
+
+    memcpy(rects, work, sizeof(EpdRect) * count);
+    return count;
+}
+
+int epd_diff_changed_rects(EPDWrapper *wrapper, EpdRect *rects, int max_rects)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not initialized");
+        return 0;
+    }
+
+    if (!wrapper->is_async)
+    {
+        return epd_diff_framebuffers(wrapper->framebuffer, wrapper->hl_state.back_fb, rects, max_rects);
+    }
+
+    // 非同期更新中は、要求済みの内容を保持している staging_fb と比較する
+    xSemaphoreTake(wrapper->fb_lock, portMAX_DELAY);
+    int count = epd_diff_framebuffers(wrapper->framebuffer, wrapper->staging_fb, rects, max_rects);
+    xSemaphoreGive(wrapper->fb_lock);
+    return count;
+}
+
+int epd_diff_update(EPDWrapper *wrapper, enum EpdDrawMode mode)
+{
+    EpdRect rects[EPD_DIFF_MAX_RECTS];
+    int count = epd_diff_changed_rects(wrapper, rects, EPD_DIFF_MAX_RECTS);
+    for (int i = 0; i < count; i++)
+    {
+        epd_wrapper_update_area(wrapper, rects[i], mode);
+    }
+    epd_wrapper_clear_dirty(wrapper);
+
+    if (count > 0)
+    {
+        ESP_LOGI(TAG, "Updated %d changed area(s) with mode %d", count, mode);
+    }
+    return count;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file epd_diff.h
+ * @brief フレームバッファの差分から更新矩形を求める
+ *
+ * 描画済みの内容と、最後にパネルへ送った内容（同期更新時はepdiyの表示中バッファ、
+ * 非同期更新時は staging_fb）を32ビット単位で比較し、変化した領域を少数の矩形にまとめます。
+ * 画面全体を描き直すアプリケーションでも、変化した部分だけを部分更新できます。
+ */
+
+#ifndef EPD_DIFF_H
+#define EPD_DIFF_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "epd_wrapper.h"
+
+/**
+ * @brief 出力する矩形の最大数のデフォルト値
+ */
+#ifndef EPD_DIFF_MAX_RECTS
+#define EPD_DIFF_MAX_RECTS EPD_WRAPPER_MAX_DIRTY_RECTS
+#endif
+
+/**
+ * @brief 矩形を統合してよい面積の増加率（%）
+ *
+ * 2つの矩形の外接矩形の面積が、元の面積の合計のこの割合以内であれば統合します。
+ * 矩形の数が上限を超える場合は、増加率に関係なく増加が最も小さい組から統合します。
+ */
+#ifndef EPD_DIFF_AREA_OVERHEAD_PERCENT
+#define EPD_DIFF_AREA_OVERHEAD_PERCENT 25
+#endif
+
+/**
+ * @brief 同じ行の中で変化を別の区間に分ける最小の間隔（ピクセル、8の倍数）
+ */
+#ifndef EPD_DIFF_COLUMN_GAP
+#define EPD_DIFF_COLUMN_GAP 64
+#endif
+
+/**
+ * @brief 作業用に保持する矩形の数
+ */
+#ifndef EPD_DIFF_WORK_RECTS
+#define EPD_DIFF_WORK_RECTS 32
+#endif
+
+/**
+ * @brief 2つのフレームバッファの差分を矩形にまとめる
+ * @param current 新しい内容（960x540、4ビット/ピクセル、4バイト境界に配置）
+ * @param previous 比較対象の内容（同上）
+ * @param rects 矩形の格納先（フレームバッファ座標系、回転なし）
+ * @param max_rects 格納できる矩形の数
+ * @return 変化した領域を覆う矩形の数（変化がなければ0）
+ *
+ * 行ごとに比較し、同じ内容の行は memcmp で読み飛ばします。
+ */
+int epd_diff_framebuffers(const uint8_t *current, const uint8_t *previous,
+                          EpdRect *rects, int max_rects);
+
+/**
+ * @brief 最後にパネルへ送った内容からの変化を矩形にまとめる
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param rects 矩形の格納先（フレームバッファ座標系、回転なし）
+ * @param max_rects 格納できる矩形の数
+ * @return 矩形の数（変化がなければ0）
+ */
+int epd_diff_changed_rects(EPDWrapper *wrapper, EpdRect *rects, int max_rects);
+
+/**
+ * @brief 変化した領域だけをディスプレイに反映する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param mode 更新モード（例：MODE_DU、EPD_WRAPPER_MODE_AUTO）
+ * @return 更新した矩形の数（変化がなければ0）
+ *
+ * 最大 EPD_DIFF_MAX_RECTS 個の矩形を epd_wrapper_update_area() で更新し、
+ * 記録済みのダーティ矩形をクリアします。
+ */
+int epd_diff_update(EPDWrapper *wrapper, enum EpdDrawMode mode);
+
+#endif // EPD_DIFF_H
@@ -0,0 +1,265 @@
+/**
+ * @file epd_font_blob.c
+ * @brief 実行時に読み込むバイナリ形式のフォントの実装
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#if !CONFIG_IDF_TARGET_LINUX
+#include "esp_partition.h"
+#endif
+
+#include "epd_font_blob.h"
+#include "epd_glyph_cache.h"
+
+static const char *TAG = "epd_font_blob";
+
+// 文字情報はファイルの内容をそのまま FontCharInfo として参照するため、並びを固定する
+_Static_assert(sizeof(EPDFontBlobHeader) == 48, "EPDFontBlobHeader must be 48 bytes");
+_Static_assert(sizeof(FontCharInfo) == 16, "FontCharInfo layout must match the font file");
+_Static_assert(offsetof(FontCharInfo, data_offset) == 4 && offsetof(FontCharInfo, img_width) == 8 &&
+                   offsetof(FontCharInfo, y_offset) == 13,
+               "FontCharInfo layout must match the font file");
+
+/**
+ * @brief ヘッダだけを検査する
+ * @return 正しいヘッダであればtrue
+ */
+static bool check_header(const EPDFontBlobHeader *header)
+{
+    if (memcmp(header->magic, EPD_FONT_BLOB_MAGIC, 4) != 0)
+    {
+        return false;
+    }
+    if (header->version != EPD_FONT_BLOB_VERSION || header->header_size < sizeof(EPDFontBlobHeader))
+    {
+        ESP_LOGE(TAG, "Unsupported font version %u (header %u bytes)", header->version, header->header_size);
+        return false;
+    }
+    if (header->total_size < header->header_size || header->total_size % 4 != 0)
+    {
+        ESP_LOGE(TAG, "Invalid font size %lu", (unsigned long)header->total_size);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief フォント全体を検査し、FontInfo を組み立てる
+ */
+static bool open_blob(EPDFontBlob *blob, const uint8_t *data, size_t size)
+{
+    const EPDFontBlobHeader *header = (const EPDFontBlobHeader *)data;
+    if (size < sizeof(EPDFontBlobHeader) || !check_header(header) || header->total_size > size)
+    {
+        ESP_LOGE(TAG, "Not a font file");
+        return false;
+    }
+
+    // 各領域がファイルに収まっているか
+    uint64_t chars_end = header->chars_offset + (uint64_t)header->chars_count * sizeof(FontCharInfo);
+    uint64_t bitmap_end = header->bitmap_offset + (uint64_t)header->bitmap_size;
+    if (header->chars_offset % 4 != 0 || header->chars_count == 0 || header->chars_count > UINT16_MAX ||
+        chars_end > header->total_size || bitmap_end > header->total_size ||
+        memchr(header->style, '\0', EPD_FONT_BLOB_STYLE_SIZE) == NULL)
+    {
+        ESP_LOGE(TAG, "Corrupted font header");
+        return false;
+    }
+    if (header->encoding != EPD_FONT_ENCODING_RAW && header->encoding != EPD_FONT_ENCODING_RLE)
+    {
+        ESP_LOGE(TAG, "Unsupported glyph encoding %u", header->encoding);
+        return false;
+    }
+    if (header->encoding == EPD_FONT_ENCODING_RLE &&
+        ((header->run_orders >> 4) > EPD_FONT_MAX_RUN_ORDER ||
+         (header->run_orders & 0x0F) > EPD_FONT_MAX_RUN_ORDER))
+    {
+        ESP_LOGE(TAG, "Unsupported run orders 0x%02X", header->run_orders);
+        return false;
+    }
+
+    const FontCharInfo *chars = (const FontCharInfo *)(data + header->chars_offset);
+    FontInfo info = {
+        .size = header->size,
+        .max_width = header->max_width,
+        .max_height = header->max_height,
+        .baseline = header->baseline,
+        .style = header->style,
+        .chars_count = (uint16_t)header->chars_count,
+        .chars = chars,
+        .bitmap_data = data + header->bitmap_offset,
+        .encoding = header->encoding,
+        .run_orders = header->run_orders,
+    };
+
+    // 壊れたファイルで範囲外を読まないよう、グリフのデータとコードポイントの順序を確かめる
+    for (uint32_t i = 0; i < header->chars_count; i++)
+    {
+        if (chars[i].data_offset > header->bitmap_size ||
+            !epd_text_check_glyph_data(&info, &chars[i], header->bitmap_size - chars[i].data_offset) ||
+            (i > 0 && chars[i].code_point <= chars[i - 1].code_point))
+        {
+            ESP_LOGE(TAG, "Corrupted glyph U+%04lX", (unsigned long)chars[i].code_point);
+            return false;
+        }
+    }
+
+    blob->data = data;
+    blob->size = header->total_size;
+    blob->info = info;
+
+    if (!epd_text_register_font(&blob->info))
+    {
+        ESP_LOGW(TAG, "Font index unavailable, glyphs will be searched");
+    }
+    ESP_LOGI(TAG, "Font opened: %upx %s, %lu glyphs, %lu bytes%s", header->size, header->style,
+             (unsigned long)header->chars_count, (unsigned long)header->total_size,
+             header->encoding == EPD_FONT_ENCODING_RLE ? " (compressed)" : "");
+    return true;
+}
+
+bool epd_font_blob_open_memory(EPDFontBlob *blob, const void *data, size_t size)
+{
+    if (blob == NULL || data == NULL || ((uintptr_t)data % 4) != 0)
+    {
+        ESP_LOGE(TAG, "Invalid font data");
+        return false;
+    }
+    memset(blob, 0, sizeof(EPDFontBlob));
+    return open_blob(blob, data, size);
+}
+
+bool epd_font_blob_open_partition(EPDFontBlob *blob, const char *label, int index)
+{
+    if (blob == NULL || index < 0)
+    {
+        return false;
+    }
+    memset(blob, 0, sizeof(EPDFontBlob));
+    if (label == NULL)
+    {
+        label = EPD_FONT_BLOB_PARTITION_LABEL;
+    }
+
+#if CONFIG_IDF_TARGET_LINUX
+    ESP_LOGW(TAG, "Font partition '%s' is not available on the host", label);
+    return false;
+#else
+    const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                                ESP_PARTITION_SUBTYPE_ANY, label);
+    if (partition == NULL)
+    {
+        ESP_LOGW(TAG, "Font partition '%s' not found", label);
+        return false;
+    }
+
+    // 連結されたフォントのヘッダをたどって目的のフォントの位置を求める
+    EPDFontBlobHeader header;
+    size_t offset = 0;
+    for (int i = 0;; i++)
+    {
+        if (offset + sizeof(header) > partition->size ||
+            esp_partition_read(partition, offset, &header, sizeof(header)) != ESP_OK ||
+            !check_header(&header) || offset + header.total_size > partition->size)
+        {
+            ESP_LOGW(TAG, "Font %d not found in partition '%s'", index, label);
+            return false;
+        }
+        if (i == index)
+        {
+            break;
+        }
+        offset += header.total_size;
+    }
+
+    const void *mapped;
+    esp_partition_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(partition, offset, header.total_size, ESP_PARTITION_MMAP_DATA,
+                                       &mapped, &handle);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to map font: %s", esp_err_to_name(err));
+        return false;
+    }
+    if (!open_blob(blob, mapped, header.total_size))
+    {
+        esp_partition_munmap(handle);
+        return false;
+    }
+    blob->mapped = true;
+    blob->mmap_handle = handle;
+    return true;
+#endif
+}
+
+bool epd_font_blob_open_file(EPDFontBlob *blob, const char *path)
+{
+    if (blob == NULL || path == NULL)
+    {
+        return false;
+    }
+    memset(blob, 0, sizeof(EPDFontBlob));
+
+    FILE *f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to open %s", path);
+        return false;
+    }
+
+    EPDFontBlobHeader header;
+    if (fread(&header, 1, sizeof(header), f) != sizeof(header) || !check_header(&header))
+    {
+        ESP_LOGE(TAG, "%s is not a font file", path);
+        fclose(f);
+        return false;
+    }
+
+    // SDカードは割り当てられないため、全体をPSRAMに読み込む
+    uint8_t *buffer = heap_caps_malloc(header.total_size, MALLOC_CAP_SPIRAM);
+    if (buffer == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate %lu bytes for %s", (unsigned long)header.total_size, path);
+        fclose(f);
+        return false;
+    }
+    memcpy(buffer, &header, sizeof(header));
+    size_t rest = header.total_size - sizeof(header);
+    size_t n = fread(buffer + sizeof(header), 1, rest, f);
+    fclose(f);
+
+    if (n != rest || !open_blob(blob, buffer, header.total_size))
+    {
+        ESP_LOGE(TAG, "Failed to read font from %s", path);
+        heap_caps_free(buffer);
+        memset(blob, 0, sizeof(EPDFontBlob));
+        return false;
+    }
+    blob->buffer = buffer;
+    return true;
+}
+
+void epd_font_blob_close(EPDFontBlob *blob)
+{
+    if (blob == NULL || blob->data == NULL)
+    {
+        return;
+    }
+
+    // 同じアドレスに別のフォントを開いたときに古いグリフを使わないよう、キャッシュも捨てる
+    epd_text_unregister_font(&blob->info);
+    epd_glyph_cache_clear();
+
+#if !CONFIG_IDF_TARGET_LINUX
+    if (blob->mapped)
+    {
+        esp_partition_munmap(blob->mmap_handle);
+    }
+#endif
+    heap_caps_free(blob->buffer);
+    memset(blob, 0, sizeof(EPDFontBlob));
+}
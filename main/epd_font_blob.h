@@ -0,0 +1,109 @@
+/**
+ * @file epd_font_blob.h
+ * @brief 実行時に読み込むバイナリ形式のフォント
+ *
+ * f2d.py --binary で生成したフォントファイル（ヘッダ・文字情報・ビットマップを1つにまとめたもの）を、
+ * コンパイルせずに epd_text で使えるようにします。フラッシュのフォント用パーティションに
+ * 書き込んだフォントは esp_partition_mmap() で割り当てて直接参照するため、RAMにコピーしません。
+ * SDカード上のファイルはPSRAMに読み込んで使います。
+ *
+ * 形式（リトルエンディアン）:
+ *   - ヘッダ（EPDFontBlobHeader、48バイト）
+ *   - 文字情報（FontCharInfo と同じ16バイトの要素をコードポイント順に並べたもの、4バイト境界）
+ *   - ビットマップ（FontInfo.bitmap_data と同じ。encoding に応じて非圧縮または圧縮）
+ * ファイル全体の大きさは4バイト単位なので、複数のフォントを連結して1つのパーティションに書き込めます。
+ */
+
+#ifndef EPD_FONT_BLOB_H
+#define EPD_FONT_BLOB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "epd_text.h"
+
+/**
+ * @brief フォント用パーティションのラベル（partitions.csv）
+ */
+#ifndef EPD_FONT_BLOB_PARTITION_LABEL
+#define EPD_FONT_BLOB_PARTITION_LABEL "fonts"
+#endif
+
+#define EPD_FONT_BLOB_MAGIC "EPDF"   // ファイル先頭の識別子
+#define EPD_FONT_BLOB_VERSION 1      // 対応する形式のバージョン
+#define EPD_FONT_BLOB_STYLE_SIZE 12  // スタイル名の領域（終端のヌル文字を含む）
+
+/**
+ * @brief フォントファイルのヘッダ
+ */
+typedef struct
+{
+    char magic[4];                          // "EPDF"
+    uint16_t version;                       // 形式のバージョン
+    uint16_t header_size;                   // ヘッダの大きさ（バイト）
+    uint8_t size;                           // フォントの基本サイズ
+    uint8_t max_width;                      // 最大の文字幅
+    uint8_t max_height;                     // 最大の文字高さ
+    uint8_t encoding;                       // ビットマップの形式（EPD_FONT_ENCODING_*）
+    uint16_t baseline;                      // ベースラインの位置
+    uint8_t run_orders;                     // 圧縮時の符号の次数（FontInfo.run_orders）
+    uint8_t reserved1;                      // 予約（0）
+    uint32_t chars_count;                   // 収録文字数
+    uint32_t chars_offset;                  // 文字情報の位置（ファイル先頭から）
+    uint32_t bitmap_offset;                 // ビットマップの位置（ファイル先頭から）
+    uint32_t bitmap_size;                   // ビットマップの大きさ（バイト）
+    uint32_t total_size;                    // ファイル全体の大きさ（4バイト単位）
+    char style[EPD_FONT_BLOB_STYLE_SIZE];   // フォントスタイル（ヌル文字終端）
+} EPDFontBlobHeader;
+
+/**
+ * @brief 読み込んだフォント
+ */
+typedef struct
+{
+    FontInfo info;           // epd_text に渡すフォント情報（ファイルの内容を直接参照する）
+    const uint8_t *data;     // ファイルの先頭
+    size_t size;             // ファイルの大きさ
+    bool mapped;             // パーティションを割り当てているかどうか
+    uint32_t mmap_handle;    // パーティションを割り当てた場合のハンドル（esp_partition_mmap_handle_t）
+    uint8_t *buffer;         // ファイルから読み込んだ場合のバッファ（PSRAM）
+} EPDFontBlob;
+
+/**
+ * @brief メモリ上のフォントを開く
+ * @param blob 開いたフォントの格納先
+ * @param data フォントファイルの内容（4バイト境界。閉じるまで解放しないこと）
+ * @param size 内容の大きさ
+ * @return 形式が正しく、開けた場合はtrue
+ *
+ * コピーせずに data を参照します。開いたフォントは epd_text_register_font() で登録されます。
+ */
+bool epd_font_blob_open_memory(EPDFontBlob *blob, const void *data, size_t size);
+
+/**
+ * @brief フォント用パーティションのフォントを割り当てて開く
+ * @param blob 開いたフォントの格納先
+ * @param label パーティションのラベル（NULLの場合は EPD_FONT_BLOB_PARTITION_LABEL）
+ * @param index パーティションに連結したフォントの番号（先頭が0）
+ * @return 開けた場合はtrue
+ */
+bool epd_font_blob_open_partition(EPDFontBlob *blob, const char *label, int index);
+
+/**
+ * @brief ファイル（SDカードなど）のフォントをPSRAMに読み込んで開く
+ * @param blob 開いたフォントの格納先
+ * @param path ファイルのパス
+ * @return 開けた場合はtrue
+ */
+bool epd_font_blob_open_file(EPDFontBlob *blob, const char *path);
+
+/**
+ * @brief フォントを閉じる
+ * @param blob 閉じるフォント
+ *
+ * 索引とグリフキャッシュを破棄してから、割り当てやバッファを解放します。
+ * 閉じた後は blob->info を使わないでください。
+ */
+void epd_font_blob_close(EPDFontBlob *blob);
+
+#endif // EPD_FONT_BLOB_H
@@ -0,0 +1,389 @@
+/**
+ * @file epd_glyph_cache.c
+ * @brief 描画済みグリフ（4ビット/ピクセル）のキャッシュの実装
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+#include "epd_glyph_cache.h"
+
+static const char *TAG = "epd_glyph_cache";
+
+// 1エントリあたりの平均サイズの見積もり（ハッシュテーブルのサイズ決定用）
+#define GLYPH_CACHE_BYTES_PER_BUCKET 256
+#define GLYPH_CACHE_MIN_BUCKETS 64
+
+/**
+ * @brief キャッシュエントリ
+ *
+ * ヘッダーと画像データは1回の確保でまとめてPSRAMに置きます。
+ */
+typedef struct GlyphCacheEntry
+{
+    EPDGlyphCacheKey key;
+    uint32_t hash;
+    struct GlyphCacheEntry *hash_next; // 同じバケット内の次のエントリ
+    struct GlyphCacheEntry *lru_prev;  // より最近使われたエントリ
+    struct GlyphCacheEntry *lru_next;  // より古いエントリ
+    size_t size;                       // このエントリが使用しているバイト数
+    EPDGlyphBitmap bitmap;
+    uint8_t data[];
+} GlyphCacheEntry;
+
+/**
+ * @brief キャッシュ全体の状態
+ */
+typedef struct
+{
+    bool is_initialized;
+    GlyphCacheEntry **buckets; // ハッシュテーブル
+    uint32_t bucket_mask;      // バケット数 - 1（バケット数は2のべき乗）
+    GlyphCacheEntry *lru_head; // 最も最近使われたエントリ
+    GlyphCacheEntry *lru_tail; // 最も古いエントリ
+    EPDGlyphCacheStats stats;
+} GlyphCache;
+
+static GlyphCache s_cache;
+
+/**
+ * @brief キャッシュのロックを返す（最初の呼び出しで作成する）
+ *
+ * 初期化前や初期化のやり直し中にも使うため、キャッシュの状態とは別に保持します。
+ */
+static SemaphoreHandle_t get_cache_lock(void)
+{
+    static SemaphoreHandle_t cache_lock = NULL;
+    SemaphoreHandle_t lock = __atomic_load_n(&cache_lock, __ATOMIC_ACQUIRE);
+    if (lock == NULL)
+    {
+        SemaphoreHandle_t created = xSemaphoreCreateMutex();
+        if (created == NULL)
+        {
+            return NULL;
+        }
+        if (__atomic_compare_exchange_n(&cache_lock, &lock, created, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        {
+            lock = created;
+        }
+        else
+        {
+            vSemaphoreDelete(created);
+        }
+    }
+    return lock;
+}
+
+/**
+ * @brief 背景透過時はbg_colorを無視するようにキーを正規化する
+ */
+static EPDGlyphCacheKey normalize_key(const EPDGlyphCacheKey *key)
+{
+    EPDGlyphCacheKey k = *key;
+    k.text_color &= 0x0F;
+    k.bg_color = k.bg_transparent ? 0 : (k.bg_color & 0x0F);
+    k.rotation &= 0x03;
+    return k;
+}
+
+static uint32_t hash_key(const EPDGlyphCacheKey *key)
+{
+    uint32_t h = 2166136261u;
+    uint32_t parts[3] = {
+        (uint32_t)(uintptr_t)key->font,
+        key->code_point,
+        (uint32_t)key->rotation | ((uint32_t)key->text_color << 2) | ((uint32_t)key->bg_color << 6) |
+            ((uint32_t)key->bg_transparent << 10) | ((uint32_t)key->bold << 11),
+    };
+    for (int i = 0; i < 3; i++)
+    {
+        h = (h ^ parts[i]) * 16777619u;
+        h ^= h >> 15;
+    }
+    return h;
+}
+
+static bool key_equals(const EPDGlyphCacheKey *a, const EPDGlyphCacheKey *b)
+{
+    return a->font == b->font && a->code_point == b->code_point &&
+           a->rotation == b->rotation && a->text_color == b->text_color &&
+           a->bg_color == b->bg_color && a->bg_transparent == b->bg_transparent &&
+           a->bold == b->bold;
+}
+
+static void lru_unlink(GlyphCacheEntry *entry)
+{
+    if (entry->lru_prev)
+        entry->lru_prev->lru_next = entry->lru_next;
+    else
+        s_cache.lru_head = entry->lru_next;
+
+    if (entry->lru_next)
+        entry->lru_next->lru_prev = entry->lru_prev;
+    else
+        s_cache.lru_tail = entry->lru_prev;
+
+    entry->lru_prev = NULL;
+    entry->lru_next = NULL;
+}
+
+static void lru_push_front(GlyphCacheEntry *entry)
+{
+    entry->lru_prev = NULL;
+    entry->lru_next = s_cache.lru_head;
+    if (s_cache.lru_head)
+        s_cache.lru_head->lru_prev = entry;
+    s_cache.lru_head = entry;
+    if (s_cache.lru_tail == NULL)
+        s_cache.lru_tail = entry;
+}
+
+/**
+ * @brief エントリをハッシュテーブルとLRUリストから外して解放する
+ */
+static void remove_entry(GlyphCacheEntry *entry)
+{
+    GlyphCacheEntry **link = &s_cache.buckets[entry->hash & s_cache.bucket_mask];
+    while (*link != NULL && *link != entry)
+    {
+        link = &(*link)->hash_next;
+    }
+    if (*link == entry)
+    {
+        *link = entry->hash_next;
+    }
+
+    lru_unlink(entry);
+    s_cache.stats.bytes_used -= entry->size;
+    s_cache.stats.entries--;
+    heap_caps_free(entry);
+}
+
+/**
+ * @brief すべてのエントリとハッシュテーブルを解放する（ロックしたまま呼び出す）
+ */
+static void release_cache(void)
+{
+    while (s_cache.lru_tail != NULL)
+    {
+        remove_entry(s_cache.lru_tail);
+    }
+    free(s_cache.buckets);
+    memset(&s_cache, 0, sizeof(s_cache));
+}
+
+bool epd_glyph_cache_init(size_t budget)
+{
+    if (!epd_glyph_cache_lock())
+    {
+        ESP_LOGE(TAG, "Failed to create glyph cache lock");
+        return false;
+    }
+
+    release_cache();
+    s_cache.stats.budget = budget;
+
+    if (budget == 0)
+    {
+        epd_glyph_cache_unlock();
+        ESP_LOGI(TAG, "Glyph cache disabled");
+        return true;
+    }
+
+    // 想定エントリ数以上の2のべき乗をバケット数にする
+    uint32_t bucket_count = GLYPH_CACHE_MIN_BUCKETS;
+    while (bucket_count < budget / GLYPH_CACHE_BYTES_PER_BUCKET)
+    {
+        bucket_count <<= 1;
+    }
+
+    s_cache.buckets = calloc(bucket_count, sizeof(GlyphCacheEntry *));
+    if (s_cache.buckets == NULL)
+    {
+        epd_glyph_cache_unlock();
+        ESP_LOGE(TAG, "Failed to allocate glyph cache hash table");
+        return false;
+    }
+    s_cache.bucket_mask = bucket_count - 1;
+    s_cache.is_initialized = true;
+    epd_glyph_cache_unlock();
+
+    ESP_LOGI(TAG, "Glyph cache initialized: budget %u bytes, %lu buckets",
+             (unsigned)budget, (unsigned long)bucket_count);
+    return true;
+}
+
+void epd_glyph_cache_deinit(void)
+{
+    if (!epd_glyph_cache_lock())
+    {
+        return;
+    }
+    release_cache();
+    epd_glyph_cache_unlock();
+}
+
+bool epd_glyph_cache_is_enabled(void)
+{
+    return s_cache.is_initialized && s_cache.stats.budget > 0;
+}
+
+void epd_glyph_cache_clear(void)
+{
+    if (!epd_glyph_cache_lock())
+    {
+        return;
+    }
+    while (s_cache.lru_tail != NULL)
+    {
+        remove_entry(s_cache.lru_tail);
+    }
+    epd_glyph_cache_unlock();
+}
+
+bool epd_glyph_cache_lock(void)
+{
+    SemaphoreHandle_t lock = get_cache_lock();
+    if (lock == NULL)
+    {
+        return false;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    return true;
+}
+
+void epd_glyph_cache_unlock(void)
+{
+    xSemaphoreGive(get_cache_lock());
+}
+
+const EPDGlyphBitmap *epd_glyph_cache_lookup(const EPDGlyphCacheKey *key)
+{
+    if (!epd_glyph_cache_is_enabled() || key == NULL)
+    {
+        return NULL;
+    }
+
+    EPDGlyphCacheKey k = normalize_key(key);
+    uint32_t hash = hash_key(&k);
+
+    for (GlyphCacheEntry *entry = s_cache.buckets[hash & s_cache.bucket_mask];
+         entry != NULL; entry = entry->hash_next)
+    {
+        if (entry->hash == hash && key_equals(&entry->key, &k))
+        {
+            // 最近使用したエントリとして先頭に移動
+            if (s_cache.lru_head != entry)
+            {
+                lru_unlink(entry);
+                lru_push_front(entry);
+            }
+            s_cache.stats.hits++;
+            return &entry->bitmap;
+        }
+    }
+
+    s_cache.stats.misses++;
+    return NULL;
+}
+
+EPDGlyphBitmap *epd_glyph_cache_insert(const EPDGlyphCacheKey *key, int width, int height)
+{
+    if (!epd_glyph_cache_is_enabled() || key == NULL || width <= 0 || height <= 0)
+    {
+        return NULL;
+    }
+
+    EPDGlyphCacheKey k = normalize_key(key);
+    int stride = (width + 1) / 2;
+    size_t size = sizeof(GlyphCacheEntry) + (size_t)stride * height;
+    if (size > s_cache.stats.budget)
+    {
+        return NULL;
+    }
+
+    // 容量に収まるまで古いエントリを破棄
+    while (s_cache.stats.bytes_used + size > s_cache.stats.budget && s_cache.lru_tail != NULL)
+    {
+        remove_entry(s_cache.lru_tail);
+        s_cache.stats.evictions++;
+    }
+
+    GlyphCacheEntry *entry = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (entry == NULL)
+    {
+        ESP_LOGW(TAG, "Failed to allocate glyph cache entry (%u bytes)", (unsigned)size);
+        return NULL;
+    }
+
+    entry->key = k;
+    entry->hash = hash_key(&k);
+    entry->size = size;
+    entry->bitmap.width = width;
+    entry->bitmap.height = height;
+    entry->bitmap.stride = stride;
+    entry->bitmap.transparent = k.bg_transparent;
+    // 透過色は文字色と必ず異なる値にする
+    entry->bitmap.transparent_color = k.bg_transparent ? (k.text_color ^ 0x0F) : 0;
+    entry->bitmap.data = entry->data;
+
+    // 背景色（または透過色）で塗りつぶしておく
+    uint8_t fill = k.bg_transparent ? entry->bitmap.transparent_color : k.bg_color;
+    memset(entry->data, fill * 0x11, (size_t)stride * height);
+
+    GlyphCacheEntry **bucket = &s_cache.buckets[entry->hash & s_cache.bucket_mask];
+    entry->hash_next = *bucket;
+    *bucket = entry;
+    lru_push_front(entry);
+
+    s_cache.stats.bytes_used += size;
+    s_cache.stats.entries++;
+    return &entry->bitmap;
+}
+
+void epd_glyph_cache_blit(EPDWrapper *wrapper, int x, int y, const EPDGlyphBitmap *glyph)
+{
+    if (wrapper == NULL || glyph == NULL)
+    {
+        return;
+    }
+
+    // クリップ矩形の外側なら何もしない
+    EpdRect visible = {.x = x, .y = y, .width = glyph->width, .height = glyph->height};
+    if (!epd_wrapper_clip_rect(wrapper, &visible))
+    {
+        return;
+    }
+
+    // 見える範囲を先に記録しておけば、行ごとの記録は包含判定だけで済む
+    epd_wrapper_mark_dirty(wrapper, visible.x, visible.y, visible.width, visible.height);
+
+    const uint8_t *row = glyph->data + (visible.y - y) * glyph->stride;
+    for (int i = visible.y - y; i < visible.y - y + visible.height; i++)
+    {
+        if (glyph->transparent)
+        {
+            epd_wrapper_blit_span_transparent(wrapper, x, y + i, row, 0, glyph->width,
+                                              glyph->transparent_color);
+        }
+        else
+        {
+            epd_wrapper_blit_span(wrapper, x, y + i, row, 0, glyph->width);
+        }
+        row += glyph->stride;
+    }
+}
+
+void epd_glyph_cache_get_stats(EPDGlyphCacheStats *stats)
+{
+    if (stats == NULL || !epd_glyph_cache_lock())
+    {
+        return;
+    }
+    *stats = s_cache.stats;
+    epd_glyph_cache_unlock();
+}
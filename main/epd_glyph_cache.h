@@ -0,0 +1,147 @@
+/**
+ * @file epd_glyph_cache.h
+ * @brief 描画済みグリフ（4ビット/ピクセル）のキャッシュ
+ *
+ * 1ビット/ピクセルのフォントビットマップを回転・色付けした結果を
+ * PSRAM上に保持し、次回以降は行単位のコピーだけで描画できるようにします。
+ * 使用量が上限を超えた場合は、最も長く使われていないグリフから破棄します（LRU）。
+ * キャッシュは複数のタスクで共有されるため、検索・登録とグリフの使用はロックしたまま行います。
+ */
+
+#ifndef EPD_GLYPH_CACHE_H
+#define EPD_GLYPH_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "epd_wrapper.h"
+
+/**
+ * @brief キャッシュ容量のデフォルト値（バイト）
+ */
+#ifndef EPD_GLYPH_CACHE_DEFAULT_BUDGET
+#define EPD_GLYPH_CACHE_DEFAULT_BUDGET (256 * 1024)
+#endif
+
+/**
+ * @brief グリフを識別するキー
+ *
+ * 背景透過の場合、bg_colorは0として扱われます。
+ */
+typedef struct
+{
+    const void *font;     // フォント情報（FontInfo）へのポインタ
+    uint32_t code_point;  // Unicodeコードポイント
+    uint8_t rotation;     // 回転（0:0度, 1:90度, 2:180度, 3:270度）
+    uint8_t text_color;   // 文字色（0-15）
+    uint8_t bg_color;     // 背景色（0-15）
+    bool bg_transparent;  // 背景透過かどうか
+    bool bold;            // 太字かどうか
+} EPDGlyphCacheKey;
+
+/**
+ * @brief キャッシュされたグリフの画像
+ */
+typedef struct
+{
+    int width;                 // 幅（ピクセル、回転後）
+    int height;                // 高さ（ピクセル、回転後）
+    int stride;                // 1行あたりのバイト数
+    bool transparent;          // transparent_colorのピクセルを透過するか
+    uint8_t transparent_color; // 透過色（transparentがtrueの場合のみ有効）
+    uint8_t *data;             // 4ビット/ピクセルの画像データ（偶数ピクセルが下位4ビット）
+} EPDGlyphBitmap;
+
+/**
+ * @brief キャッシュの統計情報
+ */
+typedef struct
+{
+    uint32_t hits;      // ヒット回数
+    uint32_t misses;    // ミス回数
+    uint32_t evictions; // 破棄したグリフ数
+    int entries;        // 保持しているグリフ数
+    size_t bytes_used;  // 使用中のバイト数
+    size_t budget;      // 使用できる最大バイト数
+} EPDGlyphCacheStats;
+
+/**
+ * @brief グリフキャッシュを初期化する
+ * @param budget 使用できる最大バイト数（0の場合はキャッシュを無効にする）
+ * @return 初期化に成功したかどうか
+ *
+ * 既に初期化済みの場合は、保持しているグリフを破棄して容量を設定し直します。
+ */
+bool epd_glyph_cache_init(size_t budget);
+
+/**
+ * @brief グリフキャッシュを終了し、すべてのメモリを解放する
+ */
+void epd_glyph_cache_deinit(void);
+
+/**
+ * @brief キャッシュが使用可能かどうかを返す
+ * @return 初期化済みで容量が0より大きい場合はtrue
+ */
+bool epd_glyph_cache_is_enabled(void);
+
+/**
+ * @brief 保持しているグリフをすべて破棄する
+ *
+ * フォントデータを差し替える前に呼び出してください。
+ */
+void epd_glyph_cache_clear(void);
+
+/**
+ * @brief キャッシュをロックする
+ * @return ロックできた場合true
+ *
+ * epd_glyph_cache_lookup() / epd_glyph_cache_insert() の呼び出しから、返されたグリフへの
+ * 書き込み・描画が終わるまでロックしたままにしてください。
+ * ロック中に他のキャッシュ関数（lookup/insert以外）を呼び出すことはできません。
+ */
+bool epd_glyph_cache_lock(void);
+
+/**
+ * @brief キャッシュのロックを解除する
+ */
+void epd_glyph_cache_unlock(void);
+
+/**
+ * @brief キャッシュからグリフを検索する
+ * @param key 検索するキー
+ * @return 見つかったグリフ。見つからない場合はNULL
+ *
+ * 見つかったグリフは最近使用したものとして扱われます。
+ * epd_glyph_cache_lock() でロックしてから呼び出してください。
+ */
+const EPDGlyphBitmap *epd_glyph_cache_lookup(const EPDGlyphCacheKey *key);
+
+/**
+ * @brief 新しいグリフの領域を確保してキャッシュに登録する
+ * @param key 登録するキー
+ * @param width 幅（ピクセル）
+ * @param height 高さ（ピクセル）
+ * @return 確保したグリフ（呼び出し側がdataを書き込む）。確保できない場合はNULL
+ *
+ * 容量が足りない場合は古いグリフを破棄します。
+ * epd_glyph_cache_lock() でロックしてから呼び出し、ロックを解除する前に書き込みを終えてください。
+ */
+EPDGlyphBitmap *epd_glyph_cache_insert(const EPDGlyphCacheKey *key, int width, int height);
+
+/**
+ * @brief キャッシュされたグリフをフレームバッファに描画する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param x 左上のX座標（フレームバッファ座標系、回転なし）
+ * @param y 左上のY座標（フレームバッファ座標系、回転なし）
+ * @param glyph 描画するグリフ
+ */
+void epd_glyph_cache_blit(EPDWrapper *wrapper, int x, int y, const EPDGlyphBitmap *glyph);
+
+/**
+ * @brief 統計情報を取得する
+ * @param stats 統計情報の格納先
+ */
+void epd_glyph_cache_get_stats(EPDGlyphCacheStats *stats);
+
+#endif // EPD_GLYPH_CACHE_H
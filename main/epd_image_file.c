@@ -0,0 +1,838 @@
+/**
+ * @file epd_image_file.c
+ * @brief SDカード上の画像ファイルの描画
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "epd_image_file.h"
+
+// PNGの展開にはROMのminiz（tinfl）を使う
+#if __has_include("miniz.h")
+#include "miniz.h"
+#define EPD_IMAGE_FILE_HAS_PNG 1
+#elif __has_include("rom/miniz.h")
+#include "rom/miniz.h"
+#define EPD_IMAGE_FILE_HAS_PNG 1
+#else
+#define EPD_IMAGE_FILE_HAS_PNG 0
+#endif
+
+static const char *TAG = "epd_image_file";
+
+// 4ビット/ピクセル生データのヘッダ（"EPD4" + 幅 + 高さ）
+#define RAW4_MAGIC "EPD4"
+#define RAW4_HEADER_SIZE 8
+
+static const uint8_t PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+/**
+ * @brief 画像ファイルを開いた状態
+ */
+typedef struct
+{
+    FILE *file;
+    EPDImageFileInfo info;
+    int pgm_maxval; // PGMの最大値
+
+    // PNGのヘッダ情報
+    uint8_t png_bit_depth;
+    uint8_t png_color_type;
+    uint8_t png_palette[256];      // パレット番号から4ビットグレーへの変換表
+    bool png_has_trns;             // グレースケール・RGBの透明色が指定されているか
+    uint16_t png_trns[3];          // 透明色（グレースケールは[0]のみ）
+    uint32_t png_idat_remaining;   // 読み込み中のIDATチャンクの残りバイト数
+} ImageFile;
+
+/**
+ * @brief 数行分の出力先
+ */
+typedef struct
+{
+    EPDWrapper *wrapper;
+    int x;
+    int y;
+    int width;
+    int row_bytes;     // 1行のバイト数（(幅 + 1) / 2）
+    uint8_t *rows;     // EPD_IMAGE_FILE_STRIP_ROWS 行分のバッファ
+    int strip_start;   // バッファ先頭の行番号
+    int strip_count;   // バッファに入っている行数
+    int last_row;      // 描画する最後の行番号 + 1（画面外の行は読み込まない）
+    bool use_transparency;
+    uint8_t transparent_color;
+} StripWriter;
+
+static inline uint32_t read_be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+/**
+ * @brief 8ビットの輝度を4ビットに変換する（p2h.py と同じ）
+ */
+static inline uint8_t gray8_to_4(uint32_t gray)
+{
+    gray >>= 4;
+    return gray > 15 ? 15 : (uint8_t)gray;
+}
+
+/**
+ * @brief RGBを8ビットの輝度に変換する（p2h.py と同じ重み）
+ */
+static inline uint32_t rgb_to_gray8(uint32_t r, uint32_t g, uint32_t b)
+{
+    return (299 * r + 587 * g + 114 * b) / 1000;
+}
+
+/**
+ * @brief 出力先の次の行を返す
+ */
+static uint8_t *strip_next_row(StripWriter *writer)
+{
+    return writer->rows + writer->strip_count * writer->row_bytes;
+}
+
+/**
+ * @brief バッファにたまった行を描画する
+ */
+static void strip_flush(StripWriter *writer)
+{
+    if (writer->strip_count == 0)
+    {
+        return;
+    }
+    epd_wrapper_draw_image_rows(writer->wrapper, writer->x, writer->y + writer->strip_start,
+                                writer->width, writer->strip_count, writer->rows,
+                                writer->use_transparency, writer->transparent_color);
+    writer->strip_start += writer->strip_count;
+    writer->strip_count = 0;
+}
+
+/**
+ * @brief 1行分を確定し、バッファがいっぱいになったら描画する
+ * @return まだ描画する行が残っていればtrue
+ */
+static bool strip_commit_row(StripWriter *writer)
+{
+    writer->strip_count++;
+    if (writer->strip_count == EPD_IMAGE_FILE_STRIP_ROWS ||
+        writer->strip_start + writer->strip_count >= writer->last_row)
+    {
+        strip_flush(writer);
+    }
+    return writer->strip_start + writer->strip_count < writer->last_row;
+}
+
+static inline void put_nibble(uint8_t *row, int x, uint8_t value)
+{
+    uint8_t *p = row + x / 2;
+    if (x % 2 == 0)
+    {
+        *p = (*p & 0xF0) | value;
+    }
+    else
+    {
+        *p = (*p & 0x0F) | (value << 4);
+    }
+}
+
+/**
+ * @brief ファイルの先頭から空白とコメントを読み飛ばして10進数を読む（PGMヘッダ用）
+ */
+static bool pgm_read_number(FILE *f, int *value)
+{
+    int c = fgetc(f);
+    while (c != EOF)
+    {
+        if (c == '#')
+        {
+            while (c != EOF && c != '\n')
+            {
+                c = fgetc(f);
+            }
+        }
+        else if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+        {
+            c = fgetc(f);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (c < '0' || c > '9')
+    {
+        return false;
+    }
+    int n = 0;
+    while (c >= '0' && c <= '9')
+    {
+        n = n * 10 + (c - '0');
+        if (n > 65535)
+        {
+            return false;
+        }
+        c = fgetc(f);
+    }
+    // 数値の直後の空白1文字は区切りとして読み捨てる
+    *value = n;
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static bool pgm_open(ImageFile *img)
+{
+    int width, height;
+    if (!pgm_read_number(img->file, &width) || !pgm_read_number(img->file, &height) ||
+        !pgm_read_number(img->file, &img->pgm_maxval) || img->pgm_maxval == 0)
+    {
+        ESP_LOGE(TAG, "Invalid PGM header");
+        return false;
+    }
+    img->info.format = EPD_IMAGE_FILE_PGM;
+    img->info.width = width;
+    img->info.height = height;
+    return true;
+}
+
+static bool pgm_draw(ImageFile *img, StripWriter *writer)
+{
+    int sample_bytes = img->pgm_maxval > 255 ? 2 : 1;
+    int line_bytes = img->info.width * sample_bytes;
+    uint8_t *line = heap_caps_malloc(line_bytes, MALLOC_CAP_8BIT);
+    if (line == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate PGM line buffer");
+        return false;
+    }
+
+    bool ok = true;
+    bool more = writer->last_row > 0;
+    while (more)
+    {
+        if (fread(line, 1, line_bytes, img->file) != (size_t)line_bytes)
+        {
+            ESP_LOGE(TAG, "Unexpected end of PGM data");
+            ok = false;
+            break;
+        }
+        uint8_t *row = strip_next_row(writer);
+        for (int x = 0; x < img->info.width; x++)
+        {
+            uint32_t v = sample_bytes == 2 ? ((uint32_t)line[x * 2] << 8) | line[x * 2 + 1] : line[x];
+            put_nibble(row, x, gray8_to_4(v * 255 / img->pgm_maxval));
+        }
+        more = strip_commit_row(writer);
+    }
+
+    heap_caps_free(line);
+    return ok;
+}
+
+static bool raw4_open(ImageFile *img, EPDWrapper *wrapper)
+{
+    uint8_t header[RAW4_HEADER_SIZE];
+    long data_offset;
+    fseek(img->file, 0, SEEK_SET);
+    if (fread(header, 1, sizeof(header), img->file) == sizeof(header) &&
+        memcmp(header, RAW4_MAGIC, 4) == 0)
+    {
+        img->info.width = header[4] | (header[5] << 8);
+        img->info.height = header[6] | (header[7] << 8);
+        data_offset = RAW4_HEADER_SIZE;
+    }
+    else
+    {
+        // ヘッダなしの場合は画面全体（回転後のサイズ）の画像とみなす
+        if (wrapper == NULL || fseek(img->file, 0, SEEK_END) != 0)
+        {
+            return false;
+        }
+        long size = ftell(img->file);
+        int width = epd_wrapper_get_width(wrapper);
+        int height = epd_wrapper_get_height(wrapper);
+        if (size != (long)((width + 1) / 2) * height)
+        {
+            return false;
+        }
+        img->info.width = width;
+        img->info.height = height;
+        data_offset = 0;
+    }
+    img->info.format = EPD_IMAGE_FILE_RAW4;
+    return fseek(img->file, data_offset, SEEK_SET) == 0;
+}
+
+static bool raw4_draw(ImageFile *img, StripWriter *writer)
+{
+    bool more = writer->last_row > 0;
+    while (more)
+    {
+        // 生データは出力と同じ並びなのでバッファに直接読み込む
+        if (fread(strip_next_row(writer), 1, writer->row_bytes, img->file) != (size_t)writer->row_bytes)
+        {
+            ESP_LOGE(TAG, "Unexpected end of 4bpp data");
+            return false;
+        }
+        more = strip_commit_row(writer);
+    }
+    return true;
+}
+
+/**
+ * @brief PNGのチャンクヘッダ（長さと種類）を読む
+ */
+static bool png_read_chunk_header(FILE *f, uint32_t *length, char type[5])
+{
+    uint8_t header[8];
+    if (fread(header, 1, sizeof(header), f) != sizeof(header))
+    {
+        return false;
+    }
+    *length = read_be32(header);
+    memcpy(type, header + 4, 4);
+    type[4] = '\0';
+    return true;
+}
+
+/**
+ * @brief IHDRからIDATの直前までを読み、パレットと透明色を取り込む
+ */
+static bool png_open(ImageFile *img)
+{
+    FILE *f = img->file;
+    uint32_t length;
+    char type[5];
+
+    // IHDR
+    uint8_t ihdr[13];
+    if (!png_read_chunk_header(f, &length, type) || strcmp(type, "IHDR") != 0 || length != 13 ||
+        fread(ihdr, 1, sizeof(ihdr), f) != sizeof(ihdr) || fseek(f, 4, SEEK_CUR) != 0)
+    {
+        ESP_LOGE(TAG, "Invalid PNG header");
+        return false;
+    }
+    uint32_t width = read_be32(ihdr);
+    uint32_t height = read_be32(ihdr + 4);
+    img->png_bit_depth = ihdr[8];
+    img->png_color_type = ihdr[9];
+    if (ihdr[10] != 0 || ihdr[11] != 0 || ihdr[12] != 0)
+    {
+        ESP_LOGE(TAG, "Unsupported PNG (interlaced or unknown filter)");
+        return false;
+    }
+    uint8_t d = img->png_bit_depth;
+    bool supported;
+    switch (img->png_color_type)
+    {
+    case 0: // グレースケール
+        supported = d == 1 || d == 2 || d == 4 || d == 8 || d == 16;
+        break;
+    case 3: // パレット
+        supported = d == 1 || d == 2 || d == 4 || d == 8;
+        break;
+    case 2: // RGB
+    case 4: // グレースケール + アルファ
+    case 6: // RGBA
+        supported = d == 8 || d == 16;
+        break;
+    default:
+        supported = false;
+        break;
+    }
+    if (!supported || width == 0 || height == 0 || width > 0xFFFF || height > 0xFFFF)
+    {
+        ESP_LOGE(TAG, "Unsupported PNG (color type %d, bit depth %d, %lux%lu)",
+                 img->png_color_type, d, (unsigned long)width, (unsigned long)height);
+        return false;
+    }
+    img->info.format = EPD_IMAGE_FILE_PNG;
+    img->info.width = (int)width;
+    img->info.height = (int)height;
+
+    // パレットは白で初期化しておく
+    memset(img->png_palette, 15, sizeof(img->png_palette));
+
+    // IDATまでのチャンクを読む
+    while (png_read_chunk_header(f, &length, type))
+    {
+        if (strcmp(type, "IDAT") == 0)
+        {
+            img->png_idat_remaining = length;
+            return true;
+        }
+
+        if (strcmp(type, "PLTE") == 0 && length % 3 == 0 && length <= 256 * 3)
+        {
+            for (uint32_t i = 0; i < length / 3; i++)
+            {
+                uint8_t rgb[3];
+                if (fread(rgb, 1, 3, f) != 3)
+                {
+                    return false;
+                }
+                img->png_palette[i] = gray8_to_4(rgb_to_gray8(rgb[0], rgb[1], rgb[2]));
+            }
+        }
+        else if (strcmp(type, "tRNS") == 0 && length <= 256)
+        {
+            uint8_t trns[256];
+            if (fread(trns, 1, length, f) != length)
+            {
+                return false;
+            }
+            if (img->png_color_type == 3)
+            {
+                // 完全に透明なパレットは白として扱う
+                for (uint32_t i = 0; i < length; i++)
+                {
+                    if (trns[i] == 0)
+                    {
+                        img->png_palette[i] = 15;
+                    }
+                }
+            }
+            else if ((img->png_color_type == 0 && length >= 2) || (img->png_color_type == 2 && length >= 6))
+            {
+                img->png_has_trns = true;
+                for (uint32_t i = 0; i < length / 2 && i < 3; i++)
+                {
+                    img->png_trns[i] = (trns[i * 2] << 8) | trns[i * 2 + 1];
+                }
+            }
+        }
+        else if (strcmp(type, "IEND") == 0)
+        {
+            break;
+        }
+        else if (fseek(f, length, SEEK_CUR) != 0)
+        {
+            return false;
+        }
+
+        // CRC
+        if (fseek(f, 4, SEEK_CUR) != 0)
+        {
+            return false;
+        }
+    }
+
+    ESP_LOGE(TAG, "PNG has no image data");
+    return false;
+}
+
+#if EPD_IMAGE_FILE_HAS_PNG
+
+/**
+ * @brief PNGの展開状態（圧縮データの入力バッファと展開用の辞書）
+ */
+typedef struct
+{
+    tinfl_decompressor decompressor;
+    uint8_t dict[TINFL_LZ_DICT_SIZE]; // 展開結果を書き込む循環バッファ（LZ77の参照範囲）
+    uint8_t input[EPD_IMAGE_FILE_INPUT_BUFFER_SIZE];
+} PngInflate;
+
+/**
+ * @brief IDATチャンクをまたいで圧縮データを読み込む
+ * @return 読み込んだバイト数（0の場合はデータの終わり）
+ */
+static size_t png_read_idat(ImageFile *img, uint8_t *buffer, size_t size)
+{
+    while (img->png_idat_remaining == 0)
+    {
+        // CRCを読み飛ばして次のチャンクへ（IDATが続かなければ終わり）
+        uint32_t length;
+        char type[5];
+        if (fseek(img->file, 4, SEEK_CUR) != 0 || !png_read_chunk_header(img->file, &length, type) ||
+            strcmp(type, "IDAT") != 0)
+        {
+            return 0;
+        }
+        img->png_idat_remaining = length;
+    }
+
+    if (size > img->png_idat_remaining)
+    {
+        size = img->png_idat_remaining;
+    }
+    size_t n = fread(buffer, 1, size, img->file);
+    img->png_idat_remaining -= n;
+    return n;
+}
+
+static inline uint8_t paeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    int p = a + b - c;
+    int pa = p > a ? p - a : a - p;
+    int pb = p > b ? p - b : b - p;
+    int pc = p > c ? p - c : c - p;
+    if (pa <= pb && pa <= pc)
+    {
+        return a;
+    }
+    return pb <= pc ? b : c;
+}
+
+/**
+ * @brief フィルタを解除する
+ * @param line フィルタ種別の1バイトに続く1行分のデータ（その場で復元する）
+ * @param prev 前の行の復元済みデータ（先頭行は0で埋めたもの）
+ */
+static bool png_unfilter(uint8_t *line, const uint8_t *prev, int length, int bpp)
+{
+    uint8_t filter = line[0];
+    uint8_t *cur = line + 1;
+    switch (filter)
+    {
+    case 0:
+        break;
+    case 1:
+        for (int i = bpp; i < length; i++)
+        {
+            cur[i] += cur[i - bpp];
+        }
+        break;
+    case 2:
+        for (int i = 0; i < length; i++)
+        {
+            cur[i] += prev[i];
+        }
+        break;
+    case 3:
+        for (int i = 0; i < length; i++)
+        {
+            uint8_t left = i >= bpp ? cur[i - bpp] : 0;
+            cur[i] += (uint8_t)((left + prev[i]) / 2);
+        }
+        break;
+    case 4:
+        for (int i = 0; i < length; i++)
+        {
+            uint8_t left = i >= bpp ? cur[i - bpp] : 0;
+            uint8_t up_left = i >= bpp ? prev[i - bpp] : 0;
+            cur[i] += paeth(left, prev[i], up_left);
+        }
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 復元した1行を4ビットグレースケールに変換する
+ */
+static void png_convert_row(const ImageFile *img, const uint8_t *src, uint8_t *dst)
+{
+    int width = img->info.width;
+    int depth = img->png_bit_depth;
+
+    for (int x = 0; x < width; x++)
+    {
+        uint8_t value;
+        switch (img->png_color_type)
+        {
+        case 0: // グレースケール
+        {
+            uint32_t sample;
+            uint32_t gray8;
+            if (depth == 16)
+            {
+                sample = (src[x * 2] << 8) | src[x * 2 + 1];
+                gray8 = src[x * 2];
+            }
+            else if (depth == 8)
+            {
+                sample = src[x];
+                gray8 = sample;
+            }
+            else
+            {
+                int bit = x * depth;
+                uint32_t max = (1u << depth) - 1;
+                sample = (src[bit / 8] >> (8 - depth - bit % 8)) & max;
+                gray8 = sample * 255 / max;
+            }
+            value = (img->png_has_trns && sample == img->png_trns[0]) ? 15 : gray8_to_4(gray8);
+            break;
+        }
+        case 3: // パレット
+        {
+            int bit = x * depth;
+            uint8_t index = (src[bit / 8] >> (8 - depth - bit % 8)) & ((1u << depth) - 1);
+            value = img->png_palette[index];
+            break;
+        }
+        case 2: // RGB
+        {
+            int step = depth / 8;
+            const uint8_t *p = src + x * 3 * step;
+            value = gray8_to_4(rgb_to_gray8(p[0], p[step], p[step * 2]));
+            if (img->png_has_trns)
+            {
+                uint16_t r = step == 2 ? (p[0] << 8) | p[1] : p[0];
+                uint16_t g = step == 2 ? (p[2] << 8) | p[3] : p[1];
+                uint16_t b = step == 2 ? (p[4] << 8) | p[5] : p[2];
+                if (r == img->png_trns[0] && g == img->png_trns[1] && b == img->png_trns[2])
+                {
+                    value = 15;
+                }
+            }
+            break;
+        }
+        case 4: // グレースケール + アルファ
+        {
+            int step = depth / 8;
+            const uint8_t *p = src + x * 2 * step;
+            value = p[step] == 0 && p[step * 2 - 1] == 0 ? 15 : gray8_to_4(p[0]);
+            break;
+        }
+        default: // RGBA
+        {
+            int step = depth / 8;
+            const uint8_t *p = src + x * 4 * step;
+            value = p[step * 3] == 0 && p[step * 4 - 1] == 0
+                        ? 15
+                        : gray8_to_4(rgb_to_gray8(p[0], p[step], p[step * 2]));
+            break;
+        }
+        }
+        put_nibble(dst, x, value);
+    }
+}
+
+static bool png_draw(ImageFile *img, StripWriter *writer)
+{
+    int channels = (img->png_color_type == 2) ? 3 : (img->png_color_type == 4) ? 2
+                                                : (img->png_color_type == 6) ? 4 : 1;
+    int bits_per_pixel = channels * img->png_bit_depth;
+    int line_bytes = (img->info.width * bits_per_pixel + 7) / 8;
+    int bpp = (bits_per_pixel + 7) / 8;
+
+    // 展開状態（約43KB）と2行分のバッファ。画像全体は保持しない
+    PngInflate *inflate = heap_caps_malloc(sizeof(PngInflate), MALLOC_CAP_SPIRAM);
+    uint8_t *lines = heap_caps_calloc(2, line_bytes + 1, MALLOC_CAP_8BIT);
+    if (inflate == NULL || lines == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate PNG decoder");
+        heap_caps_free(inflate);
+        heap_caps_free(lines);
+        return false;
+    }
+    uint8_t *line = lines;                 // フィルタ種別 + 現在の行
+    uint8_t *prev = lines + line_bytes + 1; // 前の行（フィルタ種別を除く）
+    int line_fill = 0;
+
+    tinfl_init(&inflate->decompressor);
+    size_t dict_offset = 0;
+    size_t input_pos = 0;
+    size_t input_len = 0;
+    bool input_done = false;
+    bool ok = true;
+    bool more = writer->last_row > 0;
+
+    while (more)
+    {
+        if (input_pos == input_len && !input_done)
+        {
+            input_len = png_read_idat(img, inflate->input, sizeof(inflate->input));
+            input_pos = 0;
+            input_done = input_len == 0;
+        }
+
+        size_t in_bytes = input_len - input_pos;
+        size_t out_bytes = TINFL_LZ_DICT_SIZE - dict_offset;
+        tinfl_status status = tinfl_decompress(&inflate->decompressor, inflate->input + input_pos, &in_bytes,
+                                               inflate->dict, inflate->dict + dict_offset, &out_bytes,
+                                               TINFL_FLAG_PARSE_ZLIB_HEADER |
+                                                   (input_done ? 0 : TINFL_FLAG_HAS_MORE_INPUT));
+        input_pos += in_bytes;
+
+        // 展開できたバイト列を行に組み立て、1行そろうごとに変換して出力する
+        const uint8_t *out = inflate->dict + dict_offset;
+        dict_offset = (dict_offset + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
+        while (out_bytes > 0 && more)
+        {
+            size_t n = line_bytes + 1 - line_fill;
+            if (n > out_bytes)
+            {
+                n = out_bytes;
+            }
+            memcpy(line + line_fill, out, n);
+            line_fill += n;
+            out += n;
+            out_bytes -= n;
+
+            if (line_fill == line_bytes + 1)
+            {
+                if (!png_unfilter(line, prev, line_bytes, bpp))
+                {
+                    ESP_LOGE(TAG, "Invalid PNG filter type %d", line[0]);
+                    ok = false;
+                    more = false;
+                    break;
+                }
+                png_convert_row(img, line + 1, strip_next_row(writer));
+                memcpy(prev, line + 1, line_bytes);
+                line_fill = 0;
+                more = strip_commit_row(writer);
+            }
+        }
+
+        if (!more)
+        {
+            break;
+        }
+        if (status == TINFL_STATUS_DONE || status < 0 ||
+            (status == TINFL_STATUS_NEEDS_MORE_INPUT && input_done))
+        {
+            ESP_LOGE(TAG, "PNG data ended early (status %d)", (int)status);
+            ok = false;
+            break;
+        }
+    }
+
+    heap_caps_free(lines);
+    heap_caps_free(inflate);
+    return ok;
+}
+
+#else
+
+static bool png_draw(ImageFile *img, StripWriter *writer)
+{
+    ESP_LOGE(TAG, "PNG decoding is not available in this build");
+    return false;
+}
+
+#endif // EPD_IMAGE_FILE_HAS_PNG
+
+/**
+ * @brief ファイルを開いて形式とサイズを判定する
+ */
+static bool image_file_open(ImageFile *img, EPDWrapper *wrapper, const char *path)
+{
+    memset(img, 0, sizeof(*img));
+    if (path == NULL)
+    {
+        return false;
+    }
+    img->file = fopen(path, "rb");
+    if (img->file == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to open %s", path);
+        return false;
+    }
+
+    uint8_t magic[8];
+    size_t n = fread(magic, 1, sizeof(magic), img->file);
+    bool ok;
+    if (n >= 2 && magic[0] == 'P' && magic[1] == '5')
+    {
+        fseek(img->file, 2, SEEK_SET);
+        ok = pgm_open(img);
+    }
+    else if (n == sizeof(PNG_SIGNATURE) && memcmp(magic, PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) == 0)
+    {
+        ok = png_open(img);
+    }
+    else
+    {
+        ok = raw4_open(img, wrapper);
+    }
+
+    if (ok && (img->info.width <= 0 || img->info.height <= 0 || img->info.width > EPD_IMAGE_FILE_MAX_WIDTH))
+    {
+        ESP_LOGE(TAG, "Unsupported image size %dx%d", img->info.width, img->info.height);
+        ok = false;
+    }
+    if (!ok)
+    {
+        ESP_LOGE(TAG, "Unsupported image file: %s", path);
+        fclose(img->file);
+        img->file = NULL;
+    }
+    return ok;
+}
+
+bool epd_image_file_get_info(EPDWrapper *wrapper, const char *path, EPDImageFileInfo *info)
+{
+    if (info == NULL)
+    {
+        return false;
+    }
+
+    ImageFile img;
+    if (!image_file_open(&img, wrapper, path))
+    {
+        info->format = EPD_IMAGE_FILE_UNKNOWN;
+        info->width = 0;
+        info->height = 0;
+        return false;
+    }
+    *info = img.info;
+    fclose(img.file);
+    return true;
+}
+
+bool epd_image_file_draw(EPDWrapper *wrapper, int x, int y, const char *path,
+                         bool use_transparency, uint8_t transparent_color)
+{
+    if (epd_wrapper_get_framebuffer(wrapper) == NULL)
+    {
+        return false;
+    }
+
+    ImageFile img;
+    if (!image_file_open(&img, wrapper, path))
+    {
+        return false;
+    }
+    // ここでファイルの読み込み位置は画素データの先頭にある
+    StripWriter writer = {
+        .wrapper = wrapper,
+        .x = x,
+        .y = y,
+        .width = img.info.width,
+        .row_bytes = (img.info.width + 1) / 2,
+        .use_transparency = use_transparency,
+        .transparent_color = transparent_color,
+    };
+
+    // 画面の下端より下の行は読み込まない
+    writer.last_row = epd_wrapper_get_height(wrapper) - y;
+    if (writer.last_row > img.info.height)
+    {
+        writer.last_row = img.info.height;
+    }
+
+    writer.rows = heap_caps_malloc(writer.row_bytes * EPD_IMAGE_FILE_STRIP_ROWS, MALLOC_CAP_8BIT);
+    if (writer.rows == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate row buffer");
+        fclose(img.file);
+        return false;
+    }
+
+    bool ok;
+    switch (img.info.format)
+    {
+    case EPD_IMAGE_FILE_PGM:
+        ok = pgm_draw(&img, &writer);
+        break;
+    case EPD_IMAGE_FILE_RAW4:
+        ok = raw4_draw(&img, &writer);
+        break;
+    default:
+        ok = png_draw(&img, &writer);
+        break;
+    }
+    strip_flush(&writer);
+
+    heap_caps_free(writer.rows);
+    fclose(img.file);
+    return ok;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file epd_image_file.h
+ * @brief SDカード上の画像ファイルの描画
+ *
+ * 画像ファイルを数行ずつ読み込んで4ビットグレースケールに変換し、
+ * そのままフレームバッファに描画します。画像全体を保持するバッファは使わないため、
+ * 画面より大きな画像でも数行分のバッファとデコーダの状態だけで描画できます。
+ *
+ * 対応形式:
+ *   - PGM（P5、最大値255以下または65535以下）
+ *   - 4ビット/ピクセルの生データ（p2h.py と同じ並び）
+ *       先頭に "EPD4" + 幅 + 高さ（各2バイト、リトルエンディアン）のヘッダを付けたもの（p2h.py --bin で生成）、
+ *       またはヘッダなしで画面全体（回転後の幅 x 高さ）と同じサイズのもの
+ *   - PNG（グレースケール・パレット・RGB、アルファ付きを含む。インターレースは非対応）
+ *
+ * グレースケールへの変換は p2h.py と同じで、透明（アルファ0）のピクセルは白になります。
+ */
+
+#ifndef EPD_IMAGE_FILE_H
+#define EPD_IMAGE_FILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "epd_wrapper.h"
+
+/**
+ * @brief 一度に変換・描画する行数
+ */
+#ifndef EPD_IMAGE_FILE_STRIP_ROWS
+#define EPD_IMAGE_FILE_STRIP_ROWS 8
+#endif
+
+/**
+ * @brief PNGの圧縮データを読み込むバッファのサイズ（バイト）
+ */
+#ifndef EPD_IMAGE_FILE_INPUT_BUFFER_SIZE
+#define EPD_IMAGE_FILE_INPUT_BUFFER_SIZE 4096
+#endif
+
+/**
+ * @brief 描画できる画像の最大幅（ピクセル）
+ */
+#ifndef EPD_IMAGE_FILE_MAX_WIDTH
+#define EPD_IMAGE_FILE_MAX_WIDTH 4096
+#endif
+
+/**
+ * @brief 画像ファイルの形式
+ */
+typedef enum
+{
+    EPD_IMAGE_FILE_UNKNOWN = 0, // 非対応の形式
+    EPD_IMAGE_FILE_PGM,         // PGM（P5）
+    EPD_IMAGE_FILE_RAW4,        // 4ビット/ピクセルの生データ
+    EPD_IMAGE_FILE_PNG,         // PNG
+} EPDImageFileFormat;
+
+/**
+ * @brief 画像ファイルの情報
+ */
+typedef struct
+{
+    EPDImageFileFormat format; // 形式
+    int width;                 // 幅（ピクセル）
+    int height;                // 高さ（ピクセル）
+} EPDImageFileInfo;
+
+/**
+ * @brief 画像ファイルの形式とサイズを調べる
+ * @param wrapper EPDラッパー構造体へのポインタ（ヘッダなしの生データのサイズ判定に使用）
+ * @param path ファイルのパス（例: "/sdcard/bg.png"）
+ * @param info 情報の格納先
+ * @return 対応している形式の場合はtrue
+ */
+bool epd_image_file_get_info(EPDWrapper *wrapper, const char *path, EPDImageFileInfo *info);
+
+/**
+ * @brief 画像ファイルを描画する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param x 左上X座標（回転後の論理座標）
+ * @param y 左上Y座標（回転後の論理座標）
+ * @param path ファイルのパス（例: "/sdcard/bg.png"）
+ * @param use_transparency 透明処理を有効にするかどうか
+ * @param transparent_color 透明とする色（0-15の値）
+ * @return 描画できた場合はtrue
+ *
+ * epd_wrapper_draw_image() と同様に画像は表示の回転に合わせて回転し、
+ * クリップ矩形の内側だけに描画されます。画面より下にはみ出した行は読み込みません。
+ */
+bool epd_image_file_draw(EPDWrapper *wrapper, int x, int y, const char *path,
+                         bool use_transparency, uint8_t transparent_color);
+
+#endif // EPD_IMAGE_FILE_H
@@ -18,19 +18,26 @@
 // Custom wrapper library
 #include "epd_wrapper.h"
 #include "epd_transition.h"
+#include "epd_rle.h"
+#include "epd_scene.h"
 
-// サンプル画像
-#include "ayamelogo4bit.h"
-// #include "bg1.h"
-#include "bg2.h"
-// #include "ichi.h"
+// サンプル画像（p2h.py --rle で圧縮したもの）
+#include "ayamelogo4bit_rle.h"
+// #include "bg1_rle.h"
+#include "bg2_rle.h"
+// #include "ichi_rle.h"
 
 // 文字とフォント
 #include "epd_text.h"
+#include "epd_glyph_cache.h"
 #include "Mplus2-Light_16.h"
+#include "epd_font_blob.h"
+#include "epd_book.h"
+#include "epd_bench.h"
 
 // タッチコントローラ
 #include "gt911.h"
+#include "esp_timer.h"
 static const char *TAG = "touch_test";
 
 // usb msc
@@ -39,9 +46,13 @@ static const char *TAG = "touch_test";
 // グローバル変数
 static EPDWrapper epd;
 static GT911_Device g_touch_device;
+static EPDBook g_book;
+static EPDScene g_scene;
+static EPDFontBlob g_font_blob;
+static const FontInfo *g_font = &Mplus2_Light_16; // フォント用パーティションにフォントがあればそちらを使う
 
 void draw_sprash(EPDWrapper *wrapper);
-void transition(EPDWrapper *epd, const uint8_t *newimage, TransitionType type);
+void transition(EPDWrapper *epd, const EPDRleImage *newimage, TransitionType type);
 void test_text_display(EPDWrapper *wrapper);
 void test_text_drawing(EPDWrapper *wrapper);
 void test_multiline_text(EPDWrapper *wrapper);
@@ -49,6 +60,11 @@ void test_multiline_text(EPDWrapper *wrapper);
 // タッチハンドリング用のタスク
 static void touch_handling_task(void *pvParameters);
 
+// 割り込みが使えない場合にタッチデータを読み取る間隔（ミリ秒）
+#ifndef TOUCH_POLL_INTERVAL_MS
+#define TOUCH_POLL_INTERVAL_MS 20
+#endif
+
 // タスクハンドル
 static TaskHandle_t touch_task_handle = NULL;
 
@@ -56,6 +72,7 @@ static TaskHandle_t touch_task_handle = NULL;
 typedef struct
 {
     EPDWrapper *epd;
+    EPDScene *scene;
     GT911_Device *touch_device;
     bool running;
 } TouchTaskParams;
@@ -148,7 +165,7 @@ void display_text_on_epd(const char* text)
     
     // テキスト設定の初期化
     EPDTextConfig text_config;
-    epd_text_config_init(&text_config, &Mplus2_Light_16);  // 適切なフォントを使用
+    epd_text_config_init(&text_config, g_font);  // 適切なフォントを使用
     
     // テキスト色を黒に設定
     text_config.text_color = 0x00;
@@ -173,7 +190,7 @@ void display_text_on_epd(const char* text)
     epd_wrapper_update_screen(&epd, MODE_GC16);
 }
 
-// テスト用、SDカードからtest.txtを読み込んで表示する
+// テスト用、SDカードのtest.txtをページ分割して1ページ目を表示する
 void read_and_display_text_file(void)
 {
     // SDカードのマウントポイントを取得
@@ -183,46 +200,38 @@ void read_and_display_text_file(void)
     char filepath[64];
     snprintf(filepath, sizeof(filepath), "%s/test.txt", mount_point);
     
-    // ファイルを開く
-    FILE* f = fopen(filepath, "r");
-    if (f == NULL) {
-        ESP_LOGE(TAG, "Failed to open file: %s", filepath);
-        return;
-    }
+    // テキスト設定の初期化
+    EPDTextConfig text_config;
+    epd_text_config_init(&text_config, g_font);
+    text_config.text_color = 0x00;
     
-    // ファイルサイズを取得
-    fseek(f, 0, SEEK_END);
-    long filesize = ftell(f);
-    fseek(f, 0, SEEK_SET);
+    // テキスト描画エリアを設定
+    int width = epd_wrapper_get_width(&epd);
+    int height = epd_wrapper_get_height(&epd);
+    EpdRect text_area = {
+        .x = 20,
+        .y = 20,
+        .width = width - 40,
+        .height = height - 40
+    };
     
-    // ファイル内容を読み込むバッファを確保
-    char* buffer = (char*)malloc(filesize + 1);
-    if (buffer == NULL) {
-        ESP_LOGE(TAG, "Failed to allocate memory for file content");
-        fclose(f);
+    // 本として開く（索引がなければバックグラウンドでレイアウトが始まる）
+    if (!epd_book_open(&g_book, filepath, &text_area, &text_config)) {
+        ESP_LOGE(TAG, "Failed to open book: %s", filepath);
         return;
     }
     
-    // ファイル内容を読み込む
-    size_t read_size = fread(buffer, 1, filesize, f);
-    fclose(f);
-    
-    if (read_size != filesize) {
-        ESP_LOGE(TAG, "Failed to read entire file");
-        free(buffer);
+    // 1ページ目のレイアウトを待つ
+    if (!epd_book_wait_for_page(&g_book, 0, 5000)) {
+        ESP_LOGE(TAG, "First page not available");
         return;
     }
     
-    // 文字列の終端を追加
-    buffer[filesize] = '\0';
-    
-    // ファイル内容をログに出力（確認用）
-    ESP_LOGI(TAG, "File content: %s", buffer);
-    
     // 電子ペーパーに表示
-    display_text_on_epd(buffer);
-    
-    free(buffer);
+    epd_wrapper_fill(&epd, 0xFF);
+    int lines = epd_book_render_page(&g_book, &epd, 0);
+    ESP_LOGI(TAG, "Displayed %d lines of page 1", lines);
+    epd_wrapper_update_screen(&epd, EPD_WRAPPER_MODE_AUTO);
 }
 
 void app_main(void)
@@ -239,9 +248,35 @@ void app_main(void)
         return;
     }
 
-    // 電源をONにする
-    epd_wrapper_power_on(&epd);
-    vTaskDelay(100 / portTICK_PERIOD_MS);
+    // グリフキャッシュの初期化（失敗してもキャッシュなしで描画できる）
+    if (!epd_glyph_cache_init(EPD_GLYPH_CACHE_DEFAULT_BUDGET))
+    {
+        ESP_LOGW(TAG, "Glyph cache unavailable, drawing glyphs directly");
+    }
+
+    // フォント用パーティションのフォントを割り当てて使う（なければ組み込みのフォント）
+    if (epd_font_blob_open_partition(&g_font_blob, EPD_FONT_BLOB_PARTITION_LABEL, 0))
+    {
+        g_font = &g_font_blob.info;
+    }
+
+    // フォントの索引を先に作っておく（失敗しても二分探索で検索できる）
+    epd_text_register_font(g_font);
+
+    // パネル電源は更新時に自動で入り、一定時間更新がなければリフレッシュタスクが切る
+
+    // 画面更新を専用タスク（コア1）で行い、描画と並行して駆動できるようにする
+    if (!epd_wrapper_start_async(&epd, 1))
+    {
+        ESP_LOGW(TAG, "Async update unavailable, updating synchronously");
+    }
+
+#if EPD_BENCH_ON_BOOT
+    // 描画処理のベンチマーク（結果はシリアルに出力される）
+    EPDBenchResult bench_results[EPD_BENCH_MAX_RESULTS];
+    int bench_count = epd_bench_run_all(&epd, bench_results, EPD_BENCH_MAX_RESULTS);
+    epd_bench_print(bench_results, bench_count);
+#endif
 
     
     // 画面を白で初期化
@@ -277,13 +312,12 @@ void app_main(void)
     }
 
 
-    // 画面の枠を描画
+    // 画面の枠をディスプレイリストに追加して描画（枠の4辺だけが描き直される）
     int width = epd_wrapper_get_width(&epd);
     int height = epd_wrapper_get_height(&epd);
-    epd_wrapper_draw_rect(&epd, 10, 10, width - 20, height - 20, 0x00);
-
-    // 画面の枠を描画
-    epd_wrapper_draw_rect(&epd, 10, 10, width - 20, height - 20, 0x00);
+    epd_scene_init(&g_scene, &epd, 0xFF);
+    epd_scene_add_rect(&g_scene, 10, 10, width - 20, height - 20, 0x00, false, 0);
+    epd_scene_render(&g_scene);
     epd_wrapper_update_screen(&epd, MODE_GC16);
 
     // I2Cの初期化
@@ -310,6 +344,7 @@ void app_main(void)
 
     // タッチタスクのパラメータを設定
     touch_params.epd = &epd;
+    touch_params.scene = &g_scene;
     touch_params.touch_device = &g_touch_device;
     touch_params.running = true;
 
@@ -330,6 +365,25 @@ void app_main(void)
     // app_main関数はここで終了しますが、タッチハンドリングタスクは継続して実行されます
 }
 
+/**
+ * @brief ポーリングでタッチデータを読み取り、イベントとして返す
+ * @param touch_device GT911デバイス
+ * @param event 読み取ったイベントの格納先
+ * @return 新しい座標データを読み取れた場合true（指が離れた場合は point_count が0）
+ */
+static bool poll_touch_event(GT911_Device *touch_device, GT911_TouchEvent *event)
+{
+    if (!gt911_read_touch_data(touch_device))
+    {
+        return false;
+    }
+
+    event->timestamp_us = esp_timer_get_time();
+    event->point_count = touch_device->active_points;
+    memcpy(event->points, touch_device->points, sizeof(event->points));
+    return true;
+}
+
 /**
  * @brief タッチハンドリングタスク - 座標取得と丸の描画を行う
  * @param pvParameters タスクパラメータ（TouchTaskParams構造体へのポインタ）
@@ -338,105 +392,101 @@ static void touch_handling_task(void *pvParameters)
 {
     TouchTaskParams *params = (TouchTaskParams *)pvParameters;
     EPDWrapper *epd = params->epd;
+    EPDScene *scene = params->scene;
     GT911_Device *touch_device = params->touch_device;
 
-    // 前回のステータス値を保存する変数
-    uint8_t last_status = 0;
-    // 描画した円の数をカウント
-    int circle_count = 0;
+    // タッチした回数をカウント（指が離れるまでを1回とする）
+    int touch_count = 0;
+    bool touching = false;
 
     int width = epd_wrapper_get_width(epd);
     int height = epd_wrapper_get_height(epd);
 
+    // 割り込みが使えない場合は一定間隔でタッチデータを読み取る
+    bool use_interrupt = gt911_is_interrupt_enabled(touch_device);
+    if (!use_interrupt)
+    {
+        ESP_LOGW(TAG, "Touch interrupt is not available, polling every %d ms", TOUCH_POLL_INTERVAL_MS);
+    }
+
     ESP_LOGI(TAG, "Touch handling task started");
 
-    // メインループ - ポーリングでタッチ検出
+    // メインループ - 読み取られたタッチイベントを処理
     while (params->running)
     {
-        // ステータスレジスタを読み取り
-        uint8_t status;
-        if (gt911_read_registers(touch_device, GT911_REG_STATUS, &status, 1))
+        GT911_TouchEvent event;
+        if (use_interrupt)
+        {
+            if (!gt911_get_event(touch_device, &event, portMAX_DELAY))
+            {
+                continue;
+            }
+        }
+        else
         {
-            // ステータスの変化を確認
-            if (status != last_status)
+            vTaskDelay(TOUCH_POLL_INTERVAL_MS / portTICK_PERIOD_MS);
+            if (!poll_touch_event(touch_device, &event))
             {
-                ESP_LOGI(TAG, "Status register changed: 0x%02X -> 0x%02X", last_status, status);
-                last_status = status;
+                continue;
             }
+        }
 
-            // タッチイベントが検出された場合
-            if (status & GT911_STATUS_TOUCH)
+        // 溜まっているイベントをまとめて描画してから1回だけ画面を更新する
+        int drawn = 0;
+        do
+        {
+            if (event.point_count > 0 && !touching)
             {
-                // タッチポイント数を取得
-                uint8_t touch_points = status & GT911_STATUS_TOUCH_MASK;
-                if (touch_points > GT911_MAX_TOUCH_POINTS)
-                {
-                    touch_points = GT911_MAX_TOUCH_POINTS;
-                }
+                touch_count++;
+                // 円を描いている間に電源を立ち上げておく
+                epd_wrapper_power_prewarm(epd);
+            }
+            touching = event.point_count > 0;
 
-                ESP_LOGI(TAG, "Touch detected: %d point(s)", touch_points);
+            for (uint8_t i = 0; i < event.point_count; i++)
+            {
+                uint16_t raw_x = event.points[i].x;
+                uint16_t raw_y = event.points[i].y;
+
+                // 90度時計回りのずれを補正（座標変換）
+                uint16_t adjusted_x = raw_y;
+                uint16_t adjusted_y = width - raw_x - 426;
 
-                // すべてのタッチポイントを処理
-                for (uint8_t i = 0; i < touch_points; i++)
+                // 補正後の座標が範囲内かチェック
+                if (adjusted_x < width && adjusted_y < height)
                 {
-                    uint8_t point_data[8];                            // 各ポイントのデータは8バイト
-                    uint16_t point_addr = GT911_REG_TOUCH1 + (i * 8); // 各ポイントのアドレス計算
-
-                    if (gt911_read_registers(touch_device, point_addr, point_data, 8))
-                    {
-                        // X座標と Y座標を取得 (リトルエンディアン)
-                        uint16_t raw_x = point_data[0] | (point_data[1] << 8);
-                        uint16_t raw_y = point_data[2] | (point_data[3] << 8);
-
-                        // サイズも取得できる場合
-                        uint16_t size = point_data[4] | (point_data[5] << 8);
-
-                        ESP_LOGI(TAG, "Raw touch point %d: x=%d, y=%d, size=%d", i, raw_x, raw_y, size);
-
-                        // 90度時計回りのずれを補正（座標変換）
-                        uint16_t adjusted_x = raw_y;
-                        uint16_t adjusted_y = width - raw_x - 426;
-
-                        // 補正後の座標が範囲内かチェック
-                        if (adjusted_x < width && adjusted_y < height)
-                        {
-                            ESP_LOGI(TAG, "Adjusted touch point %d: x=%d, y=%d", i, adjusted_x, adjusted_y);
-
-                            // タッチ位置に円を描画（補正後の座標を使用）
-                            epd_wrapper_fill_circle(epd, adjusted_x, adjusted_y, 10, 0x00); // 黒い円を描画
-                            circle_count++;
-
-                            // 画面を更新 (部分更新モードを使用)
-                            epd_wrapper_update_screen(epd, MODE_DU);
-                        }
-                        else
-                        {
-                            ESP_LOGW(TAG, "Adjusted coordinates out of bounds: (%d, %d)", adjusted_x, adjusted_y);
-                        }
-                    }
+                    ESP_LOGD(TAG, "Touch point %d: raw=(%d, %d) adjusted=(%d, %d) latency=%lld us",
+                             i, raw_x, raw_y, adjusted_x, adjusted_y,
+                             (long long)(esp_timer_get_time() - event.timestamp_us));
+
+                    // タッチ位置に円を描画（補正後の座標を使用）
+                    // 円はディスプレイリストに保持せず、消すときに描き直す領域として記録する
+                    epd_wrapper_fill_circle(epd, adjusted_x, adjusted_y, 10, 0x00); // 黒い円を描画
+                    epd_scene_invalidate(scene, adjusted_x - 10, adjusted_y - 10, 21, 21);
+                    drawn++;
+                }
+                else
+                {
+                    ESP_LOGW(TAG, "Adjusted coordinates out of bounds: (%d, %d)", adjusted_x, adjusted_y);
                 }
-
-                // ステータスレジスタをクリア
-                gt911_clear_status(touch_device);
             }
-        }
-        else
+        } while (use_interrupt && gt911_get_event(touch_device, &event, 0));
+
+        if (drawn > 0)
         {
-            ESP_LOGW(TAG, "Failed to read status register");
+            // 円を描いた領域だけを更新（黒白だけの変化なのでDUが選ばれる）
+            epd_wrapper_update_dirty(epd, EPD_WRAPPER_MODE_AUTO);
         }
 
-        // 10個の円を描画したら画面をクリア
-        if (circle_count >= 10)
+        // 10回タッチしたら、指が離れたところで円を消す
+        // （円を描いた領域だけを背景と枠で描き直し、その部分だけを更新する）
+        if (touch_count >= 10 && !touching)
         {
-            ESP_LOGI(TAG, "Clearing screen after %d circles", circle_count);
-            epd_wrapper_fill(epd, 0xFF); // 白で塗りつぶし
-            epd_wrapper_draw_rect(epd, 10, 10, width - 20, height - 20, 0x00);
-            epd_wrapper_update_screen(epd, MODE_GC16);
-            circle_count = 0;
+            ESP_LOGI(TAG, "Clearing circles after %d touches", touch_count);
+            epd_scene_render(scene);
+            epd_wrapper_update_dirty(epd, EPD_WRAPPER_MODE_AUTO);
+            touch_count = 0;
         }
-
-        // ポーリング間隔
-        vTaskDelay(50 / portTICK_PERIOD_MS);
     }
 
     // タスク終了
@@ -480,7 +530,7 @@ void draw_sprash(EPDWrapper *epd)
     int logo_x = center_x - (LOGO_WIDTH / 2);
     int logo_y = center_y - (LOGO_HEIGHT / 2);
     uint8_t transparent_color = 0x0F;
-    epd_wrapper_draw_rotated_image_with_transparency(epd, logo_x, logo_y, LOGO_WIDTH, LOGO_HEIGHT, logo_data, true, true, transparent_color);
+    epd_rle_draw(epd, logo_x, logo_y, &logo_rle, true, transparent_color);
 
     // epd_wrapper_draw_rotated_image(&epd, 20, 20, LOGO_WIDTH, LOGO_HEIGHT, logo_data, true);
 
@@ -491,7 +541,7 @@ void draw_sprash(EPDWrapper *epd)
     ESP_LOGI(TAG, "Display update complete");
 }
 
-void transition(EPDWrapper *epd, const uint8_t *image_data, TransitionType type)
+void transition(EPDWrapper *epd, const EPDRleImage *image, TransitionType type)
 {
     ESP_LOGI(TAG, "Starting transition with type %d", type);
 
@@ -522,79 +572,17 @@ void transition(EPDWrapper *epd, const uint8_t *image_data, TransitionType type)
     ESP_LOGI(TAG, "Current display rotation: %d", rotation);
 
     // 画像データ直接指定の場合
-    if (image_data != NULL)
+    if (image != NULL)
     {
-        // まず次のフレームバッファを白でクリア
+        // 画像より画面が大きい場合に備えて白でクリアしてから、回転しながら1行ずつ展開する
         memset(next_fb, 0xFF, display_width * display_height / 2);
-
-        // 回転に応じて処理を分岐
-        if (rotation != 0)
-        {
-            // 回転が必要な場合は一時バッファに回転済みデータを作成
-            size_t image_bytes = display_width * display_height / 2;
-            uint8_t *rotated_data = heap_caps_malloc(image_bytes, MALLOC_CAP_8BIT);
-
-            if (rotated_data != NULL)
-            {
-                // 一時バッファをクリア（回転処理で使用するビット操作のため重要）
-                memset(rotated_data, 0, image_bytes);
-
-                // 回転元のサイズと回転後のサイズが異なる可能性に注意
-                int src_width, src_height;
-
-                // 回転に応じて元の幅と高さを設定
-                if (rotation == 1 || rotation == 3)
-                {
-                    // 90度/270度回転の場合は幅と高さが入れ替わる
-                    src_width = EPD_DISPLAY_HEIGHT;
-                    src_height = EPD_DISPLAY_WIDTH;
-                }
-                else
-                {
-                    src_width = EPD_DISPLAY_WIDTH;
-                    src_height = EPD_DISPLAY_HEIGHT;
-                }
-
-                ESP_LOGI(TAG, "Rotating image data: src=%dx%d, rotation=%d",
-                         src_width, src_height, rotation);
-
-                // 画像データを回転
-                if (rotate_image_data(image_data, src_width, src_height, rotation, rotated_data) != 0)
-                {
-                    ESP_LOGE(TAG, "Failed to rotate image data");
-                    heap_caps_free(rotated_data);
-                    epd_transition_deinit(epd, &transition);
-                    return;
-                }
-
-                // 回転済みデータをフレームバッファBにコピー
-                memcpy(next_fb, rotated_data, image_bytes);
-
-                // 一時バッファを解放
-                heap_caps_free(rotated_data);
-                ESP_LOGI(TAG, "Image data rotated and copied to next framebuffer");
-            }
-            else
-            {
-                ESP_LOGE(TAG, "Failed to allocate memory for rotated image data");
-                epd_transition_deinit(epd, &transition);
-                return;
-            }
-        }
-        else
+        if (!epd_rle_decode_to_framebuffer(image, 0, 0, rotation, next_fb))
         {
-            // 回転なしの場合は直接コピー
-            // 全画面用の矩形を定義
-            EpdRect image_area = {
-                .x = 0,
-                .y = 0,
-                .width = display_width,
-                .height = display_height};
-
-            // 画像データをnext_fbにコピー
-            epd_copy_to_framebuffer(image_area, image_data, next_fb);
-            ESP_LOGI(TAG, "Copied image data to next_fb without rotation");
+            ESP_LOGE(TAG, "Failed to decode image data");
+            epd_transition_deinit(epd, &transition);
+            return;
         }
+        ESP_LOGI(TAG, "Image data decoded into next framebuffer");
     }
     else
     {
@@ -636,7 +624,7 @@ void test_text_display(EPDWrapper *epd)
     // テキスト設定の初期化
     ESP_LOGI(TAG, "Initializing text configuration");
     EPDTextConfig text_config;
-    epd_text_config_init(&text_config, &Mplus2_Light_16);
+    epd_text_config_init(&text_config, g_font);
 
     // テキスト色を黒に設定
     text_config.text_color = 0x00;
@@ -718,7 +706,7 @@ void test_text_drawing(EPDWrapper *wrapper)
 
     // テキスト設定の初期化
     EPDTextConfig text_config;
-    epd_text_config_init(&text_config, &Mplus2_Light_16);
+    epd_text_config_init(&text_config, g_font);
 
     // 表示領域の取得
     int display_width = epd_wrapper_get_width(wrapper);
@@ -781,7 +769,7 @@ void test_multiline_text(EPDWrapper *wrapper)
 
     // テキスト設定の初期化
     EPDTextConfig text_config;
-    epd_text_config_init(&text_config, &Mplus2_Light_16);
+    epd_text_config_init(&text_config, g_font);
 
     // ディスプレイサイズを取得
     int display_width = epd_wrapper_get_width(wrapper);
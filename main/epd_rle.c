@@ -0,0 +1,524 @@
+/**
+ * @file epd_rle.c
+ * @brief 圧縮した4ビット/ピクセル画像の展開
+ */
+
+#include <string.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "epd_rle.h"
+
+static const char *TAG = "epd_rle";
+
+#define RLE_WHITE 0x0F
+
+/**
+ * @brief 1行ずつ展開するための状態
+ */
+typedef struct
+{
+    const uint8_t *p;   // 次に読む位置
+    const uint8_t *end; // 圧縮データの終端
+    int width;          // 画像の幅
+} RleReader;
+
+/**
+ * @brief 展開した行をフレームバッファへ書き込むための情報
+ */
+typedef struct
+{
+    uint8_t *framebuffer;      // 書き込み先
+    int x;                     // 画像の左上X座標（論理座標）
+    int y;                     // 画像の左上Y座標（論理座標）
+    int rotation;              // 回転（0-3）
+    EpdRect clip;              // 書き込みを許可する範囲（フレームバッファ座標）
+    bool transparent;          // transparent_colorのピクセルを書き込まない
+    uint8_t transparent_color; // 透明とする色
+} RleTarget;
+
+static inline void put_nibble(uint8_t *row, int x, uint8_t value)
+{
+    uint8_t *p = row + x / 2;
+    if (x % 2 == 0)
+    {
+        *p = (*p & 0xF0) | value;
+    }
+    else
+    {
+        *p = (*p & 0x0F) | (value << 4);
+    }
+}
+
+static inline uint8_t get_nibble(const uint8_t *data, int index)
+{
+    return (index % 2 == 0) ? (data[index / 2] & 0x0F) : (data[index / 2] >> 4);
+}
+
+/**
+ * @brief 行バッファのx番目からlengthピクセルを同じ色で埋める
+ */
+static void fill_nibbles(uint8_t *row, int x, int length, uint8_t color)
+{
+    int end = x + length;
+    if (x % 2 != 0 && x < end)
+    {
+        put_nibble(row, x, color);
+        x++;
+    }
+    int bytes = (end - x) / 2;
+    memset(row + x / 2, color * 0x11, bytes);
+    x += bytes * 2;
+    if (x < end)
+    {
+        put_nibble(row, x, color);
+    }
+}
+
+/**
+ * @brief 1行分の圧縮データを展開する
+ * @param row 展開先（直前の行の内容が入っていること）
+ * @return 圧縮データが壊れていなければtrue
+ *
+ * 「上の行と同じ」区間は行バッファをそのまま残すだけで済むため、
+ * 直前の行と展開先は同じバッファを使います。
+ */
+static bool decode_row(RleReader *reader, uint8_t *row)
+{
+    const uint8_t *p = reader->p;
+    int x = 0;
+
+    while (x < reader->width)
+    {
+        if (p >= reader->end)
+        {
+            return false;
+        }
+        uint8_t token = *p++;
+        int count;
+
+        if ((token & 0xC0) == 0xC0)
+        {
+            // 上の行と同じ（行バッファの内容をそのまま使う）
+            count = (token & 0x3F) + 1;
+            if (count == 64)
+            {
+                if (p >= reader->end)
+                {
+                    return false;
+                }
+                count = *p++ + 64;
+            }
+            if (x + count > reader->width)
+            {
+                return false;
+            }
+        }
+        else if (token & 0x80)
+        {
+            // リテラル
+            count = (token & 0x3F) + 1;
+            int bytes = (count + 1) / 2;
+            if (x + count > reader->width || p + bytes > reader->end)
+            {
+                return false;
+            }
+            if (x % 2 == 0)
+            {
+                memcpy(row + x / 2, p, count / 2);
+                if (count % 2 != 0)
+                {
+                    put_nibble(row, x + count - 1, p[count / 2] & 0x0F);
+                }
+            }
+            else
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    put_nibble(row, x + i, get_nibble(p, i));
+                }
+            }
+            p += bytes;
+        }
+        else
+        {
+            // ラン
+            count = (token >> 4) + 1;
+            if (count == 8)
+            {
+                if (p >= reader->end)
+                {
+                    return false;
+                }
+                count = *p++ + 8;
+            }
+            if (x + count > reader->width)
+            {
+                return false;
+            }
+            fill_nibbles(row, x, count, token & 0x0F);
+        }
+        x += count;
+    }
+
+    reader->p = p;
+    return true;
+}
+
+/**
+ * @brief 画像の論理座標の矩形をフレームバッファ座標に変換する（epdiyと同じ回転）
+ */
+static EpdRect logical_to_physical(int rotation, int x, int y, int width, int height)
+{
+    EpdRect rect;
+    switch (rotation)
+    {
+    case 1:
+        rect = (EpdRect){EPD_DISPLAY_WIDTH - y - height, x, height, width};
+        break;
+    case 2:
+        rect = (EpdRect){EPD_DISPLAY_WIDTH - x - width, EPD_DISPLAY_HEIGHT - y - height, width, height};
+        break;
+    case 3:
+        rect = (EpdRect){y, EPD_DISPLAY_HEIGHT - x - width, height, width};
+        break;
+    default:
+        rect = (EpdRect){x, y, width, height};
+        break;
+    }
+    return rect;
+}
+
+/**
+ * @brief 2つの矩形の共通部分を求める
+ * @return 共通部分があればtrue
+ */
+static bool intersect(EpdRect a, EpdRect b, EpdRect *result)
+{
+    int x0 = a.x > b.x ? a.x : b.x;
+    int y0 = a.y > b.y ? a.y : b.y;
+    int x1 = (a.x + a.width < b.x + b.width) ? a.x + a.width : b.x + b.width;
+    int y1 = (a.y + a.height < b.y + b.height) ? a.y + a.height : b.y + b.height;
+    if (x1 <= x0 || y1 <= y0)
+    {
+        return false;
+    }
+    *result = (EpdRect){x0, y0, x1 - x0, y1 - y0};
+    return true;
+}
+
+static inline bool is_opaque(const RleTarget *target, uint8_t value)
+{
+    return !target->transparent || value != target->transparent_color;
+}
+
+/**
+ * @brief 0度・180度回転で、展開した1行をフレームバッファの1行に書き込む
+ * @param img_y 画像内の行番号
+ */
+static void write_row_horizontal(const RleTarget *target, const uint8_t *row, int width, int img_y)
+{
+    const EpdRect *clip = &target->clip;
+    int py, px0, dir;
+    if (target->rotation == 0)
+    {
+        py = target->y + img_y;
+        px0 = target->x;
+        dir = 1;
+    }
+    else
+    {
+        py = EPD_DISPLAY_HEIGHT - 1 - (target->y + img_y);
+        px0 = EPD_DISPLAY_WIDTH - 1 - target->x;
+        dir = -1;
+    }
+    if (py < clip->y || py >= clip->y + clip->height)
+    {
+        return;
+    }
+
+    // クリップ矩形に収まる画像内の列範囲 [i0, i1)
+    int i0, i1;
+    if (dir > 0)
+    {
+        i0 = clip->x - px0;
+        i1 = clip->x + clip->width - px0;
+    }
+    else
+    {
+        i0 = px0 - (clip->x + clip->width - 1);
+        i1 = px0 - clip->x + 1;
+    }
+    if (i0 < 0)
+    {
+        i0 = 0;
+    }
+    if (i1 > width)
+    {
+        i1 = width;
+    }
+    if (i0 >= i1)
+    {
+        return;
+    }
+
+    uint8_t *dst = target->framebuffer + py * (EPD_DISPLAY_WIDTH / 2);
+    int i = i0;
+
+    // 0度回転で偶奇が揃っていればバイト単位でコピー
+    if (dir > 0 && !target->transparent && (px0 + i) % 2 == i % 2)
+    {
+        if (i % 2 != 0 && i < i1)
+        {
+            put_nibble(dst, px0 + i, get_nibble(row, i));
+            i++;
+        }
+        int bytes = (i1 - i) / 2;
+        memcpy(dst + (px0 + i) / 2, row + i / 2, bytes);
+        i += bytes * 2;
+    }
+
+    for (; i < i1; i++)
+    {
+        uint8_t value = get_nibble(row, i);
+        if (is_opaque(target, value))
+        {
+            put_nibble(dst, px0 + dir * i, value);
+        }
+    }
+}
+
+/**
+ * @brief 90度・270度回転で、展開した2行をフレームバッファの隣り合う2列に書き込む
+ * @param rows 展開した行（rows[0]が画像のimg_y行目、rows[1]がその次の行。NULLの場合は書き込まない）
+ *
+ * 画像の1行はフレームバッファの1列になるため、2行ずつ処理すると
+ * 同じバイトに入る2ピクセルを1回の書き込みで済ませられます。
+ */
+static void write_rows_vertical(const RleTarget *target, const uint8_t *const rows[2], int width, int img_y)
+{
+    const EpdRect *clip = &target->clip;
+    int px[2], py0, dir;
+    for (int k = 0; k < 2; k++)
+    {
+        int ly = target->y + img_y + k;
+        px[k] = (target->rotation == 1) ? EPD_DISPLAY_WIDTH - 1 - ly : ly;
+    }
+    if (target->rotation == 1)
+    {
+        py0 = target->x;
+        dir = 1;
+    }
+    else
+    {
+        py0 = EPD_DISPLAY_HEIGHT - 1 - target->x;
+        dir = -1;
+    }
+
+    // 各行が書き込まれる列がクリップ矩形に入っているか
+    bool visible[2];
+    for (int k = 0; k < 2; k++)
+    {
+        visible[k] = rows[k] != NULL && px[k] >= clip->x && px[k] < clip->x + clip->width;
+    }
+    if (!visible[0] && !visible[1])
+    {
+        return;
+    }
+
+    // クリップ矩形に収まる画像内の列範囲 [i0, i1)
+    int i0, i1;
+    if (dir > 0)
+    {
+        i0 = clip->y - py0;
+        i1 = clip->y + clip->height - py0;
+    }
+    else
+    {
+        i0 = py0 - (clip->y + clip->height - 1);
+        i1 = py0 - clip->y + 1;
+    }
+    if (i0 < 0)
+    {
+        i0 = 0;
+    }
+    if (i1 > width)
+    {
+        i1 = width;
+    }
+    if (i0 >= i1)
+    {
+        return;
+    }
+
+    // 2列が同じバイトに入る場合は、偶数列の行をlo、奇数列の行をhiとして1バイトで書き込む
+    int lo = (px[0] < px[1]) ? 0 : 1;
+    int hi = 1 - lo;
+    int step = dir * (EPD_DISPLAY_WIDTH / 2);
+    if (visible[0] && visible[1] && px[lo] % 2 == 0 && !target->transparent)
+    {
+        uint8_t *dst = target->framebuffer + (py0 + dir * i0) * (EPD_DISPLAY_WIDTH / 2) + px[lo] / 2;
+        const uint8_t *src_lo = rows[lo];
+        const uint8_t *src_hi = rows[hi];
+        int i = i0;
+        if (i % 2 != 0)
+        {
+            *dst = (src_lo[i / 2] >> 4) | (src_hi[i / 2] & 0xF0);
+            dst += step;
+            i++;
+        }
+        // 両方の行から1バイト（2ピクセル）ずつ読み、縦に並ぶ2バイトを書き込む
+        for (; i + 2 <= i1; i += 2)
+        {
+            uint8_t a = src_lo[i / 2];
+            uint8_t b = src_hi[i / 2];
+            dst[0] = (a & 0x0F) | (b << 4);
+            dst[step] = (a >> 4) | (b & 0xF0);
+            dst += step * 2;
+        }
+        if (i < i1)
+        {
+            *dst = (src_lo[i / 2] & 0x0F) | (src_hi[i / 2] << 4);
+        }
+        return;
+    }
+
+    for (int i = i0; i < i1; i++)
+    {
+        uint8_t *dst_row = target->framebuffer + (py0 + dir * i) * (EPD_DISPLAY_WIDTH / 2);
+        for (int k = 0; k < 2; k++)
+        {
+            if (visible[k])
+            {
+                uint8_t value = get_nibble(rows[k], i);
+                if (is_opaque(target, value))
+                {
+                    put_nibble(dst_row, px[k], value);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief 圧縮画像を展開してフレームバッファに書き込む
+ * @param visible 書き込んだ範囲（フレームバッファ座標）の格納先
+ * @return 圧縮データが壊れていなければtrue（画像が範囲外の場合もtrue）
+ */
+static bool decode_image(const EPDRleImage *image, RleTarget *target, EpdRect *visible)
+{
+    visible->width = 0;
+    visible->height = 0;
+
+    EpdRect area = logical_to_physical(target->rotation, target->x, target->y, image->width, image->height);
+    if (!intersect(area, target->clip, visible))
+    {
+        return true;
+    }
+
+    // 展開用の行バッファ（90度・270度回転では2行分）
+    int row_bytes = (image->width + 1) / 2;
+    uint8_t *buffer = heap_caps_malloc(row_bytes * 2, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (buffer == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate row buffer");
+        return false;
+    }
+    uint8_t *rows[2] = {buffer, buffer + row_bytes};
+    memset(rows[1], RLE_WHITE * 0x11, row_bytes);
+
+    RleReader reader = {
+        .p = image->data,
+        .end = image->data + image->data_len,
+        .width = image->width,
+    };
+
+    bool vertical = (target->rotation == 1 || target->rotation == 3);
+    bool ok = true;
+    for (int img_y = 0; img_y < image->height && ok; img_y += vertical ? 2 : 1)
+    {
+        if (!vertical)
+        {
+            ok = decode_row(&reader, rows[1]);
+            if (ok)
+            {
+                write_row_horizontal(target, rows[1], image->width, img_y);
+            }
+            continue;
+        }
+
+        // 直前の行を引き継いでから次の2行を展開する
+        memcpy(rows[0], rows[1], row_bytes);
+        ok = decode_row(&reader, rows[0]);
+        const uint8_t *pair[2] = {rows[0], NULL};
+        if (ok && img_y + 1 < image->height)
+        {
+            memcpy(rows[1], rows[0], row_bytes);
+            ok = decode_row(&reader, rows[1]);
+            pair[1] = rows[1];
+        }
+        if (ok)
+        {
+            write_rows_vertical(target, pair, image->width, img_y);
+        }
+    }
+
+    heap_caps_free(buffer);
+    if (!ok)
+    {
+        ESP_LOGE(TAG, "Corrupt RLE data (%ux%u, %u bytes)",
+                 (unsigned)image->width, (unsigned)image->height, (unsigned)image->data_len);
+    }
+    return ok;
+}
+
+bool epd_rle_draw(EPDWrapper *wrapper, int x, int y, const EPDRleImage *image,
+                  bool use_transparency, uint8_t transparent_color)
+{
+    uint8_t *framebuffer = epd_wrapper_get_framebuffer(wrapper);
+    if (framebuffer == NULL || image == NULL || image->data == NULL)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not properly initialized or invalid image data");
+        return false;
+    }
+
+    RleTarget target = {
+        .framebuffer = framebuffer,
+        .x = x,
+        .y = y,
+        .rotation = epd_wrapper_get_rotation(wrapper),
+        .clip = epd_wrapper_get_clip(wrapper),
+        .transparent = use_transparency,
+        .transparent_color = transparent_color & 0x0F,
+    };
+
+    EpdRect visible;
+    bool ok = decode_image(image, &target, &visible);
+    if (visible.width > 0 && visible.height > 0)
+    {
+        epd_wrapper_mark_dirty(wrapper, visible.x, visible.y, visible.width, visible.height);
+    }
+    return ok;
+}
+
+bool epd_rle_decode_to_framebuffer(const EPDRleImage *image, int x, int y, int rotation,
+                                   uint8_t *framebuffer)
+{
+    if (image == NULL || image->data == NULL || framebuffer == NULL || rotation < 0 || rotation > 3)
+    {
+        ESP_LOGE(TAG, "Invalid parameters");
+        return false;
+    }
+
+    RleTarget target = {
+        .framebuffer = framebuffer,
+        .x = x,
+        .y = y,
+        .rotation = rotation,
+        .clip = {.x = 0, .y = 0, .width = EPD_DISPLAY_WIDTH, .height = EPD_DISPLAY_HEIGHT},
+        .transparent = false,
+        .transparent_color = 0,
+    };
+
+    EpdRect visible;
+    return decode_image(image, &target, &visible);
+}
@@ -0,0 +1,67 @@
+/**
+ * @file epd_rle.h
+ * @brief 圧縮した4ビット/ピクセル画像の展開
+ *
+ * appendix/png2heder/p2h.py の --rle（または rle4.py）で生成した画像を、
+ * 画像全体の一時バッファを使わずに1行ずつ展開してフレームバッファへ直接書き込みます。
+ *
+ * 形式は行単位のバイト列で、各行は次の符号の並びです（行をまたぐ符号はありません）。
+ *   0x00-0x7F  ラン      : 下位4ビットが色、ビット4-6の n が長さ
+ *                          （n < 7 の場合は n + 1、n == 7 の場合は次の1バイト + 8）
+ *   0x80-0xBF  リテラル  : 下位6ビット + 1 ピクセルの生データが続く
+ *                          （(個数 + 1) / 2 バイト、偶数ピクセルが下位4ビット）
+ *   0xC0-0xFF  上の行と同じ : 下位6ビットの n が長さ
+ *                          （n < 63 の場合は n + 1、n == 63 の場合は次の1バイト + 64）
+ * 先頭行の「上の行」は白（0x0F）として扱います。
+ */
+
+#ifndef EPD_RLE_H
+#define EPD_RLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "epd_wrapper.h"
+
+/**
+ * @brief 圧縮画像
+ */
+typedef struct
+{
+    uint16_t width;        // 幅（ピクセル）
+    uint16_t height;       // 高さ（ピクセル）
+    uint32_t data_len;     // 圧縮データのバイト数
+    const uint8_t *data;   // 圧縮データ
+} EPDRleImage;
+
+/**
+ * @brief 圧縮画像を描画する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param x 左上X座標（回転後の論理座標）
+ * @param y 左上Y座標（回転後の論理座標）
+ * @param image 圧縮画像
+ * @param use_transparency 透明処理を有効にするかどうか
+ * @param transparent_color 透明とする色（0-15の値）
+ * @return 展開できた場合はtrue（圧縮データが壊れている場合はfalse）
+ *
+ * 画像は表示の回転に合わせて回転し、クリップ矩形の内側だけに描画されます。
+ * 描画した範囲はダーティ矩形として記録されます。
+ */
+bool epd_rle_draw(EPDWrapper *wrapper, int x, int y, const EPDRleImage *image,
+                  bool use_transparency, uint8_t transparent_color);
+
+/**
+ * @brief 圧縮画像を任意のフレームバッファに展開する
+ * @param image 圧縮画像
+ * @param x 左上X座標（回転後の論理座標）
+ * @param y 左上Y座標（回転後の論理座標）
+ * @param rotation 回転（0:0度, 1:90度, 2:180度, 3:270度）
+ * @param framebuffer 展開先（960x540、4ビット/ピクセル）
+ * @return 展開できた場合はtrue（圧縮データが壊れている場合はfalse）
+ *
+ * トランジションの次画面など、EPDラッパーのフレームバッファ以外に展開する場合に使います。
+ * 画面外にはみ出した部分は書き込まれません。
+ */
+bool epd_rle_decode_to_framebuffer(const EPDRleImage *image, int x, int y, int rotation,
+                                   uint8_t *framebuffer);
+
+#endif // EPD_RLE_H
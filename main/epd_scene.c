@@ -0,0 +1,602 @@
+/**
+ * @file epd_scene.c
+ * @brief 描画内容を保持するディスプレイリスト
+ */
+
+#include <string.h>
+#include "esp_log.h"
+#include "epd_scene.h"
+
+static const char *TAG = "epd_scene";
+
+/**
+ * @brief 2つの矩形が重なるか、指定距離以内に隣接しているかどうか
+ */
+static bool rect_near(EpdRect a, EpdRect b, int gap)
+{
+    return a.x - gap < b.x + b.width && b.x - gap < a.x + a.width &&
+           a.y - gap < b.y + b.height && b.y - gap < a.y + a.height;
+}
+
+/**
+ * @brief 2つの矩形の和（外接矩形）を求める
+ */
+static EpdRect rect_union(EpdRect a, EpdRect b)
+{
+    int x0 = a.x < b.x ? a.x : b.x;
+    int y0 = a.y < b.y ? a.y : b.y;
+    int x1 = (a.x + a.width) > (b.x + b.width) ? (a.x + a.width) : (b.x + b.width);
+    int y1 = (a.y + a.height) > (b.y + b.height) ? (a.y + a.height) : (b.y + b.height);
+
+    EpdRect result = {
+        .x = x0,
+        .y = y0,
+        .width = x1 - x0,
+        .height = y1 - y0};
+    return result;
+}
+
+/**
+ * @brief 使用中のノードを取得する
+ * @return ノード（IDが無効な場合はNULL）
+ */
+static EPDSceneNode *get_node(EPDScene *scene, int id)
+{
+    if (scene == NULL || id < 0 || id >= EPD_SCENE_MAX_NODES ||
+        scene->nodes[id].type == EPD_SCENE_NODE_NONE)
+    {
+        return NULL;
+    }
+    return &scene->nodes[id];
+}
+
+/**
+ * @brief ノードが描画する範囲（回転後の論理座標）
+ */
+static EpdRect node_bounds(const EPDSceneNode *node)
+{
+    EpdRect rect = {
+        .x = node->x,
+        .y = node->y,
+        .width = node->width,
+        .height = node->height};
+    if (node->type == EPD_SCENE_NODE_CIRCLE)
+    {
+        rect.x = node->x - node->radius;
+        rect.y = node->y - node->radius;
+        rect.width = node->radius * 2 + 1;
+        rect.height = node->radius * 2 + 1;
+    }
+    return rect;
+}
+
+/**
+ * @brief ノードが描画する範囲（フレームバッファ座標系、回転なし）
+ *
+ * epd_text の描画関数は回転に関係なくフレームバッファ座標で描画するため、
+ * テキストは変換しません。
+ */
+static EpdRect node_physical_bounds(EPDScene *scene, const EPDSceneNode *node)
+{
+    EpdRect rect = node_bounds(node);
+    if (node->type == EPD_SCENE_NODE_TEXT)
+    {
+        return rect;
+    }
+    return epd_wrapper_to_physical_rect(scene->wrapper, rect);
+}
+
+/**
+ * @brief 損傷領域を記録する
+ * @param rect 領域（フレームバッファ座標系、回転なし）
+ *
+ * EPDラッパーのダーティ矩形と同じく、重なる・近接する領域を統合し、
+ * 空きがない場合は面積の増加が最も小さい領域と統合します。
+ */
+static void add_damage(EPDScene *scene, EpdRect rect)
+{
+    int x0 = rect.x < 0 ? 0 : rect.x;
+    int y0 = rect.y < 0 ? 0 : rect.y;
+    int x1 = rect.x + rect.width;
+    int y1 = rect.y + rect.height;
+    if (x1 > EPD_DISPLAY_WIDTH)
+    {
+        x1 = EPD_DISPLAY_WIDTH;
+    }
+    if (y1 > EPD_DISPLAY_HEIGHT)
+    {
+        y1 = EPD_DISPLAY_HEIGHT;
+    }
+    if (x1 <= x0 || y1 <= y0)
+    {
+        return;
+    }
+    rect = (EpdRect){.x = x0, .y = y0, .width = x1 - x0, .height = y1 - y0};
+
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (int i = 0; i < scene->damage_count; i++)
+        {
+            if (rect_near(scene->damage[i], rect, EPD_SCENE_DAMAGE_MERGE_GAP))
+            {
+                rect = rect_union(rect, scene->damage[i]);
+                scene->damage[i] = scene->damage[--scene->damage_count];
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    if (scene->damage_count < EPD_SCENE_MAX_DAMAGE_RECTS)
+    {
+        scene->damage[scene->damage_count++] = rect;
+        return;
+    }
+
+    int best = 0;
+    long best_growth = -1;
+    for (int i = 0; i < scene->damage_count; i++)
+    {
+        EpdRect u = rect_union(scene->damage[i], rect);
+        long growth = (long)u.width * u.height -
+                      (long)scene->damage[i].width * scene->damage[i].height;
+        if (best_growth < 0 || growth < best_growth)
+        {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    scene->damage[best] = rect_union(scene->damage[best], rect);
+}
+
+/**
+ * @brief 論理座標の領域を損傷領域として記録する
+ */
+static void add_logical_damage(EPDScene *scene, int x, int y, int width, int height)
+{
+    if (width <= 0 || height <= 0)
+    {
+        return;
+    }
+    EpdRect rect = {.x = x, .y = y, .width = width, .height = height};
+    add_damage(scene, epd_wrapper_to_physical_rect(scene->wrapper, rect));
+}
+
+/**
+ * @brief ノードが描画する範囲を損傷領域として記録する
+ *
+ * 枠線の矩形は内側を描画しないため、4辺だけを記録します
+ * （画面全体を囲む枠を追加しても内側が描き直されないようにするため）。
+ */
+static void damage_node(EPDScene *scene, const EPDSceneNode *node)
+{
+    if (!node->visible)
+    {
+        return;
+    }
+
+    EpdRect rect = node_bounds(node);
+    if (node->type == EPD_SCENE_NODE_RECT && !node->filled &&
+        rect.width > 2 && rect.height > 2)
+    {
+        add_logical_damage(scene, rect.x, rect.y, rect.width, 1);
+        add_logical_damage(scene, rect.x, rect.y + rect.height - 1, rect.width, 1);
+        add_logical_damage(scene, rect.x, rect.y + 1, 1, rect.height - 2);
+        add_logical_damage(scene, rect.x + rect.width - 1, rect.y + 1, 1, rect.height - 2);
+        return;
+    }
+    add_damage(scene, node_physical_bounds(scene, node));
+}
+
+/**
+ * @brief 重なり順（z、同じ場合は追加順）に並べ直す
+ */
+static void sort_order(EPDScene *scene)
+{
+    for (int i = 1; i < scene->node_count; i++)
+    {
+        int id = scene->order[i];
+        const EPDSceneNode *node = &scene->nodes[id];
+        int j = i - 1;
+        while (j >= 0)
+        {
+            const EPDSceneNode *prev = &scene->nodes[scene->order[j]];
+            if (prev->z < node->z || (prev->z == node->z && prev->seq < node->seq))
+            {
+                break;
+            }
+            scene->order[j + 1] = scene->order[j];
+            j--;
+        }
+        scene->order[j + 1] = id;
+    }
+}
+
+/**
+ * @brief 空きノードを確保して共通の項目を設定する
+ * @return ノードID（空きがない場合は-1）
+ */
+static int alloc_node(EPDScene *scene, EPDSceneNodeType type, int x, int y, int width, int height, int z)
+{
+    if (scene == NULL || scene->wrapper == NULL)
+    {
+        return -1;
+    }
+
+    for (int id = 0; id < EPD_SCENE_MAX_NODES; id++)
+    {
+        EPDSceneNode *node = &scene->nodes[id];
+        if (node->type != EPD_SCENE_NODE_NONE)
+        {
+            continue;
+        }
+
+        memset(node, 0, sizeof(*node));
+        node->type = type;
+        node->visible = true;
+        node->z = z;
+        node->seq = scene->next_seq++;
+        node->x = x;
+        node->y = y;
+        node->width = width;
+        node->height = height;
+        scene->order[scene->node_count++] = id;
+        return id;
+    }
+
+    ESP_LOGE(TAG, "Scene is full (max %d nodes)", EPD_SCENE_MAX_NODES);
+    return -1;
+}
+
+/**
+ * @brief 追加したノードを並べ直して損傷領域を記録する
+ */
+static int commit_node(EPDScene *scene, int id)
+{
+    if (id >= 0)
+    {
+        sort_order(scene);
+        damage_node(scene, &scene->nodes[id]);
+    }
+    return id;
+}
+
+/**
+ * @brief ノードを1つ描画する（クリップ矩形は呼び出し側で設定済み）
+ */
+static void draw_node(EPDScene *scene, const EPDSceneNode *node)
+{
+    EPDWrapper *wrapper = scene->wrapper;
+    switch (node->type)
+    {
+    case EPD_SCENE_NODE_RECT:
+        if (node->filled)
+        {
+            epd_wrapper_fill_rect(wrapper, node->x, node->y, node->width, node->height, node->color);
+        }
+        else
+        {
+            epd_wrapper_draw_rect(wrapper, node->x, node->y, node->width, node->height, node->color);
+        }
+        break;
+    case EPD_SCENE_NODE_CIRCLE:
+        if (node->filled)
+        {
+            epd_wrapper_fill_circle(wrapper, node->x, node->y, node->radius, node->color);
+        }
+        else
+        {
+            epd_wrapper_draw_circle(wrapper, node->x, node->y, node->radius, node->color);
+        }
+        break;
+    case EPD_SCENE_NODE_IMAGE:
+        epd_wrapper_draw_image_rows(wrapper, node->x, node->y, node->width, node->height,
+                                    node->image_data, node->use_transparency, node->transparent_color);
+        break;
+    case EPD_SCENE_NODE_RLE_IMAGE:
+        epd_rle_draw(wrapper, node->x, node->y, node->rle_image,
+                     node->use_transparency, node->transparent_color);
+        break;
+    case EPD_SCENE_NODE_TEXT:
+    {
+        EpdRect rect = node_bounds(node);
+        epd_text_draw_multiline(wrapper, &rect, node->text, &node->text_config);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void epd_scene_init(EPDScene *scene, EPDWrapper *wrapper, uint8_t background)
+{
+    if (scene == NULL)
+    {
+        return;
+    }
+    memset(scene, 0, sizeof(*scene));
+    scene->wrapper = wrapper;
+    scene->background = background;
+}
+
+int epd_scene_add_rect(EPDScene *scene, int x, int y, int width, int height,
+                       uint8_t color, bool filled, int z)
+{
+    int id = alloc_node(scene, EPD_SCENE_NODE_RECT, x, y, width, height, z);
+    if (id >= 0)
+    {
+        scene->nodes[id].color = color;
+        scene->nodes[id].filled = filled;
+    }
+    return commit_node(scene, id);
+}
+
+int epd_scene_add_circle(EPDScene *scene, int x, int y, int radius,
+                         uint8_t color, bool filled, int z)
+{
+    int id = alloc_node(scene, EPD_SCENE_NODE_CIRCLE, x, y, 0, 0, z);
+    if (id >= 0)
+    {
+        scene->nodes[id].radius = radius;
+        scene->nodes[id].color = color;
+        scene->nodes[id].filled = filled;
+    }
+    return commit_node(scene, id);
+}
+
+int epd_scene_add_image(EPDScene *scene, int x, int y, int width, int height,
+                        const uint8_t *image_data, bool use_transparency,
+                        uint8_t transparent_color, int z)
+{
+    if (image_data == NULL)
+    {
+        return -1;
+    }
+    int id = alloc_node(scene, EPD_SCENE_NODE_IMAGE, x, y, width, height, z);
+    if (id >= 0)
+    {
+        scene->nodes[id].image_data = image_data;
+        scene->nodes[id].use_transparency = use_transparency;
+        scene->nodes[id].transparent_color = transparent_color;
+    }
+    return commit_node(scene, id);
+}
+
+int epd_scene_add_rle_image(EPDScene *scene, int x, int y, const EPDRleImage *image,
+                            bool use_transparency, uint8_t transparent_color, int z)
+{
+    if (image == NULL)
+    {
+        return -1;
+    }
+    int id = alloc_node(scene, EPD_SCENE_NODE_RLE_IMAGE, x, y, image->width, image->height, z);
+    if (id >= 0)
+    {
+        scene->nodes[id].rle_image = image;
+        scene->nodes[id].use_transparency = use_transparency;
+        scene->nodes[id].transparent_color = transparent_color;
+    }
+    return commit_node(scene, id);
+}
+
+int epd_scene_add_text(EPDScene *scene, EpdRect rect, const char *text,
+                       const EPDTextConfig *config, int z)
+{
+    if (text == NULL || config == NULL || config->font == NULL)
+    {
+        return -1;
+    }
+    int id = alloc_node(scene, EPD_SCENE_NODE_TEXT, rect.x, rect.y, rect.width, rect.height, z);
+    if (id >= 0)
+    {
+        scene->nodes[id].text = text;
+        scene->nodes[id].text_config = *config;
+    }
+    return commit_node(scene, id);
+}
+
+void epd_scene_remove(EPDScene *scene, int id)
+{
+    EPDSceneNode *node = get_node(scene, id);
+    if (node == NULL)
+    {
+        return;
+    }
+
+    damage_node(scene, node);
+    node->type = EPD_SCENE_NODE_NONE;
+
+    // 並び順を保ったまま取り除く
+    int j = 0;
+    for (int i = 0; i < scene->node_count; i++)
+    {
+        if (scene->order[i] != id)
+        {
+            scene->order[j++] = scene->order[i];
+        }
+    }
+    scene->node_count = j;
+}
+
+void epd_scene_clear(EPDScene *scene)
+{
+    if (scene == NULL)
+    {
+        return;
+    }
+    while (scene->node_count > 0)
+    {
+        epd_scene_remove(scene, scene->order[scene->node_count - 1]);
+    }
+}
+
+bool epd_scene_set_position(EPDScene *scene, int id, int x, int y)
+{
+    EPDSceneNode *node = get_node(scene, id);
+    if (node == NULL)
+    {
+        return false;
+    }
+    if (node->x == x && node->y == y)
+    {
+        return true;
+    }
+
+    damage_node(scene, node);
+    node->x = x;
+    node->y = y;
+    damage_node(scene, node);
+    return true;
+}
+
+bool epd_scene_set_size(EPDScene *scene, int id, int width, int height)
+{
+    EPDSceneNode *node = get_node(scene, id);
+    if (node == NULL || (node->type != EPD_SCENE_NODE_RECT && node->type != EPD_SCENE_NODE_TEXT))
+    {
+        return false;
+    }
+    if (node->width == width && node->height == height)
+    {
+        return true;
+    }
+
+    damage_node(scene, node);
+    node->width = width;
+    node->height = height;
+    damage_node(scene, node);
+    return true;
+}
+
+bool epd_scene_set_color(EPDScene *scene, int id, uint8_t color)
+{
+    EPDSceneNode *node = get_node(scene, id);
+    if (node == NULL || (node->type != EPD_SCENE_NODE_RECT && node->type != EPD_SCENE_NODE_CIRCLE))
+    {
+        return false;
+    }
+    if (node->color != color)
+    {
+        node->color = color;
+        damage_node(scene, node);
+    }
+    return true;
+}
+
+bool epd_scene_set_text(EPDScene *scene, int id, const char *text)
+{
+    EPDSceneNode *node = get_node(scene, id);
+    if (node == NULL || node->type != EPD_SCENE_NODE_TEXT || text == NULL)
+    {
+        return false;
+    }
+    node->text = text;
+    damage_node(scene, node);
+    return true;
+}
+
+bool epd_scene_set_visible(EPDScene *scene, int id, bool visible)
+{
+    EPDSceneNode *node = get_node(scene, id);
+    if (node == NULL)
+    {
+        return false;
+    }
+    if (node->visible != visible)
+    {
+        // 非表示にする場合は変更前、表示する場合は変更後の範囲を記録する
+        node->visible = true;
+        damage_node(scene, node);
+        node->visible = visible;
+    }
+    return true;
+}
+
+bool epd_scene_set_z(EPDScene *scene, int id, int z)
+{
+    EPDSceneNode *node = get_node(scene, id);
+    if (node == NULL)
+    {
+        return false;
+    }
+    if (node->z != z)
+    {
+        node->z = z;
+        sort_order(scene);
+        damage_node(scene, node);
+    }
+    return true;
+}
+
+void epd_scene_invalidate(EPDScene *scene, int x, int y, int width, int height)
+{
+    if (scene == NULL || scene->wrapper == NULL)
+    {
+        return;
+    }
+    add_logical_damage(scene, x, y, width, height);
+}
+
+void epd_scene_invalidate_all(EPDScene *scene)
+{
+    if (scene == NULL || scene->wrapper == NULL)
+    {
+        return;
+    }
+    EpdRect screen = {.x = 0, .y = 0, .width = EPD_DISPLAY_WIDTH, .height = EPD_DISPLAY_HEIGHT};
+    add_damage(scene, screen);
+}
+
+int epd_scene_render(EPDScene *scene)
+{
+    if (scene == NULL || scene->wrapper == NULL || scene->damage_count == 0)
+    {
+        return 0;
+    }
+
+    EPDWrapper *wrapper = scene->wrapper;
+    int width = epd_wrapper_get_width(wrapper);
+    int height = epd_wrapper_get_height(wrapper);
+    int pixels = 0;
+    int redrawn = 0;
+
+    for (int i = 0; i < scene->damage_count; i++)
+    {
+        EpdRect damage = scene->damage[i];
+        if (!epd_wrapper_push_clip(wrapper, damage.x, damage.y, damage.width, damage.height))
+        {
+            continue;
+        }
+
+        // 背景で塗りつぶす（クリップ矩形により損傷領域だけが塗られる）
+        epd_wrapper_fill_rect(wrapper, 0, 0, width, height, scene->background);
+
+        for (int k = 0; k < scene->node_count; k++)
+        {
+            const EPDSceneNode *node = &scene->nodes[scene->order[k]];
+            if (!node->visible)
+            {
+                continue;
+            }
+            if (!rect_near(node_physical_bounds(scene, node), damage, 0))
+            {
+                continue;
+            }
+            draw_node(scene, node);
+            redrawn++;
+        }
+
+        epd_wrapper_pop_clip(wrapper);
+        pixels += damage.width * damage.height;
+    }
+
+    ESP_LOGD(TAG, "Re-rasterised %d rects, %d px (%d.%d%% of screen), %d node draws",
+             scene->damage_count, pixels,
+             pixels * 100 / (EPD_DISPLAY_WIDTH * EPD_DISPLAY_HEIGHT),
+             pixels * 1000 / (EPD_DISPLAY_WIDTH * EPD_DISPLAY_HEIGHT) % 10, redrawn);
+
+    scene->damage_count = 0;
+    return pixels;
+}
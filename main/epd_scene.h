@@ -0,0 +1,286 @@
+/**
+ * @file epd_scene.h
+ * @brief 描画内容を保持するディスプレイリスト
+ *
+ * 矩形・円・画像・テキストをノードとして保持し、重なり順（z）に従って描画します。
+ * ノードを追加・変更・削除すると、変更前後の範囲が「損傷領域」として記録され、
+ * epd_scene_render() は損傷領域をクリップ矩形にして、背景と、その領域に重なる
+ * ノードだけを描き直します。描き直した範囲はEPDラッパーのダーティ矩形になるため、
+ * 続けて epd_wrapper_update_dirty() を呼べば変更箇所だけが更新されます。
+ *
+ * ノードの座標は回転後の論理座標です（テキストのみ、epd_text と同じくフレームバッファ座標）。
+ * 回転を変更した場合は epd_scene_invalidate_all() で画面全体を描き直してください。
+ */
+
+#ifndef EPD_SCENE_H
+#define EPD_SCENE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "epd_wrapper.h"
+#include "epd_text.h"
+#include "epd_rle.h"
+
+/**
+ * @brief 保持できるノードの最大数
+ */
+#ifndef EPD_SCENE_MAX_NODES
+#define EPD_SCENE_MAX_NODES 64
+#endif
+
+/**
+ * @brief 保持する損傷領域の最大数（超えた場合は近い領域と統合する）
+ */
+#ifndef EPD_SCENE_MAX_DAMAGE_RECTS
+#define EPD_SCENE_MAX_DAMAGE_RECTS 8
+#endif
+
+/**
+ * @brief この距離(px)以内の損傷領域は1つに統合する
+ */
+#ifndef EPD_SCENE_DAMAGE_MERGE_GAP
+#define EPD_SCENE_DAMAGE_MERGE_GAP 4
+#endif
+
+/**
+ * @brief ノードの種類
+ */
+typedef enum
+{
+    EPD_SCENE_NODE_NONE = 0,  // 未使用
+    EPD_SCENE_NODE_RECT,      // 矩形（枠線または塗りつぶし）
+    EPD_SCENE_NODE_CIRCLE,    // 円（枠線または塗りつぶし）
+    EPD_SCENE_NODE_IMAGE,     // 4ビット/ピクセルの画像
+    EPD_SCENE_NODE_RLE_IMAGE, // 圧縮画像（epd_rle.h）
+    EPD_SCENE_NODE_TEXT,      // 矩形内の複数行テキスト
+} EPDSceneNodeType;
+
+/**
+ * @brief ノード
+ */
+typedef struct
+{
+    EPDSceneNodeType type; // 種類
+    bool visible;          // 表示するかどうか
+    int z;                 // 重なり順（大きいほど手前）
+    uint32_t seq;          // 追加順（zが同じノードの重なり順）
+
+    // 位置とサイズ（回転後の論理座標、テキストはフレームバッファ座標。円はx, yが中心）
+    int x;
+    int y;
+    int width;
+    int height;
+    int radius;
+
+    // 矩形・円
+    uint8_t color; // 色（0x00=黒、0xFF=白）
+    bool filled;   // 塗りつぶすかどうか
+
+    // 画像
+    const uint8_t *image_data;     // 4ビット/ピクセルの画像データ
+    const EPDRleImage *rle_image;  // 圧縮画像
+    bool use_transparency;         // 透明処理を有効にするかどうか
+    uint8_t transparent_color;     // 透明とする色（0-15）
+
+    // テキスト
+    const char *text;          // UTF-8文字列（ノードが参照している間は解放しないこと）
+    EPDTextConfig text_config; // テキスト描画設定
+} EPDSceneNode;
+
+/**
+ * @brief ディスプレイリスト
+ */
+typedef struct
+{
+    EPDWrapper *wrapper;                        // 描画先
+    uint8_t background;                         // 背景色（0x00=黒、0xFF=白）
+    EPDSceneNode nodes[EPD_SCENE_MAX_NODES];    // ノード（添字がノードID）
+    int order[EPD_SCENE_MAX_NODES];             // 使用中のノードIDを奥から手前の順に並べたもの
+    int node_count;                             // 使用中のノードの数
+    uint32_t next_seq;                          // 次に追加するノードの追加順
+    EpdRect damage[EPD_SCENE_MAX_DAMAGE_RECTS]; // 損傷領域（フレームバッファ座標系、回転なし）
+    int damage_count;                           // 有効な損傷領域の数
+} EPDScene;
+
+/**
+ * @brief ディスプレイリストを初期化する
+ * @param scene 初期化するディスプレイリスト
+ * @param wrapper 描画先のEPDラッパー
+ * @param background 背景色（0x00=黒、0xFF=白）
+ *
+ * 初期化時点のフレームバッファの内容はそのまま残ります。
+ * 画面全体をディスプレイリストの内容にする場合は epd_scene_invalidate_all() を呼んでください。
+ */
+void epd_scene_init(EPDScene *scene, EPDWrapper *wrapper, uint8_t background);
+
+/**
+ * @brief 矩形を追加する
+ * @param scene ディスプレイリスト
+ * @param x 左上X座標
+ * @param y 左上Y座標
+ * @param width 幅
+ * @param height 高さ
+ * @param color 色（0x00=黒、0xFF=白）
+ * @param filled 塗りつぶすかどうか（falseの場合は枠線）
+ * @param z 重なり順（大きいほど手前）
+ * @return ノードID（追加できない場合は-1）
+ */
+int epd_scene_add_rect(EPDScene *scene, int x, int y, int width, int height,
+                       uint8_t color, bool filled, int z);
+
+/**
+ * @brief 円を追加する
+ * @param scene ディスプレイリスト
+ * @param x 中心X座標
+ * @param y 中心Y座標
+ * @param radius 半径
+ * @param color 色（0x00=黒、0xFF=白）
+ * @param filled 塗りつぶすかどうか（falseの場合は円周）
+ * @param z 重なり順（大きいほど手前）
+ * @return ノードID（追加できない場合は-1）
+ */
+int epd_scene_add_circle(EPDScene *scene, int x, int y, int radius,
+                         uint8_t color, bool filled, int z);
+
+/**
+ * @brief 4ビット/ピクセルの画像を追加する
+ * @param scene ディスプレイリスト
+ * @param x 左上X座標
+ * @param y 左上Y座標
+ * @param width 幅
+ * @param height 高さ
+ * @param image_data 画像データ（ノードが参照している間は解放しないこと）
+ * @param use_transparency 透明処理を有効にするかどうか
+ * @param transparent_color 透明とする色（0-15の値）
+ * @param z 重なり順（大きいほど手前）
+ * @return ノードID（追加できない場合は-1）
+ */
+int epd_scene_add_image(EPDScene *scene, int x, int y, int width, int height,
+                        const uint8_t *image_data, bool use_transparency,
+                        uint8_t transparent_color, int z);
+
+/**
+ * @brief 圧縮画像を追加する
+ * @param scene ディスプレイリスト
+ * @param x 左上X座標
+ * @param y 左上Y座標
+ * @param image 圧縮画像（ノードが参照している間は解放しないこと）
+ * @param use_transparency 透明処理を有効にするかどうか
+ * @param transparent_color 透明とする色（0-15の値）
+ * @param z 重なり順（大きいほど手前）
+ * @return ノードID（追加できない場合は-1）
+ */
+int epd_scene_add_rle_image(EPDScene *scene, int x, int y, const EPDRleImage *image,
+                            bool use_transparency, uint8_t transparent_color, int z);
+
+/**
+ * @brief 矩形内に折り返して表示するテキストを追加する
+ * @param scene ディスプレイリスト
+ * @param rect 描画領域（epd_text_draw_multiline() と同じくフレームバッファ座標系）
+ * @param text UTF-8文字列（コピーしないため、ノードが参照している間は解放しないこと）
+ * @param config テキスト描画設定（ノードにコピーされる）
+ * @param z 重なり順（大きいほど手前）
+ * @return ノードID（追加できない場合は-1）
+ */
+int epd_scene_add_text(EPDScene *scene, EpdRect rect, const char *text,
+                       const EPDTextConfig *config, int z);
+
+/**
+ * @brief ノードを削除する
+ * @param scene ディスプレイリスト
+ * @param id ノードID
+ */
+void epd_scene_remove(EPDScene *scene, int id);
+
+/**
+ * @brief すべてのノードを削除する
+ * @param scene ディスプレイリスト
+ */
+void epd_scene_clear(EPDScene *scene);
+
+/**
+ * @brief ノードを移動する
+ * @param scene ディスプレイリスト
+ * @param id ノードID
+ * @param x 新しいX座標（円は中心、それ以外は左上）
+ * @param y 新しいY座標（円は中心、それ以外は左上）
+ * @return 変更できた場合はtrue
+ */
+bool epd_scene_set_position(EPDScene *scene, int id, int x, int y);
+
+/**
+ * @brief 矩形・テキストの大きさを変更する
+ * @param scene ディスプレイリスト
+ * @param id ノードID
+ * @param width 新しい幅
+ * @param height 新しい高さ
+ * @return 変更できた場合はtrue（画像・円の場合はfalse）
+ */
+bool epd_scene_set_size(EPDScene *scene, int id, int width, int height);
+
+/**
+ * @brief 矩形・円の色を変更する
+ * @param scene ディスプレイリスト
+ * @param id ノードID
+ * @param color 新しい色（0x00=黒、0xFF=白）
+ * @return 変更できた場合はtrue
+ */
+bool epd_scene_set_color(EPDScene *scene, int id, uint8_t color);
+
+/**
+ * @brief テキストを変更する
+ * @param scene ディスプレイリスト
+ * @param id ノードID
+ * @param text 新しいUTF-8文字列（コピーしない）
+ * @return 変更できた場合はtrue
+ */
+bool epd_scene_set_text(EPDScene *scene, int id, const char *text);
+
+/**
+ * @brief 表示・非表示を切り替える
+ * @param scene ディスプレイリスト
+ * @param id ノードID
+ * @param visible 表示するかどうか
+ * @return 変更できた場合はtrue
+ */
+bool epd_scene_set_visible(EPDScene *scene, int id, bool visible);
+
+/**
+ * @brief 重なり順を変更する
+ * @param scene ディスプレイリスト
+ * @param id ノードID
+ * @param z 新しい重なり順（大きいほど手前）
+ * @return 変更できた場合はtrue
+ */
+bool epd_scene_set_z(EPDScene *scene, int id, int z);
+
+/**
+ * @brief 指定した領域を損傷領域として記録する
+ * @param scene ディスプレイリスト
+ * @param x 左上X座標（回転後の論理座標）
+ * @param y 左上Y座標（回転後の論理座標）
+ * @param width 幅
+ * @param height 高さ
+ *
+ * ディスプレイリストの外でフレームバッファを書き換えた領域を元に戻す場合に使います。
+ */
+void epd_scene_invalidate(EPDScene *scene, int x, int y, int width, int height);
+
+/**
+ * @brief 画面全体を損傷領域として記録する
+ * @param scene ディスプレイリスト
+ */
+void epd_scene_invalidate_all(EPDScene *scene);
+
+/**
+ * @brief 損傷領域を描き直す
+ * @param scene ディスプレイリスト
+ * @return 描き直したピクセル数（損傷領域がなければ0）
+ *
+ * 損傷領域ごとにクリップ矩形を積み、背景で塗りつぶしてから、
+ * 損傷領域と重なるノードだけを奥から順に描画します。
+ * 損傷領域の記録はクリアされ、描画した範囲はダーティ矩形として記録されます。
+ */
+int epd_scene_render(EPDScene *scene);
+
+#endif // EPD_SCENE_H
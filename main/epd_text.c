@@ -6,13 +6,17 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <inttypes.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_system.h"
 #include "esp_log.h"
 #include "esp_heap_caps.h"
 
 #include "epd_text.h"
+#include "epd_glyph_cache.h"
 
 static const char *TAG = "epd_text";
 
@@ -107,11 +111,247 @@ void epd_text_config_init(EPDTextConfig *config, const FontInfo *font)
     ESP_LOGI(TAG, "Text config initialized with font size %d", font ? font->size : 0);
 }
 
+/**
+ * @brief フォントごとのコードポイント索引
+ *
+ * BMP（U+0000〜U+FFFF）を上位8ビットのページと下位8ビットの
+ * 2段のテーブルで引けるようにする。各要素は chars[] の添字+1（0は未収録）。
+ * ASCII・かなを含むよく使うページは内部RAMに置き、その他はPSRAMに置く。
+ */
+typedef struct
+{
+    const FontInfo *font;                                    // 対象のフォント
+    uint16_t *pages[EPD_TEXT_INDEX_PAGES];                   // ページテーブル（NULLは全て未収録）
+    uint16_t hot_pages[2][EPD_TEXT_INDEX_PAGE_SIZE];         // U+00xx・U+30xx 用（内部RAM）
+    uint16_t *page_block;                                    // その他のページをまとめて確保した領域
+} FontIndex;
+
+// 作成済みの索引（作成を終えてから登録するため、検索はロックなしで読める）
+static FontIndex *font_indexes[EPD_TEXT_MAX_FONT_INDEXES];
+
+/**
+ * @brief 索引の登録・削除を保護するミューテックスを取得する
+ *
+ * 最初に検索したタスクが作成する。複数のタスクが同時に作成した場合は1つだけを残す。
+ */
+static SemaphoreHandle_t get_index_lock(void)
+{
+    static SemaphoreHandle_t index_lock = NULL;
+    SemaphoreHandle_t lock = __atomic_load_n(&index_lock, __ATOMIC_ACQUIRE);
+    if (lock == NULL)
+    {
+        SemaphoreHandle_t created = xSemaphoreCreateMutex();
+        if (created == NULL)
+        {
+            return NULL;
+        }
+        if (__atomic_compare_exchange_n(&index_lock, &lock, created, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        {
+            lock = created;
+        }
+        else
+        {
+            vSemaphoreDelete(created);
+        }
+    }
+    return lock;
+}
+
+/**
+ * @brief フォントの索引を探す
+ *
+ * 索引は数個なので、結果を共有のキャッシュに置かず毎回走査する（複数のタスクから呼ばれるため）。
+ */
+static FontIndex *find_font_index(const FontInfo *font)
+{
+    for (int i = 0; i < EPD_TEXT_MAX_FONT_INDEXES; i++)
+    {
+        FontIndex *index = __atomic_load_n(&font_indexes[i], __ATOMIC_ACQUIRE);
+        if (index != NULL && index->font == font)
+        {
+            return index;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief ページ番号が内部RAMに置くページかどうか
+ * @return hot_pagesの添字。対象外の場合は-1
+ */
+static int hot_page_slot(int page)
+{
+    switch (page)
+    {
+    case 0x00: // ASCII・Latin-1
+        return 0;
+    case 0x30: // CJK記号・ひらがな・カタカナ
+        return 1;
+    default:
+        return -1;
+    }
+}
+
+/**
+ * @brief 索引を作成して登録する（ロックを取得した状態で呼ぶ）
+ */
+static bool build_font_index(const FontInfo *font)
+{
+    if (find_font_index(font) != NULL)
+    {
+        return true;
+    }
+
+    int slot = -1;
+    for (int i = 0; i < EPD_TEXT_MAX_FONT_INDEXES; i++)
+    {
+        if (font_indexes[i] == NULL)
+        {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0)
+    {
+        ESP_LOGW(TAG, "Font index table full, falling back to binary search");
+        return false;
+    }
+
+    FontIndex *index = calloc(1, sizeof(FontIndex));
+    if (index == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate font index");
+        return false;
+    }
+    index->font = font;
+
+    // 使用されているページを数える
+    bool used[EPD_TEXT_INDEX_PAGES] = {false};
+    int cold_pages = 0;
+    for (int i = 0; i < font->chars_count; i++)
+    {
+        uint32_t cp = font->chars[i].code_point;
+        if (cp > 0xFFFF)
+        {
+            continue;
+        }
+        int page = cp >> 8;
+        if (!used[page])
+        {
+            used[page] = true;
+            if (hot_page_slot(page) < 0)
+            {
+                cold_pages++;
+            }
+        }
+    }
+
+    if (cold_pages > 0)
+    {
+        size_t block_size = (size_t)cold_pages * EPD_TEXT_INDEX_PAGE_SIZE * sizeof(uint16_t);
+        index->page_block = heap_caps_calloc(1, block_size, MALLOC_CAP_SPIRAM);
+        if (index->page_block == NULL)
+        {
+            ESP_LOGE(TAG, "Failed to allocate font index pages (%u bytes)", (unsigned)block_size);
+            free(index);
+            return false;
+        }
+    }
+
+    // ページを割り当てる
+    uint16_t *next_page = index->page_block;
+    for (int page = 0; page < EPD_TEXT_INDEX_PAGES; page++)
+    {
+        if (!used[page])
+        {
+            continue;
+        }
+        int hot = hot_page_slot(page);
+        if (hot >= 0)
+        {
+            index->pages[page] = index->hot_pages[hot];
+        }
+        else
+        {
+            index->pages[page] = next_page;
+            next_page += EPD_TEXT_INDEX_PAGE_SIZE;
+        }
+    }
+
+    // 添字を登録（同じコードポイントが複数ある場合は先頭を使う）
+    for (int i = 0; i < font->chars_count; i++)
+    {
+        uint32_t cp = font->chars[i].code_point;
+        if (cp > 0xFFFF)
+        {
+            continue;
+        }
+        uint16_t *entry = &index->pages[cp >> 8][cp & 0xFF];
+        if (*entry == 0)
+        {
+            *entry = (uint16_t)(i + 1);
+        }
+    }
+
+    // 作成を終えてから公開する
+    __atomic_store_n(&font_indexes[slot], index, __ATOMIC_RELEASE);
+    ESP_LOGI(TAG, "Font index built: %d chars, %d PSRAM pages", font->chars_count, cold_pages);
+    return true;
+}
+
+bool epd_text_register_font(const FontInfo *font)
+{
+    if (font == NULL || font->chars == NULL || font->chars_count == 0)
+    {
+        return false;
+    }
+    if (find_font_index(font) != NULL)
+    {
+        return true;
+    }
+
+    SemaphoreHandle_t lock = get_index_lock();
+    if (lock == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create font index lock");
+        return false;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool registered = build_font_index(font);
+    xSemaphoreGive(lock);
+    return registered;
+}
+
+void epd_text_unregister_font(const FontInfo *font)
+{
+    SemaphoreHandle_t lock = get_index_lock();
+    if (lock == NULL)
+    {
+        return;
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (int i = 0; i < EPD_TEXT_MAX_FONT_INDEXES; i++)
+    {
+        FontIndex *index = font_indexes[i];
+        if (index != NULL && index->font == font)
+        {
+            __atomic_store_n(&font_indexes[i], NULL, __ATOMIC_RELEASE);
+            heap_caps_free(index->page_block);
+            free(index);
+        }
+    }
+    xSemaphoreGive(lock);
+}
+
 /**
  * @brief フォントからコードポイントに対応する文字情報を検索する
  * @param font フォント情報
  * @param code_point 検索するUnicodeコードポイント
  * @return 該当する文字情報のポインタ。見つからない場合はNULL
+ *
+ * 索引が登録されていないフォントは初回の検索時に索引を作成します。
+ * 索引を作れない場合やBMP外の文字はバイナリサーチで検索します。
  */
 const FontCharInfo *epd_text_find_char(const FontInfo *font, uint32_t code_point)
 {
@@ -136,6 +376,28 @@ const FontCharInfo *epd_text_find_char(const FontInfo *font, uint32_t code_point
         return &full_sp;
     }
 
+    // 索引で検索（BMP内）
+    if (code_point <= 0xFFFF)
+    {
+        FontIndex *index = find_font_index(font);
+        if (index == NULL && epd_text_register_font(font))
+        {
+            index = find_font_index(font);
+        }
+
+        if (index != NULL)
+        {
+            const uint16_t *page = index->pages[code_point >> 8];
+            uint16_t entry = (page != NULL) ? page[code_point & 0xFF] : 0;
+            if (entry == 0)
+            {
+                ESP_LOGD(TAG, "Character U+%08" PRIX32 " not found in font", code_point);
+                return NULL;
+            }
+            return &font->chars[entry - 1];
+        }
+    }
+
     // バイナリサーチでコードポイントを検索
     int left = 0;
     int right = font->chars_count - 1;
@@ -158,7 +420,7 @@ const FontCharInfo *epd_text_find_char(const FontInfo *font, uint32_t code_point
     }
 
     // 見つからなかった場合
-    ESP_LOGD(TAG, "Character U+%08lX not found in font", code_point);
+    ESP_LOGD(TAG, "Character U+%08" PRIX32 " not found in font", code_point);
     return NULL;
 }
 
@@ -169,7 +431,18 @@ const FontCharInfo *epd_text_find_char(const FontInfo *font, uint32_t code_point
  */
 uint32_t epd_text_utf8_next_char(const char **text)
 {
-    if (text == NULL || *text == NULL || **text == '\0')
+    return epd_text_utf8_next_char_n(text, NULL);
+}
+
+/**
+ * @brief 終端位置を指定してUTF-8テキストから次の文字を取得する
+ * @param text UTF-8テキストへのポインタのポインタ（処理後、ポインタは次の文字位置に進む）
+ * @param end テキストの終端（NULLの場合はヌル文字で終端）
+ * @return 次の文字のUnicodeコードポイント。終端の場合は0
+ */
+uint32_t epd_text_utf8_next_char_n(const char **text, const char *end)
+{
+    if (text == NULL || *text == NULL || (end != NULL && *text >= end) || **text == '\0')
     {
         return 0;
     }
@@ -215,9 +488,9 @@ uint32_t epd_text_utf8_next_char(const char **text)
     s++;
     for (int i = 1; i < bytes_to_read; i++)
     {
-        if ((*s & 0xC0) != 0x80)
+        if ((end != NULL && (const char *)s >= end) || (*s & 0xC0) != 0x80)
         {
-            // 無効な継続バイト
+            // 無効な継続バイト（または終端で途切れたシーケンス）
             *text += i;
             ESP_LOGW(TAG, "Invalid UTF-8 continuation byte");
             return 0xFFFD; // Replacement character
@@ -231,22 +504,370 @@ uint32_t epd_text_utf8_next_char(const char **text)
     return code_point;
 }
 
+/**
+ * @brief 回転後のグリフ上の1ピクセルが文字部分かどうかを判定する
+ * @param bitmap ビットマップデータ（1ビット/ピクセル、MSBファースト）
+ * @param width 元のビットマップの幅
+ * @param height 元のビットマップの高さ
+ * @param rotation 回転角度（0:0度, 1:90度, 2:180度, 3:270度）
+ * @param row 回転後の行
+ * @param col 回転後の列（範囲外の場合はfalse）
+ * @return 文字部分の場合はtrue
+ */
+static inline bool glyph_pixel_is_set(const uint8_t *bitmap, int width, int height,
+                                      int rotation, int row, int col)
+{
+    int out_width = (rotation == 1 || rotation == 3) ? height : width;
+    if (col < 0 || col >= out_width)
+    {
+        return false;
+    }
+
+    // 描画先の位置から元のビットマップの位置を逆算
+    int dx, dy;
+    switch (rotation)
+    {
+    case 1: // 90度回転（時計回り）
+        dx = row;
+        dy = height - 1 - col;
+        break;
+
+    case 2: // 180度回転
+        dx = width - 1 - col;
+        dy = height - 1 - row;
+        break;
+
+    case 3: // 270度回転（反時計回り）
+        dx = width - 1 - row;
+        dy = col;
+        break;
+
+    default: // 0度回転（そのまま）
+        dx = col;
+        dy = row;
+        break;
+    }
+
+    // ビットが立っているかチェック（MSBファースト）
+    int bytes_per_row = (width + 7) / 8; // 8ビット境界に切り上げ
+    return (bitmap[dy * bytes_per_row + dx / 8] & (0x80 >> (dx % 8))) != 0;
+}
+
+/**
+ * @brief 太字を考慮して回転後のグリフ上の1ピクセルを判定する
+ *
+ * 太字の場合は1ピクセル右にずらした像を重ねる。
+ */
+static inline bool glyph_pixel_is_set_bold(const uint8_t *bitmap, int width, int height,
+                                           int rotation, bool bold, int row, int col)
+{
+    return glyph_pixel_is_set(bitmap, width, height, rotation, row, col) ||
+           (bold && glyph_pixel_is_set(bitmap, width, height, rotation, row, col - 1));
+}
+
+/**
+ * @brief 圧縮グリフのビット列の読み出し位置
+ */
+typedef struct
+{
+    const uint8_t *data; // グリフの先頭
+    uint32_t bit;        // 次に読むビットの位置（MSB優先）
+    uint32_t limit;      // 読んでよいビット数
+} GlyphBitReader;
+
+/**
+ * @brief 1ビット読む
+ * @return 読んだビット（範囲外の場合は-1）
+ */
+static inline int read_glyph_bit(GlyphBitReader *reader)
+{
+    if (reader->bit >= reader->limit)
+    {
+        return -1;
+    }
+    int bit = (reader->data[reader->bit >> 3] >> (7 - (reader->bit & 7))) & 1;
+    reader->bit++;
+    return bit;
+}
+
+/**
+ * @brief k次のExp-Golomb符号を1つ読む
+ * @return 値（データが壊れている場合は-1）
+ */
+static int read_exp_golomb(GlyphBitReader *reader, int order)
+{
+    // 先頭の0の数が、続けて読む値のビット数（order を除く）を表す
+    int zeros = 0;
+    int bit;
+    while ((bit = read_glyph_bit(reader)) == 0)
+    {
+        if (++zeros > 16)
+        {
+            return -1;
+        }
+    }
+    if (bit < 0)
+    {
+        return -1;
+    }
+
+    // zeros（16以下）と order（15以下）の合計は31ビット以下なので uint32_t に収まる
+    uint32_t value = 1;
+    for (int i = 0; i < zeros + order; i++)
+    {
+        if ((bit = read_glyph_bit(reader)) < 0)
+        {
+            return -1;
+        }
+        value = (value << 1) | (uint32_t)bit;
+    }
+    value -= 1u << order;
+    return value > INT_MAX ? -1 : (int)value;
+}
+
+/**
+ * @brief 回転後のグリフで文字部分が続く横方向の区間を受け取る関数
+ * @param ctx 呼び出し元が渡した情報
+ * @param row 回転後の行
+ * @param col 回転後の区間の開始列
+ * @param length 区間のピクセル数
+ */
+typedef void (*GlyphSpanFn)(void *ctx, int row, int col, int length);
+
+/**
+ * @brief 元のビットマップの1行の区間を、回転後の座標に変換して渡す
+ *
+ * 0度・180度では横の区間のまま、90度・270度では縦に並ぶため1ピクセルずつ渡す。
+ */
+static void emit_glyph_span(GlyphSpanFn fn, void *ctx, int width, int height, int rotation,
+                            int dy, int dx, int length)
+{
+    switch (rotation)
+    {
+    case 1: // 90度回転（時計回り）
+        for (int i = 0; i < length; i++)
+        {
+            fn(ctx, dx + i, height - 1 - dy, 1);
+        }
+        break;
+
+    case 2: // 180度回転
+        fn(ctx, height - 1 - dy, width - dx - length, length);
+        break;
+
+    case 3: // 270度回転（反時計回り）
+        for (int i = 0; i < length; i++)
+        {
+            fn(ctx, width - 1 - dx - i, dy, 1);
+        }
+        break;
+
+    default: // 0度回転（そのまま）
+        fn(ctx, dy, dx, length);
+        break;
+    }
+}
+
+/**
+ * @brief 圧縮グリフを復号し、文字部分の区間を回転後の座標で渡す
+ * @param bitmap グリフの先頭
+ * @param limit_bits 読んでよいビット数
+ * @param width 元のビットマップの幅
+ * @param height 元のビットマップの高さ
+ * @param run_orders 符号の次数（FontInfo.run_orders）
+ * @param rotation 回転角度
+ * @param fn 区間を受け取る関数（NULLの場合は検査のみ）
+ * @param ctx fn に渡す情報
+ * @param bits_used 読んだビット数の格納先（NULL可）
+ * @return 全ピクセル分を正しく復号できた場合はtrue
+ *
+ * ランは白から始まり、白と黒が交互に並ぶ。行をまたいで行優先で続き、末尾の白も含めて
+ * width * height ピクセルを覆う。白のランは長さを、黒のランは長さ-1を符号化する。
+ * ランを直接区間に変換するため、グリフ全体を展開するバッファは使わない。
+ */
+static bool decode_rle_glyph(const uint8_t *bitmap, uint32_t limit_bits, int width, int height,
+                             uint8_t run_orders, int rotation, GlyphSpanFn fn, void *ctx,
+                             uint32_t *bits_used)
+{
+    GlyphBitReader reader = {.data = bitmap, .bit = 0, .limit = limit_bits};
+    int white_order = run_orders >> 4;
+    int black_order = run_orders & 0x0F;
+    int total = width * height;
+    int pos = 0;
+    bool is_set = false;
+
+    while (pos < total)
+    {
+        int run = read_exp_golomb(&reader, is_set ? black_order : white_order);
+        if (run < 0)
+        {
+            return false;
+        }
+        if (is_set)
+        {
+            run++;
+        }
+        if (run > total - pos)
+        {
+            return false;
+        }
+
+        if (is_set && fn != NULL)
+        {
+            // 行をまたぐランは行ごとに分ける
+            int dy = pos / width;
+            int dx = pos % width;
+            int rest = run;
+            while (rest > 0)
+            {
+                int length = (width - dx < rest) ? width - dx : rest;
+                emit_glyph_span(fn, ctx, width, height, rotation, dy, dx, length);
+                rest -= length;
+                dy++;
+                dx = 0;
+            }
+        }
+        pos += run;
+        is_set = !is_set;
+    }
+
+    if (bits_used != NULL)
+    {
+        *bits_used = reader.bit;
+    }
+    return true;
+}
+
+bool epd_text_check_glyph_data(const FontInfo *font, const FontCharInfo *char_info, size_t limit)
+{
+    if (font == NULL || char_info == NULL)
+    {
+        return false;
+    }
+
+    switch (font->encoding)
+    {
+    case EPD_FONT_ENCODING_RAW:
+        return (size_t)((char_info->img_width + 7) / 8) * char_info->img_height <= limit;
+
+    case EPD_FONT_ENCODING_RLE:
+    {
+        uint32_t limit_bits = limit > UINT32_MAX / 8 ? UINT32_MAX : (uint32_t)limit * 8;
+        return decode_rle_glyph(font->bitmap_data + char_info->data_offset, limit_bits,
+                                char_info->img_width, char_info->img_height, font->run_orders,
+                                0, NULL, NULL, NULL);
+    }
+
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief キャッシュ領域に文字部分の区間を書き込むための情報
+ */
+typedef struct
+{
+    EPDGlyphBitmap *glyph;
+    uint8_t color;
+    bool bold;
+} GlyphCacheSpanTarget;
+
+static void cache_glyph_span(void *ctx, int row, int col, int length)
+{
+    GlyphCacheSpanTarget *target = ctx;
+    EPDGlyphBitmap *glyph = target->glyph;
+    int end = col + length + (target->bold ? 1 : 0);
+    if (end > glyph->width)
+    {
+        end = glyph->width;
+    }
+
+    uint8_t *dst = glyph->data + row * glyph->stride;
+    for (int c = col; c < end; c++)
+    {
+        uint8_t *p = &dst[c / 2];
+        *p = (c % 2 == 0) ? ((*p & 0xF0) | target->color) : ((*p & 0x0F) | (target->color << 4));
+    }
+}
+
+/**
+ * @brief フレームバッファに文字部分の区間を描画するための情報
+ */
+typedef struct
+{
+    EPDWrapper *wrapper;
+    int x;
+    int y;
+    uint8_t color;
+    bool bold;
+} GlyphDrawSpanTarget;
+
+static void draw_glyph_span(void *ctx, int row, int col, int length)
+{
+    GlyphDrawSpanTarget *target = ctx;
+    epd_wrapper_fill_span(target->wrapper, target->x + col, target->y + row,
+                          length + (target->bold ? 1 : 0), target->color);
+}
+
+/**
+ * @brief グリフを4ビット/ピクセルの画像としてキャッシュ領域に展開する
+ * @param glyph 書き込み先（背景色で塗りつぶし済み）
+ * @param font フォント情報（ビットマップの形式）
+ * @param bitmap ビットマップデータ
+ * @param width 元のビットマップの幅
+ * @param height 元のビットマップの高さ
+ * @param rotation 回転角度
+ * @param bold 太字フラグ
+ * @param text_color 文字色
+ */
+static void render_glyph_to_cache(EPDGlyphBitmap *glyph, const FontInfo *font, const uint8_t *bitmap,
+                                  int width, int height, int rotation, bool bold,
+                                  uint8_t text_color)
+{
+    text_color &= 0x0F;
+    if (font->encoding == EPD_FONT_ENCODING_RLE)
+    {
+        GlyphCacheSpanTarget target = {.glyph = glyph, .color = text_color, .bold = bold};
+        decode_rle_glyph(bitmap, UINT32_MAX, width, height, font->run_orders, rotation,
+                         cache_glyph_span, &target, NULL);
+        return;
+    }
+
+    for (int row = 0; row < glyph->height; row++)
+    {
+        uint8_t *dst = glyph->data + row * glyph->stride;
+        for (int col = 0; col < glyph->width; col++)
+        {
+            if (glyph_pixel_is_set_bold(bitmap, width, height, rotation, bold, row, col))
+            {
+                uint8_t *p = &dst[col / 2];
+                *p = (col % 2 == 0) ? ((*p & 0xF0) | text_color) : ((*p & 0x0F) | (text_color << 4));
+            }
+        }
+    }
+}
+
 /**
  * @brief 回転を考慮して文字を描画する
  * @param wrapper EPDラッパー構造体へのポインタ
  * @param x 描画開始X座標
  * @param y 描画開始Y座標
+ * @param font フォント情報（キャッシュのキーに使用）
  * @param char_info 描画する文字情報
  * @param bitmap ビットマップデータ
  * @param rotation 回転角度（0:0度, 1:90度, 2:180度, 3:270度）
  * @param text_color 文字色
  * @param bg_color 背景色
  * @param bg_transparent 背景透過フラグ
+ * @param bold 太字フラグ（1ピクセル太くする）
+ *
+ * グリフキャッシュが有効な場合は展開済みの画像を行単位でコピーします。
  */
 void draw_rotated_char(EPDWrapper *wrapper, int x, int y,
-                       const FontCharInfo *char_info, const uint8_t *bitmap,
-                       int rotation, uint8_t text_color, uint8_t bg_color,
-                       bool bg_transparent)
+                       const FontInfo *font, const FontCharInfo *char_info,
+                       const uint8_t *bitmap, int rotation, uint8_t text_color,
+                       uint8_t bg_color, bool bg_transparent, bool bold)
 {
     // スペースの場合はスキップ
     if (char_info->code_point == 0x0020 || char_info->code_point == 0x3000)
@@ -255,62 +876,98 @@ void draw_rotated_char(EPDWrapper *wrapper, int x, int y,
     int width = char_info->img_width;
     int height = char_info->img_height;
 
-    // ビットマップデータをバイト単位でアクセスするための計算
-    int bytes_per_row = (width + 7) / 8; // 8ビット境界に切り上げ
-
-    // 各ピクセルを描画
-    for (int dy = 0; dy < height; dy++)
+    // 回転後の描画範囲のサイズ（90度・270度は幅と高さが入れ替わる）
+    int out_width = (rotation == 1 || rotation == 3) ? height : width;
+    int out_height = (rotation == 1 || rotation == 3) ? width : height;
+    if (bold)
     {
-        for (int dx = 0; dx < width; dx++)
-        {
-            // ビットマップデータの位置を計算
-            int byte_index = (dy * bytes_per_row) + (dx / 8);
-            int bit_index = 7 - (dx % 8); // MSBファースト
-
-            // ビットが立っているかチェック
-            bool pixel_is_set = (bitmap[byte_index] & (1 << bit_index)) != 0;
+        out_width++;
+    }
 
-            // 描画先の座標を回転に応じて計算
-            int draw_x, draw_y;
+    // クリップ矩形の外側にある文字はキャッシュの展開も含めて何もしない
+    EpdRect visible = {.x = x, .y = y, .width = out_width, .height = out_height};
+    if (!epd_wrapper_clip_rect(wrapper, &visible))
+    {
+        return;
+    }
 
-            switch (rotation)
+    // グリフキャッシュを利用できる場合は展開済みの画像をコピー
+    // （他のタスクに破棄されないよう、描画が終わるまでキャッシュをロックしておく）
+    if (epd_glyph_cache_is_enabled() && epd_glyph_cache_lock())
+    {
+        EPDGlyphCacheKey key = {
+            .font = font,
+            .code_point = char_info->code_point,
+            .rotation = (uint8_t)rotation,
+            .text_color = text_color,
+            .bg_color = bg_color,
+            .bg_transparent = bg_transparent,
+            .bold = bold,
+        };
+        const EPDGlyphBitmap *cached = epd_glyph_cache_lookup(&key);
+        if (cached == NULL)
+        {
+            EPDGlyphBitmap *glyph = epd_glyph_cache_insert(&key, out_width, out_height);
+            if (glyph != NULL)
             {
-            case 0: // 0度回転（そのまま）
-                draw_x = x + dx;
-                draw_y = y + dy;
-                break;
+                render_glyph_to_cache(glyph, font, bitmap, width, height, rotation, bold, text_color);
+                cached = glyph;
+            }
+        }
+        if (cached != NULL)
+        {
+            epd_glyph_cache_blit(wrapper, x, y, cached);
+            epd_glyph_cache_unlock();
+            return;
+        }
+        epd_glyph_cache_unlock();
+    }
 
-            case 1: // 90度回転（時計回り）
-                draw_x = x + height - 1 - dy;
-                draw_y = y + dx;
-                break;
+    // 文字の見える部分をまとめてダーティとして記録
+    epd_wrapper_mark_dirty(wrapper, visible.x, visible.y, visible.width, visible.height);
 
-            case 2: // 180度回転
-                draw_x = x + width - 1 - dx;
-                draw_y = y + height - 1 - dy;
-                break;
+    // 圧縮されたグリフは背景を塗ってから、復号したランを直接スパンで描画
+    if (font->encoding == EPD_FONT_ENCODING_RLE)
+    {
+        if (!bg_transparent)
+        {
+            for (int row = visible.y; row < visible.y + visible.height; row++)
+            {
+                epd_wrapper_fill_span(wrapper, visible.x, row, visible.width, bg_color);
+            }
+        }
+        GlyphDrawSpanTarget target = {.wrapper = wrapper, .x = x, .y = y, .color = text_color, .bold = bold};
+        decode_rle_glyph(bitmap, UINT32_MAX, width, height, font->run_orders, rotation,
+                         draw_glyph_span, &target, NULL);
+        return;
+    }
 
-            case 3: // 270度回転（反時計回り）
-                draw_x = x + dy;
-                draw_y = y + width - 1 - dx;
-                break;
+    // 見える行ごとに、同じ状態（文字/背景）が続く区間をまとめてスパンで描画
+    for (int row = visible.y - y; row < visible.y - y + visible.height; row++)
+    {
+        int run_start = 0;
+        bool run_is_set = false;
 
-            default:
-                // デフォルトは回転なし
-                draw_x = x + dx;
-                draw_y = y + dy;
-            }
+        for (int col = 0; col <= out_width; col++)
+        {
+            bool pixel_is_set = col < out_width &&
+                                glyph_pixel_is_set_bold(bitmap, width, height, rotation, bold, row, col);
 
-            // ピクセルを描画（文字の場合）またはクリア（背景の場合）
-            if (pixel_is_set)
+            // 状態が変わったら、そこまでの区間を描画
+            if (col == out_width || (col > 0 && pixel_is_set != run_is_set))
             {
-                epd_wrapper_draw_pixel(wrapper, draw_x, draw_y, text_color);
-            }
-            else if (!bg_transparent)
-            {
-                // 背景が透明でない場合のみ背景色を描画
-                epd_wrapper_draw_pixel(wrapper, draw_x, draw_y, bg_color);
+                if (run_is_set)
+                {
+                    epd_wrapper_fill_span(wrapper, x + run_start, y + row, col - run_start, text_color);
+                }
+                else if (!bg_transparent)
+                {
+                    // 背景が透明でない場合のみ背景色を描画
+                    epd_wrapper_fill_span(wrapper, x + run_start, y + row, col - run_start, bg_color);
+                }
+                run_start = col;
             }
+            run_is_set = pixel_is_set;
         }
     }
 }
@@ -419,12 +1076,14 @@ int epd_text_draw_char(EPDWrapper *wrapper, int x, int y, uint32_t code_point, c
         wrapper,
         x_pos,
         y_pos,
+        config->font,
         char_info,
         bitmap,
         rotation,
         draw_color,
         bg_color,
-        config->bg_transparent);
+        config->bg_transparent,
+        config->bold);
 
     // 下線の描画（横書きの場合のみ）
     if (config->underline && !config->vertical)
@@ -470,6 +1129,26 @@ int epd_text_draw_char(EPDWrapper *wrapper, int x, int y, uint32_t code_point, c
  * @return 描画した文字列の幅（横書き時）または高さ（縦書き時）
  */
 int epd_text_draw_string(EPDWrapper *wrapper, int x, int y, const char *text, const EPDTextConfig *config)
+{
+    if (text == NULL)
+    {
+        ESP_LOGE(TAG, "Invalid parameters for drawing string");
+        return 0;
+    }
+    return epd_text_draw_string_n(wrapper, x, y, text, strlen(text), config);
+}
+
+/**
+ * @brief 長さを指定してUTF-8文字列を描画する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param x X座標
+ * @param y Y座標
+ * @param text 描画するUTF-8文字列（ヌル終端でなくてもよい）
+ * @param length 描画するバイト数
+ * @param config テキスト描画設定
+ * @return 描画した文字列の幅（横書き時）または高さ（縦書き時）
+ */
+int epd_text_draw_string_n(EPDWrapper *wrapper, int x, int y, const char *text, size_t length, const EPDTextConfig *config)
 {
     if (wrapper == NULL || config == NULL || config->font == NULL || text == NULL)
     {
@@ -481,7 +1160,7 @@ int epd_text_draw_string(EPDWrapper *wrapper, int x, int y, const char *text, co
     int screen_width = epd_wrapper_get_width(wrapper);
     int screen_height = epd_wrapper_get_height(wrapper);
 
-    ESP_LOGI(TAG, "Drawing string at (%d,%d): %s", x, y, text);
+    ESP_LOGI(TAG, "Drawing string at (%d,%d): %.*s", x, y, (int)length, text);
     ESP_LOGI(TAG, "Mode: %s", config->vertical ? "Vertical" : "Horizontal");
 
     // 文字描画の初期位置
@@ -493,15 +1172,16 @@ int epd_text_draw_string(EPDWrapper *wrapper, int x, int y, const char *text, co
 
     // UTF-8テキストの解析
     const char *ptr = text;
+    const char *end = text + length;
     uint32_t code_point;
 
-    while ((code_point = epd_text_utf8_next_char(&ptr)) != 0)
+    while ((code_point = epd_text_utf8_next_char_n(&ptr, end)) != 0)
     {
         // フォントから文字情報を取得
         const FontCharInfo *char_info = epd_text_find_char(config->font, code_point);
         if (char_info == NULL)
         {
-            ESP_LOGW(TAG, "Character U+%04lX not found in font, skipping", code_point);
+            ESP_LOGW(TAG, "Character U+%04" PRIX32 " not found in font, skipping", code_point);
             continue;
         }
 
@@ -553,17 +1233,218 @@ int epd_text_draw_string(EPDWrapper *wrapper, int x, int y, const char *text, co
     return total_advance;
 }
 
+/**
+ * @brief 行分割イテレータを初期化する
+ * @param breaker 初期化するイテレータ
+ * @param text 分割するUTF-8テキスト（ヌル終端でなくてもよい）
+ * @param length テキストのバイト数
+ * @param config テキスト描画設定（フォント・文字間隔・縦横書きを参照）
+ * @param wrap_limit 1行の最大の長さ（横書きは幅、縦書きは高さ。ピクセル単位）
+ */
+void epd_text_line_breaker_init(EPDTextLineBreaker *breaker, const char *text, size_t length,
+                                const EPDTextConfig *config, int wrap_limit)
+{
+    if (breaker == NULL)
+    {
+        return;
+    }
+    breaker->text = text;
+    breaker->length = (text != NULL) ? length : 0;
+    breaker->pos = 0;
+    breaker->config = config;
+    breaker->wrap_limit = wrap_limit;
+}
+
+/**
+ * @brief 次の1行を取得する
+ * @param breaker 行分割イテレータ
+ * @param line 取得した行の格納先
+ * @return 行を取得できた場合はtrue、テキストの終端に達した場合はfalse
+ *
+ * 改行文字で必ず改行し、行の長さがwrap_limitを超える場合は文字の前で折り返す。
+ * 折り返し位置で行頭禁則文字が行頭に来る場合、または行末禁則文字が行末に残る場合は、
+ * 直前の文字ごと次の行に送る。
+ */
+bool epd_text_line_breaker_next(EPDTextLineBreaker *breaker, EPDTextLine *line)
+{
+    if (breaker == NULL || line == NULL || breaker->config == NULL || breaker->config->font == NULL)
+    {
+        return false;
+    }
+    if (breaker->pos >= breaker->length || breaker->text[breaker->pos] == '\0')
+    {
+        return false;
+    }
+
+    const EPDTextConfig *config = breaker->config;
+    const char *start = breaker->text + breaker->pos;
+    const char *end = breaker->text + breaker->length;
+    const char *current = start;
+
+    const char *break_at = NULL;            // 行の終了位置（NULLの場合はテキスト終端まで）
+    const char *next_start = NULL;          // 次の行の開始位置
+    bool hard_break = false;                // 改行文字で終わったか
+    bool soft_break = false;                // 長さの制限で折り返したか
+    int advance = 0;                        // 折り返した行の長さ
+
+    int extent = 0;                         // 行方向の長さ
+    int extent_before_prev = 0;             // 直前の文字を追加する前の長さ
+    const char *prev_char_start = NULL;     // 直前の文字の開始位置
+    const FontCharInfo *prev_char_info = NULL;
+
+    while (current < end && *current != '\0')
+    {
+        const char *char_start = current;
+
+        // 改行文字で強制改行
+        if (*current == '\n')
+        {
+            break_at = current;
+            next_start = current + 1;
+            hard_break = true;
+            break;
+        }
+
+        uint32_t code_point = epd_text_utf8_next_char_n(&current, end);
+        const FontCharInfo *char_info = epd_text_find_char(config->font, code_point);
+        if (char_info == NULL)
+        {
+            continue; // 文字が見つからない場合はスキップ
+        }
+
+        // mono spacingかproportionalかで幅と高さを変える
+        int char_width = config->mono_spacing ? config->font->max_width : char_info->img_width;
+        int char_height = config->mono_spacing ? config->font->max_height : char_info->img_height;
+
+        // この文字を追加した場合の長さ（縦書きで回転している文字は幅を使う）
+        int char_extent;
+        if (config->vertical)
+        {
+            char_extent = (char_info->rotation == 1) ? char_width : char_height;
+        }
+        else
+        {
+            char_extent = char_width;
+        }
+        int new_extent = extent + char_extent;
+        if (extent > 0)
+        {
+            new_extent += config->char_spacing;
+        }
+
+        // 長さが制限を超える場合は折り返す（行に1文字もない場合は収める）
+        if (new_extent > breaker->wrap_limit && prev_char_info != NULL)
+        {
+            break_at = char_start;
+            advance = extent;
+
+            // 行頭禁則文字・行末禁則文字の場合は直前の文字ごと次の行に送る
+            bool keep_with_prev = epd_text_is_no_start_char(char_info) ||
+                                  epd_text_is_no_end_char(prev_char_info);
+            if (keep_with_prev && prev_char_start > start)
+            {
+                break_at = prev_char_start;
+                advance = extent_before_prev;
+            }
+            next_start = break_at;
+            soft_break = true;
+            break;
+        }
+
+        extent_before_prev = extent;
+        extent = new_extent;
+        prev_char_start = char_start;
+        prev_char_info = char_info;
+    }
+
+    if (break_at == NULL)
+    {
+        // テキスト終端まで
+        break_at = current;
+        next_start = current;
+    }
+
+    line->offset = start - breaker->text;
+    line->length = break_at - start;
+    line->advance = soft_break ? advance : extent;
+    line->hard_break = hard_break;
+    breaker->pos = next_start - breaker->text;
+    return true;
+}
+
+/**
+ * @brief 複数行描画で矩形に収まる行数と1行の最大の長さを求める
+ * @param rect 描画領域
+ * @param config テキスト描画設定
+ * @param wrap_limit 1行の最大の長さの格納先（NULL可）
+ * @return 描画できる行数
+ */
+int epd_text_multiline_capacity(const EpdRect *rect, const EPDTextConfig *config, int *wrap_limit)
+{
+    if (rect == NULL || config == NULL || config->font == NULL)
+    {
+        return 0;
+    }
+
+    // 矩形領域の幅を折り返し幅とし、さらに内側余白を差し引く
+    int wrap_width = config->vertical ? rect->height - (config->box_padding * 2) : rect->width - (config->box_padding * 2);
+    if (wrap_limit != NULL)
+    {
+        *wrap_limit = wrap_width - (config->box_padding * 2);
+    }
+
+    // 行の高さ（横書き）または幅（縦書き）
+    int line_size = config->vertical ? config->font->max_width + config->line_spacing : config->font->max_height + config->line_spacing;
+    if (line_size <= 0)
+    {
+        return 0;
+    }
+
+    int max_lines = config->vertical ? rect->width / line_size : rect->height / line_size;
+
+    // 横書きでは下端の内側余白を超える行は描画しない
+    if (!config->vertical)
+    {
+        int lines = 0;
+        int current_y = rect->y + config->box_padding;
+        while (lines < max_lines && current_y + line_size <= rect->y + rect->height - config->box_padding)
+        {
+            current_y += line_size;
+            lines++;
+        }
+        max_lines = lines;
+    }
+    return max_lines;
+}
+
 /**
  * @brief 複数行のテキストを描画する
  * @param wrapper EPDラッパー構造体へのポインタ
- * @param x X座標
- * @param y Y座標
  * @param rect 描画領域（この範囲内にテキストを収める）
  * @param text 描画するUTF-8文字列
  * @param config テキスト描画設定
  * @return 描画した行数
  */
 int epd_text_draw_multiline(EPDWrapper *wrapper, EpdRect *rect, const char *text, const EPDTextConfig *config)
+{
+    if (text == NULL)
+    {
+        ESP_LOGE(TAG, "Invalid parameters for drawing multiline text");
+        return 0;
+    }
+    return epd_text_draw_multiline_n(wrapper, rect, text, strlen(text), config);
+}
+
+/**
+ * @brief 長さを指定して複数行のテキストを描画する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param rect 描画領域（この範囲内にテキストを収める）
+ * @param text 描画するUTF-8文字列（ヌル終端でなくてもよい）
+ * @param length テキストのバイト数
+ * @param config テキスト描画設定
+ * @return 描画した行数
+ */
+int epd_text_draw_multiline_n(EPDWrapper *wrapper, EpdRect *rect, const char *text, size_t length, const EPDTextConfig *config)
 {
     if (wrapper == NULL || config == NULL || config->font == NULL || text == NULL || rect == NULL)
     {
@@ -593,323 +1474,36 @@ int epd_text_draw_multiline(EPDWrapper *wrapper, EpdRect *rect, const char *text
     // 行の高さ（横書き）または幅（縦書き）
     int line_size = local_config.vertical ? local_config.font->max_width + local_config.line_spacing : local_config.font->max_height + local_config.line_spacing;
 
-    // 描画可能な行数を計算
-    int max_lines = local_config.vertical ? rect->width / line_size : rect->height / line_size;
-
-    // バッファサイズを計算（UTF-8で4バイト文字を考慮）
-    int buffer_size = strlen(text) + 1;
-    char *text_copy = (char *)malloc(buffer_size);
-    if (text_copy == NULL)
-    {
-        ESP_LOGE(TAG, "Failed to allocate memory for text copy");
-        return 0;
-    }
+    // 描画可能な行数と1行の最大の長さ
+    int wrap_limit;
+    int max_lines = epd_text_multiline_capacity(rect, config, &wrap_limit);
 
-    // テキストをコピー
-    strcpy(text_copy, text);
+    // テキストを1行ずつ取り出して、その場で描画する
+    EPDTextLineBreaker breaker;
+    epd_text_line_breaker_init(&breaker, text, length, &local_config, wrap_limit);
 
-    // 文字列を改行でトークン化
-    char *token = strtok(text_copy, "\n");
+    EPDTextLine line;
     int line_count = 0;
 
-    while (token != NULL && line_count < max_lines)
+    while (line_count < max_lines && epd_text_line_breaker_next(&breaker, &line))
     {
-        // この行の文字列を処理
-        // int token_length = strlen(token);
-
-        // 描画すべき部分文字列のリスト
-        const char *segments[100]; // 十分な大きさの配列
-        int segment_count = 0;
-
-        // 縦書きモードの場合、単純に文字列を描画
-        /*if (local_config.vertical)
+        // 行を描画（空行の場合は位置だけ進める）
+        if (line.length > 0)
         {
-            segments[0] = token;
-            segment_count = 1;
-        }
-        else
-        {*/
-        // 折り返し処理用
-        // const char *line_start = token;
-        const char *current = token;
-        const char *segment_start = token;
-        int segment_width = 0;
-        int segment_height = 0;
-        uint32_t last_code_point = 0;
-        bool pending_wrap = false;
-
-        // 前の文字を保存するためのバッファ
-        const char *prev_char_start = NULL;
-
-        while (*current != '\0')
-        {
-            const char *char_start = current;
-            uint32_t code_point = epd_text_utf8_next_char(&current);
-
-            // 文字情報を取得
-            const FontCharInfo *char_info = epd_text_find_char(local_config.font, code_point);
-            if (char_info == NULL)
-            {
-                continue; // 文字が見つからない場合はスキップ
-            }
-            // mono spacingかproportionalかで幅と高さを変える
-            int char_width;
-            int char_height;
-            if (config->mono_spacing)
-            {
-                // 等幅はフォント情報から最大幅と最大高さを取得
-                char_width = local_config.font->max_width;
-                char_height = local_config.font->max_height;
-            }
-            else
-            {
-                // プロポーショナルは実際の文字の幅と高さを取得
-                char_width = char_info->img_width;
-                char_height = char_info->img_height;
-            }
-            // 前回の文字情報
-            // 前回文字の幅と高さ
-            int prev_char_width;
-            int prev_char_height;
-            const FontCharInfo *prev_char_info;
-            if (last_code_point != 0)
-            {
-                prev_char_info = epd_text_find_char(local_config.font, last_code_point);
-                if (config->mono_spacing)
-                {
-                    // 等幅はフォント情報から最大幅と最大高さを取得
-                    prev_char_width = local_config.font->max_width;
-                    prev_char_height = local_config.font->max_height;
-                }
-                else
-                {
-                    // プロポーショナルは実際の文字の幅と高さを取得
-                    prev_char_width = prev_char_info->img_width;
-                    prev_char_height = prev_char_info->img_height;
-                }
-            }
-
-            // この文字を追加した場合の幅を計算（横書き用）
-            int new_width = segment_width + char_width;
-            if (segment_width > 0)
-            {
-                new_width += local_config.char_spacing;
-            }
-
-            // この文字を追加した場合の高さを計算（縦書き用）
-            int new_height = 0;
-            if (char_info->rotation == 1)
-            {
-                // 回転してるときは幅を使う。
-                new_height += segment_height + char_width;
-            }
-            else
-            {
-                new_height += segment_height + char_height;
-            }
-            if (segment_height > 0)
-            {
-                new_height += local_config.char_spacing;
-            }
-
-            // 幅、高さが制限を超えているかチェック
-            bool size_limit; // = (local_config.vertical ? new_height : new_width ) > local_config.wrap_width - local_config.box_padding;
-
-            if (local_config.vertical)
-            {
-                size_limit = new_height > local_config.wrap_width - (local_config.box_padding * 2);
-            }
-            else
-            {
-                size_limit = new_width > local_config.wrap_width - (local_config.box_padding * 2);
-            }
-
-            // 幅が制限を超える場合、または前の処理で折り返しが保留になっていた場合の処理
-            if (size_limit || pending_wrap)
-            {
-                ESP_LOGI(TAG, "---------------size limit oVer!! wrap_max = %d", local_config.wrap_width);
-                pending_wrap = false;
-
-                // 表示しようとしている文字が行頭禁止文字の場合
-                if (epd_text_is_no_start_char(char_info))
-                {
-                    // 前の文字の表示前で折り返す
-                    if (prev_char_start != NULL && segment_start < prev_char_start)
-                    {
-                        // 現在のセグメントを前の文字までとして追加
-                        segments[segment_count++] = segment_start;
-
-                        // 前の文字から始まる新しいセグメントを開始
-                        segment_start = prev_char_start;
-
-                        // 前の文字と現在の文字の幅を計算
-                        if (char_info->rotation == 1)
-                        {
-                            segment_width = (prev_char_info != NULL ? prev_char_height : 0) +
-                                            local_config.char_spacing + char_height;
-                            segment_height = (prev_char_info != NULL ? prev_char_width : 0) +
-                                             local_config.char_spacing + char_width;
-                        }
-                        else
-                        {
-                            segment_width = (prev_char_info != NULL ? prev_char_width : 0) +
-                                            local_config.char_spacing + char_width;
-                            segment_height = (prev_char_info != NULL ? prev_char_height : 0) +
-                                             local_config.char_spacing + char_height;
-                        }
-                    }
-                    else
-                    {
-                        // 前の文字がない場合は通常の折り返し
-                        segments[segment_count++] = segment_start;
-                        segment_start = char_start;
-                        segment_width = char_width;
-                        segment_height = char_height;
-                    }
-                }
-                // 行末禁止文字だった場合
-                else if (epd_text_is_no_end_char(prev_char_info))
-                {
-                    // 行末禁止文字と現在の文字を次の行に送る
-                    if (prev_char_start != NULL && segment_start < prev_char_start)
-                    {
-                        // 直前の行末禁止文字の前までをセグメントとして追加
-                        segments[segment_count++] = segment_start;
-
-                        // 行末禁止文字から新しいセグメントを開始
-                        segment_start = prev_char_start;
-
-                        // 行末禁止文字と現在の文字の幅を計算
-                        const FontCharInfo *prev_char_info = epd_text_find_char(local_config.font, last_code_point);
-                        segment_width = (prev_char_info != NULL ? prev_char_width : 0) +
-                                        local_config.char_spacing + char_width;
-                        segment_height = (prev_char_info != NULL ? prev_char_height : 0) +
-                                         local_config.char_spacing + char_height;
-                    }
-                    else
-                    {
-                        // 通常の折り返し（最初の文字が行末禁止文字の場合）
-                        segments[segment_count++] = segment_start;
-                        segment_start = char_start;
-                        segment_width = char_width;
-                        segment_height = char_height;
-                    }
-                }
-                else
-                {
-                    // 通常の折り返し
-                    segments[segment_count++] = segment_start;
-                    segment_start = char_start;
-                    segment_width = char_width;
-                    segment_height = char_height;
-                }
-            }
-            else
-            {
-                /*
-                // 次の文字を見て、それが行頭禁止文字かつ現在の行に収まらない場合、
-                // 現在の文字で折り返しを保留
-                const char *next_char_start = current;
-                if (*next_char_start != '\0')
-                {
-                    const char *next_current = next_char_start;
-                    uint32_t next_code_point = epd_text_utf8_next_char(&next_current);
-
-                    if (epd_text_is_no_start_char(next_code_point))
-                    {
-                        // 次の文字の情報を取得
-                        const FontCharInfo *next_char_info = epd_text_find_char(local_config.font, next_code_point);
-                        if (next_char_info != NULL)
-                        {
-                            // 次の文字を追加した場合の幅を計算
-                            int next_width = new_width + next_char_info->img_width + local_config.char_spacing;
-                            // 次の文字を追加した場合の高さも計算
-                            int next_height = new_height + next_char_info->img_height + local_config.char_spacing;
-
-                            if (next_width > local_config.wrap_width || next_height > local_config.wrap_width)
-                            {
-                                // 行頭禁止文字が次の行に来てしまう場合、現在の文字でも折り返す
-                                pending_wrap = true;
-                            }
-                        }
-                    }
-                }
-                */
-                // 幅が制限内の場合、幅と高さを更新
-                segment_width = new_width;
-                segment_height = new_height;
-            }
-
-            // 前の文字の位置を記録
-            prev_char_start = char_start;
-            last_code_point = code_point;
-
-            //                ESP_LOGI(TAG, "---------------size now width:%d height:%d",new_width,new_height);
+            epd_text_draw_string_n(wrapper, current_x, current_y, text + line.offset, line.length, &local_config);
         }
 
-        // 最後のセグメントを追加
-        if (*segment_start != '\0')
+        if (local_config.vertical)
         {
-            segments[segment_count++] = segment_start;
+            current_x -= line_size; // 次の行（縦書きでは左に移動）
         }
-        //}
-
-        // 各セグメントを描画
-        for (int i = 0; i < segment_count && line_count < max_lines; i++)
+        else
         {
-            // このセグメントの長さを取得（次のセグメントまでか文字列終端まで）
-            int segment_len = (i < segment_count - 1) ? (segments[i + 1] - segments[i]) : strlen(segments[i]);
-
-            // このセグメントをnull終端の文字列にコピー
-            char *segment_str = (char *)malloc(segment_len + 1);
-            if (segment_str == NULL)
-            {
-                ESP_LOGE(TAG, "Failed to allocate memory for segment");
-                continue;
-            }
-
-            memcpy(segment_str, segments[i], segment_len);
-            segment_str[segment_len] = '\0';
-
-            // 描画領域を超えていないか確認
-            if (local_config.vertical)
-            {
-                if (current_x - line_size > rect->x + rect->width + config->box_padding)
-                {
-                    free(segment_str);
-                    break;
-                }
-            }
-            else
-            {
-                if (current_y + line_size > rect->y + rect->height - config->box_padding)
-                {
-                    free(segment_str);
-                    break;
-                }
-            }
-
-            // セグメントを描画
-            if (local_config.vertical)
-            {
-                epd_text_draw_string(wrapper, current_x, current_y, segment_str, &local_config);
-                current_x -= line_size; // 次の行（縦書きでは左に移動）
-            }
-            else
-            {
-                epd_text_draw_string(wrapper, current_x, current_y, segment_str, &local_config);
-                current_y += line_size; // 次の行（横書きでは下に移動）
-            }
-
-            free(segment_str);
-            line_count++;
+            current_y += line_size; // 次の行（横書きでは下に移動）
         }
-
-        // 次の行を取得
-        token = strtok(NULL, "\n");
+        line_count++;
     }
 
-    free(text_copy);
     return line_count;
 }
 
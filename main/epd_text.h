@@ -12,6 +12,7 @@
  
  #include <stdint.h>
  #include <stdbool.h>
+ #include <stddef.h>
  #include "epd_wrapper.h"
  
  /**
@@ -24,6 +25,13 @@
  #define TYPO_FLAG_NO_BREAK_END    0x10  // 行末禁則文字
  #define TYPE_FLAG_NO_BLANK        0x20  // 余白を詰める文字(―)
  
+ /**
+  * @brief コードポイント索引の設定
+  */
+ #define EPD_TEXT_MAX_FONT_INDEXES 4      // 索引を保持できるフォント数
+ #define EPD_TEXT_INDEX_PAGES      256    // BMPのページ数（上位8ビット）
+ #define EPD_TEXT_INDEX_PAGE_SIZE  256    // 1ページの要素数（下位8ビット）
+ 
  /**
   * @brief フォント文字情報構造体
   */
@@ -39,6 +47,17 @@
      int8_t y_offset;       // Y方向オフセット（表示位置の微調整用）
  } FontCharInfo;
  
+ /**
+  * @brief グリフのビットマップの形式（FontInfo.encoding）
+  */
+ #define EPD_FONT_ENCODING_RAW 0  // 1ビット/ピクセル、行ごとにバイト境界（MSB優先）
+ #define EPD_FONT_ENCODING_RLE 1  // 白と黒のランの長さを交互にExp-Golomb符号で並べたもの
+
+ /**
+  * @brief 圧縮時の符号の次数の上限（f2d.py は白を3以下、黒を2以下で選ぶ）
+  */
+ #define EPD_FONT_MAX_RUN_ORDER 7
+
  /**
   * @brief フォント情報
   */
@@ -51,6 +70,8 @@
      uint16_t chars_count;     // 収録文字数
      const FontCharInfo* chars; // 文字情報配列
      const uint8_t* bitmap_data; // ビットマップデータ配列
+     uint8_t encoding;         // ビットマップの形式（EPD_FONT_ENCODING_*、省略時は非圧縮）
+     uint8_t run_orders;       // 圧縮時の符号の次数（上位4ビット: 白のラン、下位4ビット: 黒のラン）
  } FontInfo;
  
  /**
@@ -98,6 +119,29 @@
 
  } EPDTextConfig;
  
+ /**
+  * @brief 行分割イテレータが返す1行分の情報
+  */
+ typedef struct {
+     size_t offset;             // テキスト先頭からの行の開始位置（バイト）
+     size_t length;             // 行のバイト数（改行文字は含まない）
+     int advance;               // 行の長さ（横書きは幅、縦書きは高さ。ピクセル単位）
+     bool hard_break;           // 改行文字で終わった行かどうか
+ } EPDTextLine;
+ 
+ /**
+  * @brief 行分割イテレータ
+  *
+  * テキストを複製せずに1行ずつ取り出す。ヒープは使用しない。
+  */
+ typedef struct {
+     const char* text;              // 対象のテキスト
+     size_t length;                 // テキストのバイト数
+     size_t pos;                    // 次の行の開始位置（バイト）
+     const EPDTextConfig* config;   // テキスト描画設定
+     int wrap_limit;                // 1行の最大の長さ（ピクセル単位）
+ } EPDTextLineBreaker;
+ 
  /**
   * @brief テキスト描画設定を初期化する
   * @param config 初期化する設定構造体へのポインタ
@@ -127,6 +171,18 @@
   */
  int epd_text_draw_string(EPDWrapper* wrapper, int x, int y, const char* text, const EPDTextConfig* config);
  
+ /**
+  * @brief 長さを指定してUTF-8文字列を描画する
+  * @param wrapper EPDラッパー構造体へのポインタ
+  * @param x X座標
+  * @param y Y座標
+  * @param text 描画するUTF-8文字列（ヌル終端でなくてもよい）
+  * @param length 描画するバイト数
+  * @param config テキスト描画設定
+  * @return 描画した文字列の幅
+  */
+ int epd_text_draw_string_n(EPDWrapper* wrapper, int x, int y, const char* text, size_t length, const EPDTextConfig* config);
+ 
 /**
  * @brief 文字が行頭禁止文字かどうかを判定する
  * @param font_char 判定するフォント情報
@@ -152,6 +208,47 @@ bool epd_text_is_no_end_char(const FontCharInfo* font_char);
  * @return 描画した行数
  */
 int epd_text_draw_multiline(EPDWrapper* wrapper, EpdRect* rect, const char* text, const EPDTextConfig* config);
+
+/**
+ * @brief 長さを指定して複数行のテキストを描画する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param rect 描画領域（この範囲内にテキストを収める）
+ * @param text 描画するUTF-8文字列（ヌル終端でなくてもよい）
+ * @param length テキストのバイト数
+ * @param config テキスト描画設定
+ * @return 描画した行数
+ */
+int epd_text_draw_multiline_n(EPDWrapper* wrapper, EpdRect* rect, const char* text, size_t length, const EPDTextConfig* config);
+
+/**
+ * @brief 複数行描画で矩形に収まる行数と1行の最大の長さを求める
+ * @param rect 描画領域
+ * @param config テキスト描画設定
+ * @param wrap_limit 1行の最大の長さの格納先（NULL可）
+ * @return 描画できる行数
+ *
+ * epd_text_draw_multiline() と同じ条件で計算するため、ページ分割に利用できます。
+ */
+int epd_text_multiline_capacity(const EpdRect* rect, const EPDTextConfig* config, int* wrap_limit);
+
+/**
+ * @brief 行分割イテレータを初期化する
+ * @param breaker 初期化するイテレータ
+ * @param text 分割するUTF-8テキスト（ヌル終端でなくてもよい）
+ * @param length テキストのバイト数
+ * @param config テキスト描画設定（フォント・文字間隔・縦横書きを参照）
+ * @param wrap_limit 1行の最大の長さ（横書きは幅、縦書きは高さ。ピクセル単位）
+ */
+void epd_text_line_breaker_init(EPDTextLineBreaker* breaker, const char* text, size_t length,
+                                const EPDTextConfig* config, int wrap_limit);
+
+/**
+ * @brief 次の1行を取得する
+ * @param breaker 行分割イテレータ
+ * @param line 取得した行の格納先
+ * @return 行を取得できた場合はtrue、テキストの終端に達した場合はfalse
+ */
+bool epd_text_line_breaker_next(EPDTextLineBreaker* breaker, EPDTextLine* line);
  
 /**
   * @brief ルビ付きテキストを描画する
@@ -172,6 +269,38 @@ int epd_text_draw_multiline(EPDWrapper* wrapper, EpdRect* rect, const char* text
   * @return 該当する文字情報のポインタ。見つからない場合はNULL
   */
  const FontCharInfo* epd_text_find_char(const FontInfo* font, uint32_t code_point);
+
+ /**
+  * @brief グリフのビットマップが範囲内に収まっているかを検査する
+  * @param font フォント情報
+  * @param char_info 検査する文字情報
+  * @param limit data_offset から読んでよいバイト数
+  * @return 形式が正しく、limit を超えて読まない場合はtrue
+  *
+  * 圧縮されたフォントでは実際に復号して長さを確かめます。
+  * 実行時に読み込むフォントのように、内容を信頼できないデータを開くときに使います。
+  */
+ bool epd_text_check_glyph_data(const FontInfo* font, const FontCharInfo* char_info, size_t limit);
+ 
+ /**
+  * @brief フォントを登録し、コードポイント索引を作成する
+  * @param font フォント情報
+  * @return 索引を作成できた（または登録済みだった）場合はtrue
+  *
+  * 登録しなくても初回の epd_text_find_char() で自動的に作成されます。
+  * 起動時に呼び出しておくと、最初の描画での作成コストを避けられます。
+  */
+ bool epd_text_register_font(const FontInfo* font);
+ 
+ /**
+  * @brief フォントの索引を破棄する
+  * @param font フォント情報
+  *
+  * フォントデータを解放・差し替える前に呼び出してください。
+  * 索引の登録・破棄はタスク間で排他されますが、破棄したフォントを他のタスクが
+  * 描画・検索していないことは呼び出し側で保証してください。
+  */
+ void epd_text_unregister_font(const FontInfo* font);
  
  /**
   * @brief UTF-8テキストから次の文字のUnicodeコードポイントを取得する
@@ -180,4 +309,12 @@ int epd_text_draw_multiline(EPDWrapper* wrapper, EpdRect* rect, const char* text
   */
  uint32_t epd_text_utf8_next_char(const char** text);
  
+ /**
+  * @brief 終端位置を指定してUTF-8テキストから次の文字を取得する
+  * @param text UTF-8テキストへのポインタのポインタ（処理後、ポインタは次の文字位置に進む）
+  * @param end テキストの終端（NULLの場合はヌル文字で終端）
+  * @return 次の文字のUnicodeコードポイント。終端の場合は0
+  */
+ uint32_t epd_text_utf8_next_char_n(const char** text, const char* end);
+ 
  #endif // EPD_TEXT_H
\ No newline at end of file
@@ -62,221 +62,331 @@ bool epd_transition_init(EPDWrapper *wrapper, EPDTransition *transition, int ste
 }
 
 /**
- * @brief グレースケールマスクを生成する内部関数
- * @param transition トランジション構造体へのポインタ
- * @param type トランジションの種類
- * @return 成功したかどうか
+ * @brief マスク値（0-15）を、そのピクセルが切り替わるステップ番号に変換する
+ *
+ * ステップkでは「マスク値 <= (k+1) * (16/steps) - 1」のピクセルが次画面になるため、
+ * 切り替わるステップは マスク値 / (16/steps) になります。
  */
-static bool generate_transition_mask(EPDTransition *transition, TransitionType type)
+static inline uint8_t mask_value_to_step(uint8_t value, int steps)
 {
-    if (transition == NULL)
-    {
-        return false;
-    }
-
-    // マスクの幅と高さを設定
-    transition->transition_width = EPD_DISPLAY_WIDTH;
-    transition->transition_height = EPD_DISPLAY_HEIGHT;
-
-    // マスクのサイズを計算 (4bit/pixel なので 2pixelで1バイト)
-    size_t mask_size = transition->transition_width * transition->transition_height / 2;
+    return value / (16 / steps);
+}
 
-    // すでにマスクが存在する場合は解放
-    if (transition->transition_mask != NULL)
+/**
+ * @brief 組み込みトランジションのマスク値を計算する
+ * @param type トランジションの種類
+ * @param x X座標
+ * @param y Y座標
+ * @return マスク値（0-15）
+ */
+static uint8_t builtin_mask_value(TransitionType type, int x, int y)
+{
+    int value;
+    switch (type)
     {
-        heap_caps_free(transition->transition_mask);
-        transition->transition_mask = NULL;
-    }
-
-    // PSRAMにマスク用メモリを確保
-    transition->transition_mask = heap_caps_malloc(mask_size, MALLOC_CAP_SPIRAM);
-    if (transition->transition_mask == NULL)
+    case TRANSITION_SLIDE_LEFT:
+        // 左から右へ 0→15
+        value = (x * 16) / EPD_DISPLAY_WIDTH;
+        break;
+    case TRANSITION_SLIDE_RIGHT:
+        // 右から左へ 0→15
+        value = ((EPD_DISPLAY_WIDTH - 1 - x) * 16) / EPD_DISPLAY_WIDTH;
+        break;
+    case TRANSITION_SLIDE_UP:
+        // 上から下へ 0→15
+        value = (y * 16) / EPD_DISPLAY_HEIGHT;
+        break;
+    case TRANSITION_SLIDE_DOWN:
+        // 下から上へ 0→15
+        value = ((EPD_DISPLAY_HEIGHT - 1 - y) * 16) / EPD_DISPLAY_HEIGHT;
+        break;
+    case TRANSITION_WIPE:
     {
-        ESP_LOGE(TAG, "Failed to allocate memory for transition mask");
-        return false;
+        // 対角線までの距離に応じた値
+        float diagonal_pos = ((float)x / EPD_DISPLAY_WIDTH) + ((float)y / EPD_DISPLAY_HEIGHT);
+        value = (int)(diagonal_pos * 8.0);
+        break;
     }
-
-    // マスクの種類に応じた値を設定
-    switch (type)
-    {
     case TRANSITION_FADE:
+    default:
         // フェード効果用のマスク (均一な値)
-        memset(transition->transition_mask, 0xFF, mask_size);
+        value = 15;
         break;
+    }
+    return value > 15 ? 15 : (uint8_t)value;
+}
 
-    case TRANSITION_SLIDE_LEFT:
-        // 左からスライド用のマスク
-        for (int y = 0; y < transition->transition_height; y++)
-        {
-            for (int x = 0; x < transition->transition_width; x++)
-            {
-                // x座標に応じてグラデーション値を設定 (左から右へ 0→15)
-                uint8_t value = (x * 16) / transition->transition_width;
-                if (value > 15)
-                    value = 15;
+/**
+ * @brief 組み込みトランジションのステップマップを生成する
+ * @param step_map 出力先（画面サイズ、4bit/pixel）
+ * @param type トランジションの種類
+ * @param steps ステップ数
+ *
+ * 一度だけ生成してキャッシュするため、ここでは速度より分かりやすさを優先しています。
+ */
+static void build_builtin_step_map(uint8_t *step_map, TransitionType type, int steps)
+{
+    const int row_bytes = EPD_DISPLAY_WIDTH / 2;
 
-                // 4bit/pixelフォーマットなので、2ピクセルで1バイト
-                int pos = y * transition->transition_width + x;
-                int byte_pos = pos / 2;
+    for (int y = 0; y < EPD_DISPLAY_HEIGHT; y++)
+    {
+        uint8_t *row = step_map + (size_t)y * row_bytes;
 
-                if (pos % 2 == 0)
-                {
-                    // 偶数ピクセルは下位4ビット
-                    transition->transition_mask[byte_pos] =
-                        (transition->transition_mask[byte_pos] & 0xF0) | value;
-                }
-                else
-                {
-                    // 奇数ピクセルは上位4ビット
-                    transition->transition_mask[byte_pos] =
-                        (transition->transition_mask[byte_pos] & 0x0F) | (value << 4);
-                }
-            }
+        // X方向にのみ依存するマスクは1行目をコピーするだけでよい
+        if (y > 0 && (type == TRANSITION_SLIDE_LEFT || type == TRANSITION_SLIDE_RIGHT ||
+                      type == TRANSITION_FADE))
+        {
+            memcpy(row, step_map, row_bytes);
+            continue;
         }
-        break;
 
-    case TRANSITION_SLIDE_RIGHT:
-        // 右からスライド用のマスク
-        for (int y = 0; y < transition->transition_height; y++)
+        for (int x = 0; x < EPD_DISPLAY_WIDTH; x += 2)
         {
-            for (int x = 0; x < transition->transition_width; x++)
-            {
-                // x座標に応じてグラデーション値を設定 (右から左へ 0→15)
-                uint8_t value = ((transition->transition_width - 1 - x) * 16) / transition->transition_width;
-                if (value > 15)
-                    value = 15;
+            uint8_t lo = mask_value_to_step(builtin_mask_value(type, x, y), steps);
+            uint8_t hi = mask_value_to_step(builtin_mask_value(type, x + 1, y), steps);
+            row[x / 2] = lo | (hi << 4);
+        }
+    }
+}
 
-                // 4bit/pixelフォーマットなので、2ピクセルで1バイト
-                int pos = y * transition->transition_width + x;
-                int byte_pos = pos / 2;
+/**
+ * @brief カスタムマスクを画面サイズに拡大縮小してステップマップを生成する
+ * @param step_map 出力先（画面サイズ、4bit/pixel）
+ * @param mask_data マスク画像データ（4bit/pixel）
+ * @param width マスク画像の幅
+ * @param height マスク画像の高さ
+ * @param steps ステップ数
+ */
+static void build_custom_step_map(uint8_t *step_map, const uint8_t *mask_data,
+                                  int width, int height, int steps)
+{
+    const int row_bytes = EPD_DISPLAY_WIDTH / 2;
+    int prev_mask_y = -1;
 
-                if (pos % 2 == 0)
-                {
-                    // 偶数ピクセルは下位4ビット
-                    transition->transition_mask[byte_pos] =
-                        (transition->transition_mask[byte_pos] & 0xF0) | value;
-                }
-                else
-                {
-                    // 奇数ピクセルは上位4ビット
-                    transition->transition_mask[byte_pos] =
-                        (transition->transition_mask[byte_pos] & 0x0F) | (value << 4);
-                }
-            }
+    for (int y = 0; y < EPD_DISPLAY_HEIGHT; y++)
+    {
+        uint8_t *row = step_map + (size_t)y * row_bytes;
+        int mask_y = (y * height) / EPD_DISPLAY_HEIGHT;
+
+        // 同じマスク行を参照する行はコピーで済ませる
+        if (mask_y == prev_mask_y)
+        {
+            memcpy(row, row - row_bytes, row_bytes);
+            continue;
         }
-        break;
+        prev_mask_y = mask_y;
 
-    case TRANSITION_SLIDE_UP:
-        // 上からスライド用のマスク
-        for (int y = 0; y < transition->transition_height; y++)
+        for (int x = 0; x < EPD_DISPLAY_WIDTH; x++)
         {
-            for (int x = 0; x < transition->transition_width; x++)
+            int mask_x = (x * width) / EPD_DISPLAY_WIDTH;
+            int mask_pos = mask_y * width + mask_x;
+            uint8_t value = (mask_pos % 2 == 0) ? (mask_data[mask_pos / 2] & 0x0F)
+                                                : (mask_data[mask_pos / 2] >> 4);
+            uint8_t step = mask_value_to_step(value, steps);
+
+            if (x % 2 == 0)
+            {
+                row[x / 2] = step;
+            }
+            else
             {
-                // y座標に応じてグラデーション値を設定 (上から下へ 0→15)
-                uint8_t value = (y * 16) / transition->transition_height;
-                if (value > 15)
-                    value = 15;
+                row[x / 2] |= step << 4;
+            }
+        }
+    }
+}
 
-                // 4bit/pixelフォーマットなので、2ピクセルで1バイト
-                int pos = y * transition->transition_width + x;
-                int byte_pos = pos / 2;
+/**
+ * @brief 組み込みトランジションのステップマップのキャッシュ
+ *
+ * 種類とステップ数が同じなら同じマップになるため、モジュール全体で共有します。
+ * 参照中のエントリは破棄しません。
+ */
+typedef struct
+{
+    TransitionType type; // トランジションの種類
+    int steps;           // ステップ数
+    uint8_t *step_map;   // ステップマップ（PSRAM）
+    int refs;            // 参照しているトランジションの数
+    uint32_t last_used;  // 最後に使用した時刻（LRU判定用）
+} StepMapCacheEntry;
 
-                if (pos % 2 == 0)
-                {
-                    // 偶数ピクセルは下位4ビット
-                    transition->transition_mask[byte_pos] =
-                        (transition->transition_mask[byte_pos] & 0xF0) | value;
-                }
-                else
-                {
-                    // 奇数ピクセルは上位4ビット
-                    transition->transition_mask[byte_pos] =
-                        (transition->transition_mask[byte_pos] & 0x0F) | (value << 4);
-                }
-            }
+static StepMapCacheEntry s_step_map_cache[EPD_TRANSITION_MASK_CACHE_SIZE];
+static uint32_t s_step_map_clock;
+
+/**
+ * @brief キャッシュからステップマップを取得する（なければ生成する）
+ * @return ステップマップ。キャッシュに空きがない場合はNULL
+ */
+static uint8_t *step_map_cache_acquire(TransitionType type, int steps)
+{
+    StepMapCacheEntry *victim = NULL;
+
+    for (int i = 0; i < EPD_TRANSITION_MASK_CACHE_SIZE; i++)
+    {
+        StepMapCacheEntry *entry = &s_step_map_cache[i];
+        if (entry->step_map != NULL && entry->type == type && entry->steps == steps)
+        {
+            entry->refs++;
+            entry->last_used = ++s_step_map_clock;
+            return entry->step_map;
         }
-        break;
 
-    case TRANSITION_SLIDE_DOWN:
-        // 下からスライド用のマスク
-        for (int y = 0; y < transition->transition_height; y++)
+        // 空きスロット、または参照されていない最も古いエントリを再利用する
+        if (entry->refs == 0 &&
+            (victim == NULL ||
+             (victim->step_map != NULL &&
+              (entry->step_map == NULL || entry->last_used < victim->last_used))))
         {
-            for (int x = 0; x < transition->transition_width; x++)
-            {
-                // y座標に応じてグラデーション値を設定 (下から上へ 0→15)
-                uint8_t value = ((transition->transition_height - 1 - y) * 16) / transition->transition_height;
-                if (value > 15)
-                    value = 15;
+            victim = entry;
+        }
+    }
 
-                // 4bit/pixelフォーマットなので、2ピクセルで1バイト
-                int pos = y * transition->transition_width + x;
-                int byte_pos = pos / 2;
+    if (victim == NULL)
+    {
+        return NULL;
+    }
 
-                if (pos % 2 == 0)
-                {
-                    // 偶数ピクセルは下位4ビット
-                    transition->transition_mask[byte_pos] =
-                        (transition->transition_mask[byte_pos] & 0xF0) | value;
-                }
-                else
-                {
-                    // 奇数ピクセルは上位4ビット
-                    transition->transition_mask[byte_pos] =
-                        (transition->transition_mask[byte_pos] & 0x0F) | (value << 4);
-                }
-            }
+    if (victim->step_map == NULL)
+    {
+        victim->step_map = heap_caps_malloc(EPD_DISPLAY_WIDTH * EPD_DISPLAY_HEIGHT / 2, MALLOC_CAP_SPIRAM);
+        if (victim->step_map == NULL)
+        {
+            return NULL;
         }
-        break;
+    }
 
-    case TRANSITION_WIPE:
-        // ワイプ効果（対角線に沿ったグラデーション）
-        for (int y = 0; y < transition->transition_height; y++)
+    build_builtin_step_map(victim->step_map, type, steps);
+    victim->type = type;
+    victim->steps = steps;
+    victim->refs = 1;
+    victim->last_used = ++s_step_map_clock;
+
+    ESP_LOGI(TAG, "Generated transition mask for type %d (%d steps)", type, steps);
+    return victim->step_map;
+}
+
+/**
+ * @brief キャッシュから取得したステップマップの参照を解放する
+ */
+static void step_map_cache_release(const uint8_t *step_map)
+{
+    for (int i = 0; i < EPD_TRANSITION_MASK_CACHE_SIZE; i++)
+    {
+        if (s_step_map_cache[i].step_map == step_map && s_step_map_cache[i].refs > 0)
         {
-            for (int x = 0; x < transition->transition_width; x++)
-            {
-                // 対角線までの距離に応じた値
-                float diagonal_pos = ((float)x / transition->transition_width) +
-                                     ((float)y / transition->transition_height);
-                uint8_t value = (uint8_t)(diagonal_pos * 8.0); // 0-15の範囲にスケール
-                if (value > 15)
-                    value = 15;
-
-                // 4bit/pixelフォーマットなので、2ピクセルで1バイト
-                int pos = y * transition->transition_width + x;
-                int byte_pos = pos / 2;
-
-                if (pos % 2 == 0)
-                {
-                    // 偶数ピクセルは下位4ビット
-                    transition->transition_mask[byte_pos] =
-                        (transition->transition_mask[byte_pos] & 0xF0) | value;
-                }
-                else
-                {
-                    // 奇数ピクセルは上位4ビット
-                    transition->transition_mask[byte_pos] =
-                        (transition->transition_mask[byte_pos] & 0x0F) | (value << 4);
-                }
-            }
+            s_step_map_cache[i].refs--;
+            return;
         }
-        break;
+    }
+}
 
-    case TRANSITION_CUSTOM:
-        // カスタムマスクは別の関数で設定するため、ここでは何もしない
-        memset(transition->transition_mask, 0, mask_size);
-        break;
+/**
+ * @brief トランジションが保持しているマスクを手放す
+ */
+static void release_transition_mask(EPDTransition *transition)
+{
+    if (transition->transition_mask == NULL)
+    {
+        return;
+    }
 
-    default:
-        ESP_LOGE(TAG, "Unsupported transition type");
+    if (transition->mask_is_shared)
+    {
+        step_map_cache_release(transition->transition_mask);
+    }
+    else
+    {
         heap_caps_free(transition->transition_mask);
-        transition->transition_mask = NULL;
+    }
+    transition->transition_mask = NULL;
+    transition->mask_is_shared = false;
+}
+
+/**
+ * @brief トランジション専用のステップマップ領域を用意する
+ *
+ * すでに専用の領域を持っている場合はそれを再利用します。
+ */
+static bool ensure_owned_mask(EPDTransition *transition)
+{
+    if (transition->transition_mask != NULL && !transition->mask_is_shared)
+    {
+        return true;
+    }
+
+    release_transition_mask(transition);
+    transition->transition_mask = heap_caps_malloc(EPD_DISPLAY_WIDTH * EPD_DISPLAY_HEIGHT / 2,
+                                                   MALLOC_CAP_SPIRAM);
+    return transition->transition_mask != NULL;
+}
+
+/**
+ * @brief グレースケールマスクからステップマップを用意する内部関数
+ * @param transition トランジション構造体へのポインタ
+ * @param type トランジションの種類
+ * @return 成功したかどうか
+ */
+static bool generate_transition_mask(EPDTransition *transition, TransitionType type)
+{
+    if (transition == NULL)
+    {
+        return false;
+    }
+
+    if (type < TRANSITION_FADE || type > TRANSITION_CUSTOM)
+    {
+        ESP_LOGE(TAG, "Unsupported transition type");
         return false;
     }
 
-    ESP_LOGI(TAG, "Generated transition mask for type %d", type);
+    // ステップマップは常に画面サイズ
+    transition->transition_width = EPD_DISPLAY_WIDTH;
+    transition->transition_height = EPD_DISPLAY_HEIGHT;
+
+    if (type == TRANSITION_CUSTOM)
+    {
+        // カスタムマスクは別の関数で設定するため、ここでは最初のステップで全て切り替わるマップにする
+        if (!ensure_owned_mask(transition))
+        {
+            ESP_LOGE(TAG, "Failed to allocate memory for transition mask");
+            return false;
+        }
+        memset(transition->transition_mask, 0, EPD_DISPLAY_WIDTH * EPD_DISPLAY_HEIGHT / 2);
+        return true;
+    }
+
+    release_transition_mask(transition);
+    transition->transition_mask = step_map_cache_acquire(type, transition->steps);
+    if (transition->transition_mask != NULL)
+    {
+        transition->mask_is_shared = true;
+        return true;
+    }
+
+    // キャッシュがすべて使用中の場合は専用の領域に生成する
+    if (!ensure_owned_mask(transition))
+    {
+        ESP_LOGE(TAG, "Failed to allocate memory for transition mask");
+        return false;
+    }
+    build_builtin_step_map(transition->transition_mask, type, transition->steps);
     return true;
 }
 
+void epd_transition_clear_cache(void)
+{
+    for (int i = 0; i < EPD_TRANSITION_MASK_CACHE_SIZE; i++)
+    {
+        StepMapCacheEntry *entry = &s_step_map_cache[i];
+        if (entry->step_map != NULL && entry->refs == 0)
+        {
+            heap_caps_free(entry->step_map);
+            memset(entry, 0, sizeof(*entry));
+        }
+    }
+}
+
 // トランジションの準備を行う
 bool epd_transition_prepare(EPDWrapper *wrapper, EPDTransition *transition,
                             TransitionType type, enum EpdDrawMode update_mode)
@@ -333,33 +443,26 @@ bool epd_transition_prepare_with_mask(EPDWrapper *wrapper, EPDTransition *transi
         transition->is_active = false;
     }
 
+    if (width <= 0 || height <= 0)
+    {
+        ESP_LOGE(TAG, "Invalid custom mask size: %dx%d", width, height);
+        return false;
+    }
+
     // パラメータを設定
     transition->type = TRANSITION_CUSTOM;
     transition->update_mode = update_mode;
     transition->current_step = 0;
-    transition->transition_width = width;
-    transition->transition_height = height;
-
-    // マスク用メモリを確保
-    size_t mask_size = width * height / 2; // 4bit/pixelなので
 
-    // すでにマスクが存在する場合は解放
-    if (transition->transition_mask != NULL)
-    {
-        heap_caps_free(transition->transition_mask);
-        transition->transition_mask = NULL;
-    }
-
-    // PSRAMにマスク用メモリを確保
-    transition->transition_mask = heap_caps_malloc(mask_size, MALLOC_CAP_SPIRAM);
-    if (transition->transition_mask == NULL)
+    // マスクは準備の時点で画面サイズに拡大縮小してステップマップにしておく
+    if (!ensure_owned_mask(transition))
     {
         ESP_LOGE(TAG, "Failed to allocate memory for custom transition mask");
         return false;
     }
-
-    // マスクデータをコピー
-    memcpy(transition->transition_mask, mask_data, mask_size);
+    build_custom_step_map(transition->transition_mask, mask_data, width, height, transition->steps);
+    transition->transition_width = EPD_DISPLAY_WIDTH;
+    transition->transition_height = EPD_DISPLAY_HEIGHT;
 
     // トランジションを開始
     transition->is_active = true;
@@ -381,43 +484,99 @@ uint8_t *epd_transition_get_next_framebuffer(EPDTransition *transition)
 }
 
 /**
- * @brief 現在のステップのしきい値を取得する内部関数
- * @param transition トランジション構造体へのポインタ
- * @return 現在のステップのしきい値（0-15）
+ * @brief 帯（横方向に分割した画面の一部）ごとの変化範囲
+ */
+typedef struct
+{
+    int min_word; // 変化した最初のワード位置（行内、-1は変化なし）
+    int max_word; // 変化した最後のワード位置（行内）
+    int min_y;    // 変化した最初の行
+    int max_y;    // 変化した最後の行
+} StepBand;
+
+/**
+ * @brief ステップマップに従って次画面のピクセルを合成する内部関数
+ * @param dst 現在のフレームバッファ
+ * @param next 次画面のフレームバッファ
+ * @param step_map ステップマップ
+ * @param step 現在のステップ番号
+ * @param bands 帯ごとの変化範囲の格納先（EPD_TRANSITION_BAND_COUNT個）
+ * @return 値が変化したピクセルを含むかどうか
+ *
+ * ステップマップの値がstep以下のニブルを次画面で置き換えます。
+ * 各ニブルを8ビットの区画に広げて (0x10 + step) - 値 を計算すると、
+ * 値 <= step のときだけ区画のビット4が立つため、分岐なしで選択マスクを作れます。
+ * 実際に値が変わったワードの範囲を帯ごとに記録します。
  */
-static uint8_t get_step_threshold(EPDTransition *transition)
+static bool merge_step(uint32_t *dst, const uint32_t *next, const uint32_t *step_map,
+                       int step, StepBand *bands)
 {
-    if (transition == NULL || transition->current_step >= transition->steps)
+    const uint32_t bias = 0x10101010u + (uint32_t)step * 0x01010101u;
+    const int words_per_row = EPD_DISPLAY_WIDTH / 8;
+    bool changed = false;
+
+    for (int band = 0; band < EPD_TRANSITION_BAND_COUNT; band++)
     {
-        return 0;
+        bands[band].min_word = -1;
     }
 
-    // 16ステップ以外の場合、非線形にマッピング
-    switch (transition->steps)
+    for (int y = 0; y < EPD_DISPLAY_HEIGHT; y++)
     {
-    case 2:
-        // 2ステップの場合： [0, 15]
-        return transition->current_step * 15;
-
-    case 4:
-        // 4ステップの場合： [0, 5, 10, 15]
-        return transition->current_step * 5;
+        int first = -1;
+        int last = -1;
 
-    case 8:
-        // 8ステップの場合： [0, 2, 4, 6, 8, 10, 12, 14]
-        return transition->current_step * 2;
+        for (int i = 0; i < words_per_row; i++)
+        {
+            uint32_t s = step_map[i];
+            uint32_t sel_lo = ((bias - (s & 0x0F0F0F0Fu)) >> 4) & 0x01010101u;
+            uint32_t sel_hi = ((bias - ((s >> 4) & 0x0F0F0F0Fu)) >> 4) & 0x01010101u;
+            uint32_t m = sel_lo * 0x0Fu | sel_hi * 0xF0u;
+            uint32_t diff = (dst[i] ^ next[i]) & m;
+            dst[i] ^= diff;
+
+            if (diff != 0)
+            {
+                if (first < 0)
+                {
+                    first = i;
+                }
+                last = i;
+            }
+        }
 
-    case 16:
-        // 16ステップの場合： [0, 1, 2, ..., 15]
-        return transition->current_step;
+        if (first >= 0)
+        {
+            StepBand *b = &bands[y * EPD_TRANSITION_BAND_COUNT / EPD_DISPLAY_HEIGHT];
+            if (b->min_word < 0)
+            {
+                b->min_word = first;
+                b->max_word = last;
+                b->min_y = y;
+            }
+            else
+            {
+                if (first < b->min_word)
+                    b->min_word = first;
+                if (last > b->max_word)
+                    b->max_word = last;
+            }
+            b->max_y = y;
+            changed = true;
+        }
 
-    default:
-        return 0;
+        dst += words_per_row;
+        next += words_per_row;
+        step_map += words_per_row;
     }
+
+    return changed;
 }
 
-// トランジションのステップを実行する
-bool epd_transition_step(EPDWrapper *wrapper, EPDTransition *transition)
+/**
+ * @brief 次のステップを実行できるか確かめる
+ * @return 実行できる場合true（完了済みの場合は非アクティブにしてfalse）
+ */
+static bool check_step(EPDWrapper *wrapper, EPDTransition *transition)
 {
     if (wrapper == NULL || transition == NULL || !wrapper->is_initialized ||
         transition->framebuffer_next == NULL || transition->transition_mask == NULL)
@@ -433,92 +592,46 @@ bool epd_transition_step(EPDWrapper *wrapper, EPDTransition *transition)
         ESP_LOGI(TAG, "Transition already completed");
         return false;
     }
+    return true;
+}
 
-    // 現在のステップに対応するしきい値を取得 (0-15)
-    uint8_t threshold = get_step_threshold(transition);
-    ESP_LOGI(TAG, "Transition step %d/%d with threshold %d",
-             transition->current_step + 1, transition->steps, threshold);
+// トランジションのステップを実行する
+bool epd_transition_step(EPDWrapper *wrapper, EPDTransition *transition)
+{
+    if (!check_step(wrapper, transition))
+    {
+        return false;
+    }
 
     // フレームバッファのサイズを計算
     size_t framebuffer_size = EPD_DISPLAY_WIDTH * EPD_DISPLAY_HEIGHT / 2;
 
-    // 単純化アプローチ：
-    // ステップごとに画面の一部分を更新する代わりに、マスク値に基づいて
-    // 特定の閾値以下のピクセルを全て更新
-
-    // 実際の処理で使用するしきい値を計算
-    // ステップ数に応じて閾値を計算し、その閾値以下のマスク値を持つピクセルを更新
-    int step_value = 16 / transition->steps;
-    uint8_t current_threshold = (transition->current_step + 1) * step_value - 1;
-    if (current_threshold > 15)
-        current_threshold = 15;
-
-    ESP_LOGI(TAG, "Using threshold value: %d for step %d",
-             current_threshold, transition->current_step + 1);
+    // ステップマップに基づいて、framebuffer_nextからframebufferへコピー
+    StepBand bands[EPD_TRANSITION_BAND_COUNT];
+    bool changed = merge_step((uint32_t *)wrapper->framebuffer,
+                              (const uint32_t *)transition->framebuffer_next,
+                              (const uint32_t *)transition->transition_mask,
+                              transition->current_step, bands);
 
-    // マスクに基づいて、framebuffer_nextからframebufferへコピー
-    for (int y = 0; y < EPD_DISPLAY_HEIGHT; y++)
+    // このステップで変化した帯だけを表示する（隣接する帯はラッパー側で統合される）
+    int area_count = 0;
+    if (changed)
     {
-        for (int x = 0; x < EPD_DISPLAY_WIDTH; x++)
+        for (int i = 0; i < EPD_TRANSITION_BAND_COUNT; i++)
         {
-            // ピクセル位置を計算
-            int pos = y * EPD_DISPLAY_WIDTH + x;
-            int byte_pos = pos / 2;
-            uint8_t mask_value;
-
-            // マスクが画面と同じサイズでなければスケーリング
-            if (transition->transition_width == EPD_DISPLAY_WIDTH &&
-                transition->transition_height == EPD_DISPLAY_HEIGHT)
+            if (bands[i].min_word < 0)
             {
-                // マスクが画面と同じサイズの場合、直接値を取得
-                if (pos % 2 == 0)
-                {
-                    mask_value = transition->transition_mask[byte_pos] & 0x0F;
-                }
-                else
-                {
-                    mask_value = (transition->transition_mask[byte_pos] & 0xF0) >> 4;
-                }
-            }
-            else
-            {
-                // マスクサイズが異なる場合はスケーリング
-                int mask_x = (x * transition->transition_width) / EPD_DISPLAY_WIDTH;
-                int mask_y = (y * transition->transition_height) / EPD_DISPLAY_HEIGHT;
-                int mask_pos = mask_y * transition->transition_width + mask_x;
-                int mask_byte_pos = mask_pos / 2;
-
-                if (mask_pos % 2 == 0)
-                {
-                    mask_value = transition->transition_mask[mask_byte_pos] & 0x0F;
-                }
-                else
-                {
-                    mask_value = (transition->transition_mask[mask_byte_pos] & 0xF0) >> 4;
-                }
-            }
-
-            // 現在のステップの閾値以下のマスク値を持つピクセルのみ更新
-            if (mask_value <= current_threshold)
-            {
-                uint8_t pixel;
-                if (pos % 2 == 0)
-                {
-                    pixel = transition->framebuffer_next[byte_pos] & 0x0F;
-                    wrapper->framebuffer[byte_pos] = (wrapper->framebuffer[byte_pos] & 0xF0) | pixel;
-                }
-                else
-                {
-                    pixel = (transition->framebuffer_next[byte_pos] & 0xF0);
-                    wrapper->framebuffer[byte_pos] = (wrapper->framebuffer[byte_pos] & 0x0F) | pixel;
-                }
+                continue;
             }
+            epd_wrapper_mark_dirty(wrapper, bands[i].min_word * 8, bands[i].min_y,
+                                   (bands[i].max_word - bands[i].min_word + 1) * 8,
+                                   bands[i].max_y - bands[i].min_y + 1);
         }
+        area_count = epd_wrapper_update_dirty(wrapper, transition->update_mode);
     }
 
-    // フレームバッファを表示
-    float temperature = epd_ambient_temperature();
-    epd_hl_update_screen(&wrapper->hl_state, transition->update_mode, temperature);
+    ESP_LOGI(TAG, "Transition step %d/%d refreshed %d area(s)",
+             transition->current_step + 1, transition->steps, area_count);
 
     // 次のステップへ
     transition->current_step++;
@@ -526,13 +639,12 @@ bool epd_transition_step(EPDWrapper *wrapper, EPDTransition *transition)
     // すべてのステップが完了したら非アクティブにする
     if (transition->current_step >= transition->steps)
     {
-        // 最後のステップでは、完全に次のフレームバッファの内容に置き換える
-        // （念のため、未更新領域がないように）
-        if (transition->current_step == transition->steps)
+        // 通常は最後のステップで次画面と一致しているが、途中で描画された場合などに備えて
+        // 一致しないときだけ次のフレームバッファの内容に置き換える
+        if (memcmp(wrapper->framebuffer, transition->framebuffer_next, framebuffer_size) != 0)
         {
             memcpy(wrapper->framebuffer, transition->framebuffer_next, framebuffer_size);
-            float temperature = epd_ambient_temperature();
-            epd_hl_update_screen(&wrapper->hl_state, transition->update_mode, temperature);
+            epd_wrapper_update_screen(wrapper, transition->update_mode);
         }
 
         transition->is_active = false;
@@ -542,6 +654,28 @@ bool epd_transition_step(EPDWrapper *wrapper, EPDTransition *transition)
     return true;
 }
 
+// 画面を更新せずにトランジションのステップを合成する
+bool epd_transition_compose_step(EPDWrapper *wrapper, EPDTransition *transition)
+{
+    if (!check_step(wrapper, transition))
+    {
+        return false;
+    }
+
+    StepBand bands[EPD_TRANSITION_BAND_COUNT];
+    merge_step((uint32_t *)wrapper->framebuffer,
+               (const uint32_t *)transition->framebuffer_next,
+               (const uint32_t *)transition->transition_mask,
+               transition->current_step, bands);
+
+    transition->current_step++;
+    if (transition->current_step >= transition->steps)
+    {
+        transition->is_active = false;
+    }
+    return true;
+}
+
 // トランジションを完了する (一度に残りのステップを実行)
 bool epd_transition_complete(EPDWrapper *wrapper, EPDTransition *transition)
 {
@@ -570,8 +704,7 @@ bool epd_transition_complete(EPDWrapper *wrapper, EPDTransition *transition)
     memcpy(wrapper->framebuffer, transition->framebuffer_next, framebuffer_size);
 
     // 画面を更新
-    float temperature = epd_ambient_temperature();
-    epd_hl_update_screen(&wrapper->hl_state, transition->update_mode, temperature);
+    epd_wrapper_update_screen(wrapper, transition->update_mode);
 
     // トランジションを完了
     transition->current_step = transition->steps;
@@ -596,12 +729,8 @@ void epd_transition_deinit(EPDWrapper *wrapper, EPDTransition *transition)
         transition->is_active = false;
     }
 
-    // トランジションマスクを解放
-    if (transition->transition_mask != NULL)
-    {
-        heap_caps_free(transition->transition_mask);
-        transition->transition_mask = NULL;
-    }
+    // トランジションマスクを解放（共有マスクは参照を外すだけ）
+    release_transition_mask(transition);
 
     // 次のフレームバッファを解放
     if (transition->framebuffer_next != NULL)
@@ -8,6 +8,24 @@
  
  #include "epd_wrapper.h"
  
+ /**
+  * @brief キャッシュしておく組み込みトランジションのマスク数
+  *
+  * マスクは種類とステップ数ごとに生成し、画面サイズ（4bit/pixel）でPSRAMに保持します。
+  */
+ #ifndef EPD_TRANSITION_MASK_CACHE_SIZE
+ #define EPD_TRANSITION_MASK_CACHE_SIZE 2
+ #endif
+ 
+ /**
+  * @brief 部分更新の範囲を求めるときの画面の分割数（横方向の帯の数）
+  *
+  * 各ステップでは帯ごとに変化したピクセルの外接矩形だけを更新します。
+  */
+ #ifndef EPD_TRANSITION_BAND_COUNT
+ #define EPD_TRANSITION_BAND_COUNT 8
+ #endif
+ 
  /**
   * @brief トランジションの種類
   */
@@ -26,7 +44,8 @@
   */
  typedef struct {
      uint8_t *framebuffer_next;     // 次のフレームバッファ (PSRAMに配置)
-     uint8_t *transition_mask;      // トランジションマスク画像
+     uint8_t *transition_mask;      // ピクセルごとの切り替えステップ番号 (画面サイズ、4bit/pixel)
+     bool mask_is_shared;           // マスクがキャッシュと共有されているか
      int transition_width;          // トランジションマスクの幅
      int transition_height;         // トランジションマスクの高さ
      TransitionType type;           // トランジションの種類
@@ -82,8 +101,21 @@
   * @param wrapper EPDラッパー構造体へのポインタ
   * @param transition トランジション構造体へのポインタ
   * @return 成功したかどうか
+  *
+  * このステップで値が変化した領域だけを部分更新します。
   */
  bool epd_transition_step(EPDWrapper *wrapper, EPDTransition *transition);
+
+ /**
+  * @brief 画面を更新せずにトランジションのステップを実行する
+  * @param wrapper EPDラッパー構造体へのポインタ
+  * @param transition トランジション構造体へのポインタ
+  * @return 成功したかどうか
+  *
+  * フレームバッファへの合成だけを行い、ダーティ矩形の記録と画面更新は行いません。
+  * 合成処理だけを計測するベンチマーク用です（表示する場合は epd_transition_step() を使用）。
+  */
+ bool epd_transition_compose_step(EPDWrapper *wrapper, EPDTransition *transition);
  
  /**
   * @brief トランジションを完了する (一度に残りのステップを実行)
@@ -100,4 +132,9 @@
   */
  void epd_transition_deinit(EPDWrapper *wrapper, EPDTransition *transition);
  
+ /**
+  * @brief キャッシュしているトランジションマスクのうち、使用されていないものを解放する
+  */
+ void epd_transition_clear_cache(void);
+ 
  #endif // EPD_TRANSITION_H
\ No newline at end of file
@@ -16,6 +16,385 @@
 
 static const char *TAG = "epd_wrapper";
 
+/**
+ * @brief 2つの矩形の和（外接矩形）を求める
+ */
+static EpdRect rect_union(EpdRect a, EpdRect b)
+{
+    int x0 = a.x < b.x ? a.x : b.x;
+    int y0 = a.y < b.y ? a.y : b.y;
+    int x1 = (a.x + a.width) > (b.x + b.width) ? (a.x + a.width) : (b.x + b.width);
+    int y1 = (a.y + a.height) > (b.y + b.height) ? (a.y + a.height) : (b.y + b.height);
+
+    EpdRect result = {
+        .x = x0,
+        .y = y0,
+        .width = x1 - x0,
+        .height = y1 - y0};
+    return result;
+}
+
+/**
+ * @brief 矩形innerが矩形outerに完全に含まれるかどうか
+ */
+static bool rect_contains(EpdRect outer, EpdRect inner)
+{
+    return inner.x >= outer.x && inner.y >= outer.y &&
+           inner.x + inner.width <= outer.x + outer.width &&
+           inner.y + inner.height <= outer.y + outer.height;
+}
+
+/**
+ * @brief 2つの矩形が重なるか、指定距離以内に隣接しているかどうか
+ */
+static bool rect_near(EpdRect a, EpdRect b, int gap)
+{
+    return a.x - gap < b.x + b.width && b.x - gap < a.x + a.width &&
+           a.y - gap < b.y + b.height && b.y - gap < a.y + a.height;
+}
+
+/**
+ * @brief 回転後の論理座標の矩形をフレームバッファ座標系の矩形に変換する
+ *
+ * epdiyの描画関数（epd_draw_pixel等）と同じ座標変換を矩形単位で行います。
+ */
+static EpdRect rect_to_physical(int rotation, EpdRect rect)
+{
+    EpdRect result = rect;
+    switch (rotation)
+    {
+    case 1: // 90度回転
+        result.x = EPD_DISPLAY_WIDTH - rect.y - rect.height;
+        result.y = rect.x;
+        result.width = rect.height;
+        result.height = rect.width;
+        break;
+    case 2: // 180度回転
+        result.x = EPD_DISPLAY_WIDTH - rect.x - rect.width;
+        result.y = EPD_DISPLAY_HEIGHT - rect.y - rect.height;
+        break;
+    case 3: // 270度回転
+        result.x = rect.y;
+        result.y = EPD_DISPLAY_HEIGHT - rect.x - rect.width;
+        result.width = rect.height;
+        result.height = rect.width;
+        break;
+    default: // 0度回転
+        break;
+    }
+    return result;
+}
+
+/**
+ * @brief フレームバッファ座標系の矩形を回転後の論理座標の矩形に変換する
+ *
+ * epd_hl_update_area() は回転後の座標で領域を受け取るため、その直前で使用します。
+ */
+static EpdRect rect_to_logical(int rotation, EpdRect rect)
+{
+    EpdRect result = rect;
+    switch (rotation)
+    {
+    case 1: // 90度回転
+        result.x = rect.y;
+        result.y = EPD_DISPLAY_WIDTH - rect.x - rect.width;
+        result.width = rect.height;
+        result.height = rect.width;
+        break;
+    case 2: // 180度回転
+        result.x = EPD_DISPLAY_WIDTH - rect.x - rect.width;
+        result.y = EPD_DISPLAY_HEIGHT - rect.y - rect.height;
+        break;
+    case 3: // 270度回転
+        result.x = EPD_DISPLAY_HEIGHT - rect.y - rect.height;
+        result.y = rect.x;
+        result.width = rect.height;
+        result.height = rect.width;
+        break;
+    default: // 0度回転
+        break;
+    }
+    return result;
+}
+
+/**
+ * @brief 矩形を画面（フレームバッファ）の範囲に切り詰める
+ * @return 切り詰めた結果、面積が残っていればtrue
+ */
+static bool rect_clip_to_screen(EpdRect *rect)
+{
+    int x0 = rect->x < 0 ? 0 : rect->x;
+    int y0 = rect->y < 0 ? 0 : rect->y;
+    int x1 = rect->x + rect->width;
+    int y1 = rect->y + rect->height;
+    if (x1 > EPD_DISPLAY_WIDTH)
+        x1 = EPD_DISPLAY_WIDTH;
+    if (y1 > EPD_DISPLAY_HEIGHT)
+        y1 = EPD_DISPLAY_HEIGHT;
+
+    if (x1 <= x0 || y1 <= y0)
+    {
+        return false;
+    }
+
+    rect->x = x0;
+    rect->y = y0;
+    rect->width = x1 - x0;
+    rect->height = y1 - y0;
+    return true;
+}
+
+/**
+ * @brief 2つの矩形の共通部分を求める
+ * @return 共通部分の面積が残っていればtrue（falseの場合resultは幅0の矩形）
+ */
+static bool rect_intersect(EpdRect a, EpdRect b, EpdRect *result)
+{
+    int x0 = a.x > b.x ? a.x : b.x;
+    int y0 = a.y > b.y ? a.y : b.y;
+    int x1 = (a.x + a.width < b.x + b.width) ? a.x + a.width : b.x + b.width;
+    int y1 = (a.y + a.height < b.y + b.height) ? a.y + a.height : b.y + b.height;
+
+    if (x1 <= x0 || y1 <= y0)
+    {
+        *result = (EpdRect){.x = x0, .y = y0, .width = 0, .height = 0};
+        return false;
+    }
+
+    *result = (EpdRect){.x = x0, .y = y0, .width = x1 - x0, .height = y1 - y0};
+    return true;
+}
+
+/**
+ * @brief 論理座標の矩形がクリップ矩形とどう重なるか
+ */
+typedef enum
+{
+    CLIP_OUTSIDE, // 見える部分がない（描画を省略できる）
+    CLIP_INSIDE,  // 全体が見える（切り詰めずに描画できる）
+    CLIP_PARTIAL, // 一部だけ見える
+} ClipResult;
+
+/**
+ * @brief 回転後の論理座標の矩形をクリップ矩形と比較する
+ * @param visible 見える部分（フレームバッファ座標系）の格納先
+ */
+static ClipResult clip_logical_rect(EPDWrapper *wrapper, int x, int y, int width, int height, EpdRect *visible)
+{
+    EpdRect rect = {
+        .x = x,
+        .y = y,
+        .width = width,
+        .height = height};
+    rect = rect_to_physical(wrapper->rotation, rect);
+    if (!rect_intersect(rect, wrapper->clip, visible))
+    {
+        return CLIP_OUTSIDE;
+    }
+    return rect_contains(wrapper->clip, rect) ? CLIP_INSIDE : CLIP_PARTIAL;
+}
+
+/**
+ * @brief 画像の見える部分を画像内の座標に変換する
+ * @param area 画像の描画先（回転後の論理座標）
+ * @param visible clip_logical_rect() で求めた見える部分（フレームバッファ座標系）
+ * @return 見える部分（画像の左上を原点とする座標）
+ *
+ * visible は画像の範囲に含まれるため、結果も画像の範囲に収まります。
+ */
+static EpdRect visible_image_rect(EPDWrapper *wrapper, EpdRect area, EpdRect visible)
+{
+    EpdRect rect = rect_to_logical(wrapper->rotation, visible);
+    rect.x -= area.x;
+    rect.y -= area.y;
+    return rect;
+}
+
+/**
+ * @brief 回転後の論理座標で描画した領域をダーティとして記録する
+ *
+ * クリップ矩形の外側は描画されないため、見える部分だけを記録します。
+ */
+static void mark_dirty_logical(EPDWrapper *wrapper, int x, int y, int width, int height)
+{
+    EpdRect visible;
+    if (clip_logical_rect(wrapper, x, y, width, height, &visible) != CLIP_OUTSIDE)
+    {
+        epd_wrapper_mark_dirty(wrapper, visible.x, visible.y, visible.width, visible.height);
+    }
+}
+
+// クリップ矩形の一部にかかる図形・画像の描画（ファイル後半で定義）
+static void fill_logical_rect(EPDWrapper *wrapper, int x, int y, int width, int height, uint8_t color);
+static void draw_line_clipped(EPDWrapper *wrapper, int x0, int y0, int x1, int y1, uint8_t color);
+static void draw_circle_clipped(EPDWrapper *wrapper, int x0, int y0, int r, uint8_t color);
+static void fill_circle_clipped(EPDWrapper *wrapper, int x0, int y0, int r, uint8_t color);
+static void copy_image_clipped(EPDWrapper *wrapper, EpdRect area, const uint8_t *image_data);
+static void put_logical_pixel(EPDWrapper *wrapper, int x, int y, uint8_t color);
+
+// 非同期更新中の電源操作をリフレッシュタスクに依頼する（ファイル後半で定義）
+static void send_power_request(EPDWrapper *wrapper, bool power_on);
+
+/**
+ * @brief パネル電源を切り替え、状態ごとの時間を記録する
+ *
+ * 電源を入れた時刻は駆動した時刻としても扱い、自動OFFまでの時間を数え直す。
+ */
+static void set_power(EPDWrapper *wrapper, bool on)
+{
+    if (wrapper->is_powered_on == on)
+    {
+        return;
+    }
+
+    TickType_t now = xTaskGetTickCount();
+    uint64_t elapsed_ms = (uint64_t)(now - wrapper->power_changed_at) * portTICK_PERIOD_MS;
+    if (on)
+    {
+        epd_poweron();
+        wrapper->power_stats.off_ms += elapsed_ms;
+        wrapper->power_stats.power_on_count++;
+        ESP_LOGI(TAG, "Powering on the display (was off for %llu ms)", (unsigned long long)elapsed_ms);
+    }
+    else
+    {
+        epd_poweroff();
+        wrapper->power_stats.on_ms += elapsed_ms;
+        ESP_LOGI(TAG, "Powering off the display (was on for %llu ms; total on %llu ms, off %llu ms, %lu power-ups)",
+                 (unsigned long long)elapsed_ms, (unsigned long long)wrapper->power_stats.on_ms,
+                 (unsigned long long)wrapper->power_stats.off_ms,
+                 (unsigned long)wrapper->power_stats.power_on_count);
+    }
+    wrapper->is_powered_on = on;
+    wrapper->power_changed_at = now;
+    wrapper->last_activity = now;
+}
+
+/**
+ * @brief 駆動の前に電源を入れ、電源が安定するまでの残り時間だけ待つ
+ *
+ * 事前投入（epd_wrapper_power_prewarm()）で早めに電源を入れていれば待たずに済む。
+ */
+static void power_up_for_drive(EPDWrapper *wrapper)
+{
+    set_power(wrapper, true);
+
+    TickType_t settle = EPD_WRAPPER_POWER_SETTLE_MS / portTICK_PERIOD_MS;
+    TickType_t elapsed = xTaskGetTickCount() - wrapper->power_changed_at;
+    if (elapsed < settle)
+    {
+        vTaskDelay(settle - elapsed);
+    }
+}
+
+/**
+ * @brief 温度センサーを読み、ヒステリシスを超えて変化した場合だけキャッシュを更新する
+ * @param initial キャッシュが空の場合はtrue（読んだ値をそのまま使う）
+ *
+ * センサーはロックの外で読み、温度と時刻だけをまとめて書き換えるので、
+ * 駆動側がセンサーの読み出しを待つことはない。
+ */
+static void sample_temperature(EPDWrapper *wrapper, bool initial)
+{
+    float raw = epd_ambient_temperature();
+    TickType_t now = xTaskGetTickCount();
+
+    xSemaphoreTake(wrapper->temperature_lock, portMAX_DELAY);
+    float previous = wrapper->temperature;
+    float delta = raw - previous;
+    if (delta < 0)
+    {
+        delta = -delta;
+    }
+    bool changed = initial || delta >= EPD_WRAPPER_TEMPERATURE_HYSTERESIS;
+    if (changed)
+    {
+        wrapper->temperature = raw;
+    }
+    wrapper->temperature_sampled_at = now;
+    xSemaphoreGive(wrapper->temperature_lock);
+
+    if (changed)
+    {
+        ESP_LOGD(TAG, "Temperature %.1f -> %.1f", previous, raw);
+    }
+}
+
+/**
+ * @brief 温度を定期的に読み直すタイマーのコールバック（esp_timerのタスクで呼ばれる）
+ */
+static void temperature_timer_callback(void *arg)
+{
+    sample_temperature((EPDWrapper *)arg, false);
+}
+
+/**
+ * @brief 更新に使う温度をキャッシュから読む
+ * @param sampled_at センサーを読んだ時刻の格納先（NULL可）
+ */
+static float read_temperature(EPDWrapper *wrapper, TickType_t *sampled_at)
+{
+    xSemaphoreTake(wrapper->temperature_lock, portMAX_DELAY);
+    float temperature = wrapper->temperature;
+    if (sampled_at != NULL)
+    {
+        *sampled_at = wrapper->temperature_sampled_at;
+    }
+    xSemaphoreGive(wrapper->temperature_lock);
+    return temperature;
+}
+
+/**
+ * @brief 温度のキャッシュを初期化し、定期的に読み直すタイマーを開始する
+ * @return キャッシュを用意できた場合はtrue（タイマーを開始できなくても初回の値は使える）
+ */
+static bool start_temperature_sampling(EPDWrapper *wrapper)
+{
+    wrapper->temperature_lock = xSemaphoreCreateMutex();
+    if (wrapper->temperature_lock == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create temperature lock");
+        return false;
+    }
+    sample_temperature(wrapper, true);
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = temperature_timer_callback,
+        .arg = wrapper,
+        .name = "epd_temperature",
+    };
+    if (esp_timer_create(&timer_args, &wrapper->temperature_timer) != ESP_OK ||
+        esp_timer_start_periodic(wrapper->temperature_timer,
+                                 (uint64_t)EPD_WRAPPER_TEMPERATURE_PERIOD_MS * 1000) != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Failed to start temperature timer, keeping the initial reading");
+        if (wrapper->temperature_timer != NULL)
+        {
+            esp_timer_delete(wrapper->temperature_timer);
+            wrapper->temperature_timer = NULL;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 温度のタイマーとロックを破棄する
+ */
+static void stop_temperature_sampling(EPDWrapper *wrapper)
+{
+    if (wrapper->temperature_timer != NULL)
+    {
+        esp_timer_stop(wrapper->temperature_timer);
+        esp_timer_delete(wrapper->temperature_timer);
+        wrapper->temperature_timer = NULL;
+    }
+    if (wrapper->temperature_lock != NULL)
+    {
+        vSemaphoreDelete(wrapper->temperature_lock);
+        wrapper->temperature_lock = NULL;
+    }
+}
+
 bool epd_wrapper_init(EPDWrapper *wrapper)
 {
     if (wrapper == NULL)
@@ -46,10 +425,20 @@ bool epd_wrapper_init(EPDWrapper *wrapper)
         return false;
     }
 
+    // 波形選択に使う温度を読み、以降はタイマーで読み直す
+    if (!start_temperature_sampling(wrapper))
+    {
+        epd_deinit();
+        return false;
+    }
+
     // デフォルト値を設定
     wrapper->is_initialized = true;
     wrapper->is_powered_on = false; // 明示的に電源OFFに設定
     wrapper->rotation = 0;          // デフォルトは0度回転（EPD_ROT_LANDSCAPE）
+    wrapper->clip = (EpdRect){.x = 0, .y = 0, .width = EPD_DISPLAY_WIDTH, .height = EPD_DISPLAY_HEIGHT};
+    wrapper->power_changed_at = xTaskGetTickCount();
+    wrapper->last_activity = wrapper->power_changed_at;
 
     ESP_LOGI(TAG, "EPD wrapper initialized successfully");
     return true;
@@ -63,15 +452,20 @@ void epd_wrapper_deinit(EPDWrapper *wrapper)
         return;
     }
 
+    // 非同期更新中なら終了させる
+    epd_wrapper_stop_async(wrapper);
+
     // 電源が入っていたら切る
     if (wrapper->is_powered_on)
     {
         ESP_LOGI(TAG, "Powering off the display before deinit");
-        epd_wrapper_power_off(wrapper);
+        set_power(wrapper, false);
         // 電源OFFが完了するまで少し待機
-        vTaskDelay(100 / portTICK_PERIOD_MS);
+        vTaskDelay(EPD_WRAPPER_POWER_SETTLE_MS / portTICK_PERIOD_MS);
     }
 
+    stop_temperature_sampling(wrapper);
+
     // EPDIYライブラリの終了処理
     ESP_LOGI(TAG, "Deinitializing epdiy library");
     epd_deinit();
@@ -95,14 +489,15 @@ void epd_wrapper_power_on(EPDWrapper *wrapper)
         return;
     }
 
-    if (!wrapper->is_powered_on)
+    // 駆動中に電源を切り替えないよう、非同期更新中はリフレッシュタスクに任せる
+    if (wrapper->is_async)
     {
-        // EPDIYライブラリのパネル電源ON
-        ESP_LOGI(TAG, "Powering on the display");
-        epd_poweron();
-        wrapper->is_powered_on = true;
-        // 電源が安定するまで少し待機
-        vTaskDelay(100 / portTICK_PERIOD_MS);
+        send_power_request(wrapper, true);
+    }
+    else if (!wrapper->is_powered_on)
+    {
+        // 電源が安定するまで待つ
+        power_up_for_drive(wrapper);
     }
     else
     {
@@ -118,13 +513,13 @@ void epd_wrapper_power_off(EPDWrapper *wrapper)
         return;
     }
 
-    if (wrapper->is_powered_on)
+    if (wrapper->is_async)
     {
-        ESP_LOGI(TAG, "Powering off the display");
-        epd_poweroff();
-        wrapper->is_powered_on = false;
-        // 電源OFFが完了するまで少し待機
-        vTaskDelay(100 / portTICK_PERIOD_MS);
+        send_power_request(wrapper, false);
+    }
+    else if (wrapper->is_powered_on)
+    {
+        set_power(wrapper, false);
     }
     else
     {
@@ -143,9 +538,27 @@ void epd_wrapper_fill(EPDWrapper *wrapper, uint8_t color)
     // 4ビット/ピクセルの場合、2つのピクセルで1バイトを共有
     // すべてのバイトに同じ値を書き込む
     memset(wrapper->framebuffer, color, EPD_DISPLAY_WIDTH * EPD_DISPLAY_HEIGHT / 2);
+    epd_wrapper_mark_dirty(wrapper, 0, 0, EPD_DISPLAY_WIDTH, EPD_DISPLAY_HEIGHT);
     ESP_LOGI(TAG, "Framebuffer filled with color 0x%02x", color);
 }
 
+/**
+ * @brief クリアサイクルの1画面の表示完了を待つ
+ *
+ * 非同期更新時は、次の塗りつぶしで上書きされる前に表示が終わるのを待つ。
+ */
+static void wait_clear_frame(EPDWrapper *wrapper)
+{
+    if (wrapper->is_async)
+    {
+        epd_wrapper_wait_idle(wrapper, portMAX_DELAY);
+    }
+    else
+    {
+        vTaskDelay(300 / portTICK_PERIOD_MS);
+    }
+}
+
 void epd_wrapper_clear_cycles(EPDWrapper *wrapper, int cycles)
 {
     if (wrapper == NULL || !wrapper->is_initialized)
@@ -154,12 +567,6 @@ void epd_wrapper_clear_cycles(EPDWrapper *wrapper, int cycles)
         return;
     }
 
-    if (!wrapper->is_powered_on)
-    {
-        ESP_LOGW(TAG, "EPD power is off, turning on for clear cycles");
-        epd_wrapper_power_on(wrapper);
-    }
-
     ESP_LOGI(TAG, "Starting %d clear cycles", cycles);
 
     // 最大サイクル数を制限（安全のため）
@@ -173,7 +580,7 @@ void epd_wrapper_clear_cycles(EPDWrapper *wrapper, int cycles)
     ESP_LOGI(TAG, "Initial fill with white");
     epd_wrapper_fill(wrapper, 0xFF);
     epd_wrapper_update_screen(wrapper, MODE_GC16);
-    vTaskDelay(300 / portTICK_PERIOD_MS);
+    wait_clear_frame(wrapper);
 
     for (int clear_count = 0; clear_count < cycles; clear_count++)
     {
@@ -186,39 +593,1116 @@ void epd_wrapper_clear_cycles(EPDWrapper *wrapper, int cycles)
             ESP_LOGI(TAG, "Filling with black");
             epd_wrapper_fill(wrapper, 0x00);
             epd_wrapper_update_screen(wrapper, MODE_GC16);
-            vTaskDelay(300 / portTICK_PERIOD_MS);
+            wait_clear_frame(wrapper);
         }
 
         // 白で塗りつぶし
         ESP_LOGI(TAG, "Filling with white");
         epd_wrapper_fill(wrapper, 0xFF);
         epd_wrapper_update_screen(wrapper, MODE_GC16);
-        vTaskDelay(300 / portTICK_PERIOD_MS);
+        wait_clear_frame(wrapper);
     }
 
+    // 全画面を白黒に振り切ったので残像のコストは不要
+    memset(wrapper->ghost_cost, 0, sizeof(wrapper->ghost_cost));
     ESP_LOGI(TAG, "Screen clearing complete");
 }
 
-void epd_wrapper_update_screen(EPDWrapper *wrapper, enum EpdDrawMode mode)
+/**
+ * @brief 更新要求（リフレッシュタスクへのキューの要素）
+ */
+typedef struct
 {
-    if (wrapper == NULL || !wrapper->is_initialized)
+    EpdRect area;         // 更新領域（フレームバッファ座標系）
+    EpdRect logical_area; // 更新領域（回転後の座標系、epd_hl_update_area用）
+    enum EpdDrawMode mode;
+    bool full_screen;     // 画面全体の更新か
+    bool clean;           // 残像消去の要求
+    bool prewarm;         // 電源の事前投入（保留数に数えない）
+    bool power_off;       // 電源OFFの要求
+    bool stop;            // タスク終了の要求
+} UpdateRequest;
+
+/**
+ * @brief 2つのフレームバッファ間で矩形領域をコピーする（バイト単位に広げる）
+ */
+static void copy_fb_area(uint8_t *dst, const uint8_t *src, EpdRect area)
+{
+    int row_bytes = EPD_DISPLAY_WIDTH / 2;
+    int x0 = area.x / 2;
+    int x1 = (area.x + area.width + 1) / 2;
+    for (int y = area.y; y < area.y + area.height; y++)
+    {
+        memcpy(dst + y * row_bytes + x0, src + y * row_bytes + x0, x1 - x0);
+    }
+}
+
+/**
+ * @brief 2つのフレームバッファの指定領域を比較して差分のヒストグラムを作る
+ */
+static void diff_histogram(const uint8_t *next_fb, const uint8_t *shown_fb, EpdRect area,
+                           EPDWrapperDiffHistogram *hist)
+{
+    memset(hist, 0, sizeof(*hist));
+    if (!rect_clip_to_screen(&area))
     {
-        ESP_LOGE(TAG, "EPD wrapper not initialized");
         return;
     }
 
-    if (!wrapper->is_powered_on)
+    int row_bytes = EPD_DISPLAY_WIDTH / 2;
+    int b0 = area.x / 2;
+    int b1 = (area.x + area.width + 1) / 2;
+    // 領域外のニブルを含む両端のバイトでは、領域内のニブルだけを比較する
+    uint8_t first_mask = (area.x & 1) ? 0xF0 : 0xFF;
+    uint8_t last_mask = ((area.x + area.width) & 1) ? 0x0F : 0xFF;
+    if (b1 - b0 == 1)
+    {
+        first_mask &= last_mask;
+        last_mask = first_mask;
+    }
+
+    for (int y = area.y; y < area.y + area.height; y++)
+    {
+        const uint8_t *next = next_fb + y * row_bytes;
+        const uint8_t *shown = shown_fb + y * row_bytes;
+        if (memcmp(next + b0, shown + b0, b1 - b0) == 0)
+        {
+            continue;
+        }
+
+        for (int b = b0; b < b1; b++)
+        {
+            uint8_t mask = b == b0 ? first_mask : (b == b1 - 1 ? last_mask : 0xFF);
+            uint8_t diff = (next[b] ^ shown[b]) & mask;
+            if (diff == 0)
+            {
+                continue;
+            }
+            if (diff & 0x0F)
+            {
+                hist->changed++;
+                hist->old_levels[shown[b] & 0x0F]++;
+                hist->new_levels[next[b] & 0x0F]++;
+            }
+            if (diff & 0xF0)
+            {
+                hist->changed++;
+                hist->old_levels[shown[b] >> 4]++;
+                hist->new_levels[next[b] >> 4]++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief ヒストグラムの中に黒(0)と白(15)以外の階調があるかどうか
+ */
+static bool has_intermediate_levels(const uint32_t levels[16])
+{
+    for (int i = 1; i < 15; i++)
+    {
+        if (levels[i] != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+enum EpdDrawMode epd_wrapper_select_mode(const EPDWrapperDiffHistogram *hist)
+{
+    if (hist == NULL || hist->changed == 0)
+    {
+        return EPD_WRAPPER_AUTO_MODE_MONO;
+    }
+
+    if (!has_intermediate_levels(hist->new_levels))
+    {
+        // 黒・白だけへの変化はDU系で正しく表示できる
+        return has_intermediate_levels(hist->old_levels) ? EPD_WRAPPER_AUTO_MODE_TO_MONO
+                                                         : EPD_WRAPPER_AUTO_MODE_MONO;
+    }
+
+    // 中間調が現れる場合、白の上に描いただけならフラッシュの少ないGL16系を使う
+    if (hist->old_levels[15] == hist->changed)
+    {
+        return EPD_WRAPPER_AUTO_MODE_GRAY_ON_WHITE;
+    }
+    return EPD_WRAPPER_AUTO_MODE_GRAY;
+}
+
+void epd_wrapper_diff_histogram(EPDWrapper *wrapper, EpdRect area, EPDWrapperDiffHistogram *hist)
+{
+    if (hist == NULL)
+    {
+        return;
+    }
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        memset(hist, 0, sizeof(*hist));
+        return;
+    }
+    diff_histogram(wrapper->framebuffer, wrapper->hl_state.back_fb, area, hist);
+}
+
+/**
+ * @brief 自動選択の場合に、epdiyのフレームバッファと表示中の内容の差分からモードを決める
+ * @return 使用するモード（変化がない場合は EPD_WRAPPER_MODE_AUTO）
+ */
+static enum EpdDrawMode resolve_mode(EPDWrapper *wrapper, EpdRect area, enum EpdDrawMode mode)
+{
+    if (mode != EPD_WRAPPER_MODE_AUTO)
+    {
+        return mode;
+    }
+
+    EPDWrapperDiffHistogram hist;
+    diff_histogram(epd_hl_get_framebuffer(&wrapper->hl_state), wrapper->hl_state.back_fb, area, &hist);
+    if (hist.changed == 0)
+    {
+        ESP_LOGD(TAG, "Area %d,%d [%dx%d] unchanged, skipping update",
+                 area.x, area.y, area.width, area.height);
+        return EPD_WRAPPER_MODE_AUTO;
+    }
+
+    enum EpdDrawMode selected = epd_wrapper_select_mode(&hist);
+    ESP_LOGD(TAG, "Auto mode: %lu px changed, selected mode %d",
+             (unsigned long)hist.changed, selected);
+    return selected;
+}
+
+/**
+ * @brief 残像が蓄積しやすい高速モードかどうか
+ */
+static bool is_fast_mode(enum EpdDrawMode mode)
+{
+    switch (mode)
+    {
+    case MODE_DU:
+    case MODE_DU4:
+    case MODE_A2:
+    case MODE_EPDIY_MONOCHROME:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief 矩形（フレームバッファ座標系）が重なるタイルの範囲を求める
+ * @return 重なるタイルがあればtrue（終端は含まない）
+ */
+static bool ghost_tile_range(EpdRect area, int *tx0, int *ty0, int *tx1, int *ty1)
+{
+    if (!rect_clip_to_screen(&area))
+    {
+        return false;
+    }
+    *tx0 = area.x / EPD_WRAPPER_GHOST_TILE_SIZE;
+    *ty0 = area.y / EPD_WRAPPER_GHOST_TILE_SIZE;
+    *tx1 = (area.x + area.width + EPD_WRAPPER_GHOST_TILE_SIZE - 1) / EPD_WRAPPER_GHOST_TILE_SIZE;
+    *ty1 = (area.y + area.height + EPD_WRAPPER_GHOST_TILE_SIZE - 1) / EPD_WRAPPER_GHOST_TILE_SIZE;
+    return true;
+}
+
+/**
+ * @brief 更新した領域のタイルに残像のコストを加える
+ *
+ * MODE_INIT は全ピクセルを白黒に振り切るため、コストを0に戻します。
+ */
+static void account_ghosting(EPDWrapper *wrapper, EpdRect area, enum EpdDrawMode mode)
+{
+    int tx0, ty0, tx1, ty1;
+    if (!ghost_tile_range(area, &tx0, &ty0, &tx1, &ty1))
+    {
+        return;
+    }
+
+    int cost = is_fast_mode(mode) ? EPD_WRAPPER_GHOST_COST_FAST : EPD_WRAPPER_GHOST_COST_GRAY;
+    for (int ty = ty0; ty < ty1; ty++)
+    {
+        for (int tx = tx0; tx < tx1; tx++)
+        {
+            uint8_t *tile = &wrapper->ghost_cost[ty][tx];
+            if (mode == MODE_INIT)
+            {
+                *tile = 0;
+            }
+            else
+            {
+                *tile = (*tile + cost > 255) ? 255 : *tile + cost;
+            }
+        }
+    }
+}
+
+/**
+ * @brief コストが上限に達したタイルの数を返す
+ */
+static int count_spent_tiles(EPDWrapper *wrapper)
+{
+    int count = 0;
+    for (int ty = 0; ty < EPD_WRAPPER_GHOST_TILES_Y; ty++)
+    {
+        for (int tx = 0; tx < EPD_WRAPPER_GHOST_TILES_X; tx++)
+        {
+            if (wrapper->ghost_cost[ty][tx] >= EPD_WRAPPER_GHOST_BUDGET)
+            {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief 指定領域の表示内容を反転・復元する2回のGC16更新で残像を消す
+ *
+ * epdiyは表示中の内容と異なるピクセルだけを駆動するため、一度反転した内容を表示してから
+ * 元に戻すことで、領域内のすべてのピクセルを正しい遷移元からGC16で駆動し直す。
+ */
+static void clean_area(EPDWrapper *wrapper, EpdRect area)
+{
+    power_up_for_drive(wrapper);
+
+    uint8_t *front_fb = epd_hl_get_framebuffer(&wrapper->hl_state);
+    EpdRect logical_area = rect_to_logical(wrapper->rotation, area);
+    int row_bytes = EPD_DISPLAY_WIDTH / 2;
+    float temperature = read_temperature(wrapper, NULL);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int y = area.y; y < area.y + area.height; y++)
+        {
+            uint8_t *row = front_fb + y * row_bytes + area.x / 2;
+            for (int i = 0; i < area.width / 2; i++)
+            {
+                row[i] ^= 0xFF;
+            }
+        }
+        epd_hl_update_area(&wrapper->hl_state, MODE_GC16, temperature, logical_area);
+    }
+    wrapper->last_activity = xTaskGetTickCount();
+    ESP_LOGI(TAG, "Ghosting cleaned in %d,%d [%dx%d]", area.x, area.y, area.width, area.height);
+}
+
+/**
+ * @brief コストが上限に達したタイルを矩形にまとめて消去する
+ * @param yield_to_updates trueの場合、更新要求が届いたら残りを次の機会に回す
+ * @return 消去したタイルの数
+ */
+static int clean_spent_tiles(EPDWrapper *wrapper, bool yield_to_updates)
+{
+    int cleaned = 0;
+    for (int ty = 0; ty < EPD_WRAPPER_GHOST_TILES_Y; ty++)
+    {
+        for (int tx = 0; tx < EPD_WRAPPER_GHOST_TILES_X; tx++)
+        {
+            if (wrapper->ghost_cost[ty][tx] < EPD_WRAPPER_GHOST_BUDGET)
+            {
+                continue;
+            }
+            if (yield_to_updates && uxQueueMessagesWaiting(wrapper->update_queue) > 0)
+            {
+                return cleaned;
+            }
+
+            // 右に続く対象タイルをまとめ、同じ幅がすべて対象の行を下に広げる
+            int tx1 = tx + 1;
+            while (tx1 < EPD_WRAPPER_GHOST_TILES_X && wrapper->ghost_cost[ty][tx1] >= EPD_WRAPPER_GHOST_BUDGET)
+            {
+                tx1++;
+            }
+            int ty1 = ty + 1;
+            while (ty1 < EPD_WRAPPER_GHOST_TILES_Y)
+            {
+                bool spent = true;
+                for (int i = tx; i < tx1 && spent; i++)
+                {
+                    spent = wrapper->ghost_cost[ty1][i] >= EPD_WRAPPER_GHOST_BUDGET;
+                }
+                if (!spent)
+                {
+                    break;
+                }
+                ty1++;
+            }
+
+            EpdRect area = {
+                .x = tx * EPD_WRAPPER_GHOST_TILE_SIZE,
+                .y = ty * EPD_WRAPPER_GHOST_TILE_SIZE,
+                .width = (tx1 - tx) * EPD_WRAPPER_GHOST_TILE_SIZE,
+                .height = (ty1 - ty) * EPD_WRAPPER_GHOST_TILE_SIZE};
+            clean_area(wrapper, area);
+
+            for (int y = ty; y < ty1; y++)
+            {
+                memset(&wrapper->ghost_cost[y][tx], 0, tx1 - tx);
+            }
+            cleaned += (tx1 - tx) * (ty1 - ty);
+        }
+    }
+    return cleaned;
+}
+
+/**
+ * @brief パネルを実際に駆動して画面全体を更新する
+ * @return 使用したモード（自動選択で変化がなかった場合は EPD_WRAPPER_MODE_AUTO）
+ */
+static enum EpdDrawMode drive_screen(EPDWrapper *wrapper, enum EpdDrawMode mode)
+{
+    EpdRect screen = {.x = 0, .y = 0, .width = EPD_DISPLAY_WIDTH, .height = EPD_DISPLAY_HEIGHT};
+    mode = resolve_mode(wrapper, screen, mode);
+    if (mode == EPD_WRAPPER_MODE_AUTO)
+    {
+        return mode;
+    }
+
+    power_up_for_drive(wrapper);
+    float temperature = read_temperature(wrapper, NULL);
+    epd_hl_update_screen(&wrapper->hl_state, mode, temperature);
+    wrapper->last_activity = xTaskGetTickCount();
+    account_ghosting(wrapper, screen, mode);
+    ESP_LOGI(TAG, "Screen updated with mode %d", mode);
+    return mode;
+}
+
+/**
+ * @brief パネルを実際に駆動して指定領域を更新する
+ * @return 使用したモード（自動選択で変化がなかった場合は EPD_WRAPPER_MODE_AUTO）
+ */
+static enum EpdDrawMode drive_area(EPDWrapper *wrapper, EpdRect area, EpdRect logical_area, enum EpdDrawMode mode)
+{
+    mode = resolve_mode(wrapper, area, mode);
+    if (mode == EPD_WRAPPER_MODE_AUTO)
+    {
+        return mode;
+    }
+
+    power_up_for_drive(wrapper);
+    float temperature = read_temperature(wrapper, NULL);
+    epd_hl_update_area(&wrapper->hl_state, mode, temperature, logical_area);
+    wrapper->last_activity = xTaskGetTickCount();
+    account_ghosting(wrapper, area, mode);
+    ESP_LOGD(TAG, "Area %d,%d [%dx%d] updated with mode %d",
+             area.x, area.y, area.width, area.height, mode);
+    return mode;
+}
+
+/**
+ * @brief 更新要求をキューに積む（非同期更新時）
+ *
+ * 要求時点の描画用バッファの内容を staging_fb にコピーしてから積むので、
+ * 呼び出し側はすぐに次の描画を始められる。
+ */
+static void submit_update(EPDWrapper *wrapper, const UpdateRequest *request)
+{
+    xSemaphoreTake(wrapper->fb_lock, portMAX_DELAY);
+    copy_fb_area(wrapper->staging_fb, wrapper->compose_fb, request->area);
+    wrapper->pending_updates++;
+    xEventGroupClearBits(wrapper->update_events, EPD_WRAPPER_EVENT_IDLE);
+    xSemaphoreGive(wrapper->fb_lock);
+
+    // キューが一杯の場合は空きができるまで待つ
+    xQueueSend(wrapper->update_queue, request, portMAX_DELAY);
+}
+
+/**
+ * @brief リフレッシュタスクが暇なときの処理（残像消去・電源OFF）までの待ち時間
+ */
+static TickType_t idle_wait(EPDWrapper *wrapper)
+{
+    TickType_t idle = xTaskGetTickCount() - wrapper->last_activity;
+    TickType_t wait = portMAX_DELAY;
+    if (count_spent_tiles(wrapper) > 0)
+    {
+        TickType_t limit = EPD_WRAPPER_GHOST_IDLE_MS / portTICK_PERIOD_MS;
+        wait = idle < limit ? limit - idle : 0;
+    }
+    if (wrapper->is_powered_on && EPD_WRAPPER_POWER_IDLE_MS > 0)
+    {
+        TickType_t limit = EPD_WRAPPER_POWER_IDLE_MS / portTICK_PERIOD_MS;
+        TickType_t remaining = idle < limit ? limit - idle : 0;
+        if (remaining < wait)
+        {
+            wait = remaining;
+        }
+    }
+    return wait;
+}
+
+/**
+ * @brief 更新モードの厳しさ（大きいほど画質を優先する）
+ */
+static int mode_strictness(enum EpdDrawMode mode)
+{
+    switch (mode)
+    {
+    case MODE_INIT:
+        return 4;
+    case MODE_GC16:
+        return 3;
+    case MODE_DU4:
+    case MODE_GL4:
+        return 1;
+    default:
+        return is_fast_mode(mode) ? 0 : 2;
+    }
+}
+
+/**
+ * @brief 2つの更新モードのうち厳しい方を返す（自動選択はもう一方に従う）
+ */
+static enum EpdDrawMode stricter_mode(enum EpdDrawMode a, enum EpdDrawMode b)
+{
+    if (a == EPD_WRAPPER_MODE_AUTO)
+    {
+        return b;
+    }
+    if (b == EPD_WRAPPER_MODE_AUTO)
+    {
+        return a;
+    }
+    return mode_strictness(b) > mode_strictness(a) ? b : a;
+}
+
+/**
+ * @brief 続けて届いた更新要求を1回の駆動にまとめる
+ * @param request 最初の要求（まとめた領域の和と最も厳しいモードで上書きされる）
+ * @param held まとめられない要求（残像消去・電源OFF・終了）を受け取った場合の格納先
+ * @param has_held heldに要求を格納した場合はtrue
+ * @param auto_requested 自動選択の要求が含まれていた場合はtrue
+ * @return まとめた要求の数（最初の要求を含む）
+ *
+ * 最初の要求から EPD_WRAPPER_COALESCE_MS の間に届いた要求と、
+ * 前回の駆動中にキューに溜まった要求をまとめる。
+ */
+static int coalesce_requests(EPDWrapper *wrapper, UpdateRequest *request,
+                             UpdateRequest *held, bool *has_held, bool *auto_requested)
+{
+    int merged = 1;
+    *auto_requested = request->mode == EPD_WRAPPER_MODE_AUTO;
+
+    TickType_t start = xTaskGetTickCount();
+    TickType_t window = EPD_WRAPPER_COALESCE_MS / portTICK_PERIOD_MS;
+    UpdateRequest next;
+    while (true)
+    {
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        TickType_t wait = elapsed < window ? window - elapsed : 0;
+        if (xQueueReceive(wrapper->update_queue, &next, wait) != pdTRUE)
+        {
+            break;
+        }
+        if (next.prewarm)
+        {
+            set_power(wrapper, true);
+            continue;
+        }
+        if (next.stop || next.clean || next.power_off)
+        {
+            *held = next;
+            *has_held = true;
+            break;
+        }
+
+        request->area = rect_union(request->area, next.area);
+        request->full_screen = request->full_screen || next.full_screen;
+        request->mode = stricter_mode(request->mode, next.mode);
+        *auto_requested = *auto_requested || next.mode == EPD_WRAPPER_MODE_AUTO;
+        merged++;
+    }
+
+    if (merged > 1)
+    {
+        request->logical_area = rect_to_logical(wrapper->rotation, request->area);
+        ESP_LOGD(TAG, "Coalesced %d updates into %d,%d [%dx%d] with mode %d", merged,
+                 request->area.x, request->area.y, request->area.width, request->area.height, request->mode);
+    }
+    return merged;
+}
+
+/**
+ * @brief リフレッシュタスク
+ *
+ * 更新要求を取り出し、続けて届いた要求をまとめてから staging_fb の該当領域を
+ * epdiy のフレームバッファにコピーしてパネルを駆動する。
+ */
+static void refresh_task(void *pvParameters)
+{
+    EPDWrapper *wrapper = (EPDWrapper *)pvParameters;
+    uint8_t *front_fb = epd_hl_get_framebuffer(&wrapper->hl_state);
+    UpdateRequest request;
+    UpdateRequest held;
+    bool has_held = false;
+
+    ESP_LOGI(TAG, "Refresh task started on core %d", xPortGetCoreID());
+
+    while (true)
+    {
+        if (has_held)
+        {
+            request = held;
+            has_held = false;
+        }
+        else if (xQueueReceive(wrapper->update_queue, &request, idle_wait(wrapper)) != pdTRUE)
+        {
+            // 一定時間更新がなければ、残像の消去待ちを消去してから電源を切る
+            TickType_t idle = xTaskGetTickCount() - wrapper->last_activity;
+            bool clean_due = count_spent_tiles(wrapper) > 0 &&
+                             idle >= EPD_WRAPPER_GHOST_IDLE_MS / portTICK_PERIOD_MS;
+            if (!clean_due)
+            {
+                if (wrapper->is_powered_on && EPD_WRAPPER_POWER_IDLE_MS > 0 &&
+                    idle >= EPD_WRAPPER_POWER_IDLE_MS / portTICK_PERIOD_MS)
+                {
+                    set_power(wrapper, false);
+                }
+                continue;
+            }
+
+            xSemaphoreTake(wrapper->fb_lock, portMAX_DELAY);
+            wrapper->pending_updates++;
+            xEventGroupClearBits(wrapper->update_events, EPD_WRAPPER_EVENT_IDLE);
+            xSemaphoreGive(wrapper->fb_lock);
+
+            clean_spent_tiles(wrapper, true);
+
+            xSemaphoreTake(wrapper->fb_lock, portMAX_DELAY);
+            if (--wrapper->pending_updates == 0)
+            {
+                xEventGroupSetBits(wrapper->update_events, EPD_WRAPPER_EVENT_IDLE);
+            }
+            xSemaphoreGive(wrapper->fb_lock);
+            continue;
+        }
+
+        if (request.stop)
+        {
+            break;
+        }
+        if (request.prewarm)
+        {
+            set_power(wrapper, true);
+            wrapper->last_activity = xTaskGetTickCount();
+            continue;
+        }
+
+        int completed = 1;
+        if (request.clean)
+        {
+            clean_spent_tiles(wrapper, true);
+        }
+        else if (request.power_off)
+        {
+            set_power(wrapper, false);
+        }
+        else
+        {
+            bool auto_requested;
+            completed = coalesce_requests(wrapper, &request, &held, &has_held, &auto_requested);
+
+            xSemaphoreTake(wrapper->fb_lock, portMAX_DELAY);
+            copy_fb_area(front_fb, wrapper->staging_fb, request.area);
+            xSemaphoreGive(wrapper->fb_lock);
+
+            // 自動選択と明示的なモードが混ざった場合は、内容から選んだモードと比べて厳しい方を使う
+            if (auto_requested && request.mode != EPD_WRAPPER_MODE_AUTO)
+            {
+                request.mode = stricter_mode(request.mode,
+                                             resolve_mode(wrapper, request.area, EPD_WRAPPER_MODE_AUTO));
+            }
+
+            enum EpdDrawMode mode;
+            if (request.full_screen)
+            {
+                mode = drive_screen(wrapper, request.mode);
+            }
+            else
+            {
+                mode = drive_area(wrapper, request.area, request.logical_area, request.mode);
+            }
+
+            if (wrapper->update_callback != NULL)
+            {
+                wrapper->update_callback(wrapper, request.area, mode, wrapper->update_callback_data);
+            }
+        }
+
+        xSemaphoreTake(wrapper->fb_lock, portMAX_DELAY);
+        wrapper->pending_updates -= completed;
+        EventBits_t bits = EPD_WRAPPER_EVENT_UPDATE_DONE;
+        if (wrapper->pending_updates == 0)
+        {
+            bits |= EPD_WRAPPER_EVENT_IDLE;
+        }
+        xEventGroupSetBits(wrapper->update_events, bits);
+        xSemaphoreGive(wrapper->fb_lock);
+    }
+
+    xEventGroupSetBits(wrapper->update_events, EPD_WRAPPER_EVENT_TASK_STOPPED);
+    vTaskDelete(NULL);
+}
+
+void epd_wrapper_update_screen(EPDWrapper *wrapper, enum EpdDrawMode mode)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not initialized");
+        return;
+    }
+
+    if (wrapper->is_async)
+    {
+        UpdateRequest request = {
+            .area = {.x = 0, .y = 0, .width = EPD_DISPLAY_WIDTH, .height = EPD_DISPLAY_HEIGHT},
+            .mode = mode,
+            .full_screen = true,
+        };
+        request.logical_area = rect_to_logical(wrapper->rotation, request.area);
+        submit_update(wrapper, &request);
+    }
+    else
+    {
+        drive_screen(wrapper, mode);
+    }
+
+    // 画面全体を反映したので記録済みの領域は不要
+    wrapper->dirty_count = 0;
+}
+
+void epd_wrapper_update_area(EPDWrapper *wrapper, EpdRect area, enum EpdDrawMode mode)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not initialized");
+        return;
+    }
+
+    if (!rect_clip_to_screen(&area))
+    {
+        return;
+    }
+
+    // epd_hl_update_area は回転後の座標で領域を受け取る
+    EpdRect logical_area = rect_to_logical(wrapper->rotation, area);
+
+    if (wrapper->is_async)
+    {
+        UpdateRequest request = {
+            .area = area,
+            .logical_area = logical_area,
+            .mode = mode,
+            .full_screen = false,
+        };
+        submit_update(wrapper, &request);
+    }
+    else
+    {
+        drive_area(wrapper, area, logical_area, mode);
+    }
+}
+
+int epd_wrapper_clean_ghosting(EPDWrapper *wrapper)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not initialized");
+        return 0;
+    }
+
+    // 非同期更新中は保留中の更新でコストが増えるため、対象はリフレッシュタスクで判定する
+    if (wrapper->is_async)
+    {
+        int spent = count_spent_tiles(wrapper);
+        UpdateRequest request = {.clean = true};
+        xSemaphoreTake(wrapper->fb_lock, portMAX_DELAY);
+        wrapper->pending_updates++;
+        xEventGroupClearBits(wrapper->update_events, EPD_WRAPPER_EVENT_IDLE);
+        xSemaphoreGive(wrapper->fb_lock);
+        xQueueSend(wrapper->update_queue, &request, portMAX_DELAY);
+        return spent;
+    }
+    return clean_spent_tiles(wrapper, false);
+}
+
+static void send_power_request(EPDWrapper *wrapper, bool power_on)
+{
+    if (power_on)
+    {
+        // 事前投入は保留数に数えず、キューが一杯なら更新が続くので省略する
+        UpdateRequest request = {.prewarm = true};
+        xQueueSend(wrapper->update_queue, &request, 0);
+        return;
+    }
+
+    UpdateRequest request = {.power_off = true};
+    xSemaphoreTake(wrapper->fb_lock, portMAX_DELAY);
+    wrapper->pending_updates++;
+    xEventGroupClearBits(wrapper->update_events, EPD_WRAPPER_EVENT_IDLE);
+    xSemaphoreGive(wrapper->fb_lock);
+    xQueueSend(wrapper->update_queue, &request, portMAX_DELAY);
+}
+
+void epd_wrapper_power_prewarm(EPDWrapper *wrapper)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not initialized");
+        return;
+    }
+
+    if (wrapper->is_async)
+    {
+        send_power_request(wrapper, true);
+        return;
+    }
+    set_power(wrapper, true);
+    wrapper->last_activity = xTaskGetTickCount();
+}
+
+float epd_wrapper_get_temperature(EPDWrapper *wrapper, uint32_t *age_ms)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not initialized");
+        return 0.0f;
+    }
+
+    TickType_t sampled_at;
+    float temperature = read_temperature(wrapper, &sampled_at);
+    if (age_ms != NULL)
+    {
+        *age_ms = (xTaskGetTickCount() - sampled_at) * portTICK_PERIOD_MS;
+    }
+    return temperature;
+}
+
+void epd_wrapper_get_power_stats(EPDWrapper *wrapper, EPDWrapperPowerStats *stats)
+{
+    if (wrapper == NULL || stats == NULL)
+    {
+        return;
+    }
+
+    *stats = wrapper->power_stats;
+    uint64_t elapsed_ms = (uint64_t)(xTaskGetTickCount() - wrapper->power_changed_at) * portTICK_PERIOD_MS;
+    if (wrapper->is_powered_on)
+    {
+        stats->on_ms += elapsed_ms;
+    }
+    else
+    {
+        stats->off_ms += elapsed_ms;
+    }
+}
+
+bool epd_wrapper_start_async(EPDWrapper *wrapper, int core_id)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not initialized");
+        return false;
+    }
+    if (wrapper->is_async)
+    {
+        ESP_LOGW(TAG, "Async update already running");
+        return true;
+    }
+
+    size_t framebuffer_size = EPD_DISPLAY_WIDTH * EPD_DISPLAY_HEIGHT / 2;
+    wrapper->compose_fb = heap_caps_malloc(framebuffer_size, MALLOC_CAP_SPIRAM);
+    wrapper->staging_fb = heap_caps_malloc(framebuffer_size, MALLOC_CAP_SPIRAM);
+    wrapper->fb_lock = xSemaphoreCreateMutex();
+    wrapper->update_queue = xQueueCreate(EPD_WRAPPER_UPDATE_QUEUE_LENGTH, sizeof(UpdateRequest));
+    wrapper->update_events = xEventGroupCreate();
+
+    if (wrapper->compose_fb == NULL || wrapper->staging_fb == NULL || wrapper->fb_lock == NULL ||
+        wrapper->update_queue == NULL || wrapper->update_events == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate async update resources");
+        goto fail;
+    }
+
+    // 現在の内容から描画を続けられるようにコピー
+    memcpy(wrapper->compose_fb, wrapper->framebuffer, framebuffer_size);
+    memcpy(wrapper->staging_fb, wrapper->framebuffer, framebuffer_size);
+    wrapper->pending_updates = 0;
+    xEventGroupSetBits(wrapper->update_events, EPD_WRAPPER_EVENT_IDLE);
+
+    if (xTaskCreatePinnedToCore(refresh_task, "epd_refresh", EPD_WRAPPER_REFRESH_TASK_STACK, wrapper,
+                                EPD_WRAPPER_REFRESH_TASK_PRIORITY, &wrapper->refresh_task, core_id) != pdPASS)
+    {
+        ESP_LOGE(TAG, "Failed to create refresh task");
+        goto fail;
+    }
+
+    wrapper->framebuffer = wrapper->compose_fb;
+    wrapper->is_async = true;
+    ESP_LOGI(TAG, "Async update started (refresh task on core %d)", core_id);
+    return true;
+
+fail:
+    heap_caps_free(wrapper->compose_fb);
+    heap_caps_free(wrapper->staging_fb);
+    if (wrapper->fb_lock != NULL)
+        vSemaphoreDelete(wrapper->fb_lock);
+    if (wrapper->update_queue != NULL)
+        vQueueDelete(wrapper->update_queue);
+    if (wrapper->update_events != NULL)
+        vEventGroupDelete(wrapper->update_events);
+    wrapper->compose_fb = NULL;
+    wrapper->staging_fb = NULL;
+    wrapper->fb_lock = NULL;
+    wrapper->update_queue = NULL;
+    wrapper->update_events = NULL;
+    wrapper->refresh_task = NULL;
+    return false;
+}
+
+void epd_wrapper_stop_async(EPDWrapper *wrapper)
+{
+    if (wrapper == NULL || !wrapper->is_async)
+    {
+        return;
+    }
+
+    // 保留中の更新を終わらせてからタスクを止める
+    epd_wrapper_wait_idle(wrapper, portMAX_DELAY);
+    UpdateRequest request = {.stop = true};
+    xQueueSend(wrapper->update_queue, &request, portMAX_DELAY);
+    xEventGroupWaitBits(wrapper->update_events, EPD_WRAPPER_EVENT_TASK_STOPPED, pdFALSE, pdTRUE, portMAX_DELAY);
+
+    // 描画済みで未反映の内容も引き継いで同期更新に戻す
+    uint8_t *front_fb = epd_hl_get_framebuffer(&wrapper->hl_state);
+    memcpy(front_fb, wrapper->compose_fb, EPD_DISPLAY_WIDTH * EPD_DISPLAY_HEIGHT / 2);
+    wrapper->framebuffer = front_fb;
+    wrapper->is_async = false;
+
+    heap_caps_free(wrapper->compose_fb);
+    heap_caps_free(wrapper->staging_fb);
+    vSemaphoreDelete(wrapper->fb_lock);
+    vQueueDelete(wrapper->update_queue);
+    vEventGroupDelete(wrapper->update_events);
+    wrapper->compose_fb = NULL;
+    wrapper->staging_fb = NULL;
+    wrapper->fb_lock = NULL;
+    wrapper->update_queue = NULL;
+    wrapper->update_events = NULL;
+    wrapper->refresh_task = NULL;
+
+    ESP_LOGI(TAG, "Async update stopped");
+}
+
+bool epd_wrapper_wait_idle(EPDWrapper *wrapper, TickType_t timeout)
+{
+    if (wrapper == NULL || !wrapper->is_async)
+    {
+        return true;
+    }
+
+    EventBits_t bits = xEventGroupWaitBits(wrapper->update_events, EPD_WRAPPER_EVENT_IDLE,
+                                           pdFALSE, pdTRUE, timeout);
+    return (bits & EPD_WRAPPER_EVENT_IDLE) != 0;
+}
+
+void epd_wrapper_set_update_callback(EPDWrapper *wrapper, EPDWrapperUpdateCallback callback, void *user_data)
+{
+    if (wrapper == NULL)
+    {
+        return;
+    }
+    wrapper->update_callback_data = user_data;
+    wrapper->update_callback = callback;
+}
+
+int epd_wrapper_update_dirty(EPDWrapper *wrapper, enum EpdDrawMode mode)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not initialized");
+        return 0;
+    }
+
+    int count = wrapper->dirty_count;
+    for (int i = 0; i < count; i++)
+    {
+        epd_wrapper_update_area(wrapper, wrapper->dirty_rects[i], mode);
+    }
+    wrapper->dirty_count = 0;
+
+    if (count > 0)
+    {
+        ESP_LOGI(TAG, "Updated %d dirty area(s) with mode %d", count, mode);
+    }
+    return count;
+}
+
+void epd_wrapper_mark_dirty(EPDWrapper *wrapper, int x, int y, int width, int height)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        return;
+    }
+
+    EpdRect rect = {
+        .x = x,
+        .y = y,
+        .width = width,
+        .height = height};
+    if (!rect_clip_to_screen(&rect))
+    {
+        return;
+    }
+
+    // 既存の矩形に含まれていれば何もしない（ピクセル単位の呼び出しを安価にするため新しい順に確認）
+    for (int i = wrapper->dirty_count - 1; i >= 0; i--)
+    {
+        if (rect_contains(wrapper->dirty_rects[i], rect))
+        {
+            return;
+        }
+    }
+
+    // 重なる・近接する矩形を吸収し、吸収で広がった結果さらに近接した矩形も続けて吸収する
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (int i = 0; i < wrapper->dirty_count; i++)
+        {
+            if (rect_near(wrapper->dirty_rects[i], rect, EPD_WRAPPER_DIRTY_MERGE_GAP))
+            {
+                rect = rect_union(rect, wrapper->dirty_rects[i]);
+                wrapper->dirty_rects[i] = wrapper->dirty_rects[--wrapper->dirty_count];
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    if (wrapper->dirty_count < EPD_WRAPPER_MAX_DIRTY_RECTS)
+    {
+        wrapper->dirty_rects[wrapper->dirty_count++] = rect;
+        return;
+    }
+
+    // 空きがない場合は、統合による面積の増加が最も小さい矩形と統合する
+    int best = 0;
+    long best_growth = -1;
+    for (int i = 0; i < wrapper->dirty_count; i++)
+    {
+        EpdRect u = rect_union(wrapper->dirty_rects[i], rect);
+        long growth = (long)u.width * u.height -
+                      (long)wrapper->dirty_rects[i].width * wrapper->dirty_rects[i].height;
+        if (best_growth < 0 || growth < best_growth)
+        {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    wrapper->dirty_rects[best] = rect_union(wrapper->dirty_rects[best], rect);
+}
+
+void epd_wrapper_clear_dirty(EPDWrapper *wrapper)
+{
+    if (wrapper == NULL)
+    {
+        return;
+    }
+    wrapper->dirty_count = 0;
+}
+
+bool epd_wrapper_push_clip(EPDWrapper *wrapper, int x, int y, int width, int height)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        return false;
+    }
+    if (wrapper->clip_depth >= EPD_WRAPPER_MAX_CLIP_DEPTH)
+    {
+        ESP_LOGE(TAG, "Clip stack overflow (max %d)", EPD_WRAPPER_MAX_CLIP_DEPTH);
+        return false;
+    }
+
+    EpdRect rect = {
+        .x = x,
+        .y = y,
+        .width = width,
+        .height = height};
+    wrapper->clip_stack[wrapper->clip_depth++] = wrapper->clip;
+    rect_intersect(wrapper->clip, rect, &wrapper->clip);
+    return true;
+}
+
+void epd_wrapper_pop_clip(EPDWrapper *wrapper)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        return;
+    }
+    if (wrapper->clip_depth <= 0)
+    {
+        ESP_LOGW(TAG, "Clip stack underflow");
+        return;
+    }
+    wrapper->clip = wrapper->clip_stack[--wrapper->clip_depth];
+}
+
+EpdRect epd_wrapper_get_clip(EPDWrapper *wrapper)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        return (EpdRect){0};
+    }
+    return wrapper->clip;
+}
+
+bool epd_wrapper_clip_rect(EPDWrapper *wrapper, EpdRect *rect)
+{
+    if (wrapper == NULL || !wrapper->is_initialized || rect == NULL)
+    {
+        return false;
+    }
+    return rect_intersect(*rect, wrapper->clip, rect);
+}
+
+EpdRect epd_wrapper_to_physical_rect(EPDWrapper *wrapper, EpdRect rect)
+{
+    if (wrapper == NULL || !wrapper->is_initialized)
+    {
+        return rect;
+    }
+    return rect_to_physical(wrapper->rotation, rect);
+}
+
+void epd_wrapper_draw_circle(EPDWrapper *wrapper, int x, int y, int radius, uint8_t color)
+{
+    if (wrapper == NULL || !wrapper->is_initialized || wrapper->framebuffer == NULL)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not properly initialized");
+        return;
+    }
+
+    EpdRect visible;
+    ClipResult clip = clip_logical_rect(wrapper, x - radius, y - radius, radius * 2 + 1, radius * 2 + 1, &visible);
+    if (clip == CLIP_OUTSIDE)
+    {
+        return;
+    }
+
+    if (clip == CLIP_INSIDE)
+    {
+        epd_draw_circle(x, y, radius, color, wrapper->framebuffer);
+    }
+    else
     {
-        ESP_LOGW(TAG, "EPD power is off, turning on for update");
-        epd_wrapper_power_on(wrapper);
+        draw_circle_clipped(wrapper, x, y, radius, color >> 4);
     }
-
-    float temperature = epd_ambient_temperature();
-    epd_hl_update_screen(&wrapper->hl_state, mode, temperature);
-    ESP_LOGI(TAG, "Screen updated with mode %d", mode);
+    epd_wrapper_mark_dirty(wrapper, visible.x, visible.y, visible.width, visible.height);
 }
 
-void epd_wrapper_draw_circle(EPDWrapper *wrapper, int x, int y, int radius, uint8_t color)
+void epd_wrapper_fill_circle(EPDWrapper *wrapper, int x, int y, int radius, uint8_t color)
 {
     if (wrapper == NULL || !wrapper->is_initialized || wrapper->framebuffer == NULL)
     {
@@ -226,18 +1710,22 @@ void epd_wrapper_draw_circle(EPDWrapper *wrapper, int x, int y, int radius, uint
         return;
     }
 
-    epd_draw_circle(x, y, radius, color, wrapper->framebuffer);
-}
-
-void epd_wrapper_fill_circle(EPDWrapper *wrapper, int x, int y, int radius, uint8_t color)
-{
-    if (wrapper == NULL || !wrapper->is_initialized || wrapper->framebuffer == NULL)
+    EpdRect visible;
+    ClipResult clip = clip_logical_rect(wrapper, x - radius, y - radius, radius * 2 + 1, radius * 2 + 1, &visible);
+    if (clip == CLIP_OUTSIDE)
     {
-        ESP_LOGE(TAG, "EPD wrapper not properly initialized");
         return;
     }
 
-    epd_fill_circle(x, y, radius, color, wrapper->framebuffer);
+    if (clip == CLIP_INSIDE)
+    {
+        epd_fill_circle(x, y, radius, color, wrapper->framebuffer);
+    }
+    else
+    {
+        fill_circle_clipped(wrapper, x, y, radius, color >> 4);
+    }
+    epd_wrapper_mark_dirty(wrapper, visible.x, visible.y, visible.width, visible.height);
 }
 
 void epd_wrapper_draw_line(EPDWrapper *wrapper, int x0, int y0, int x1, int y1, uint8_t color)
@@ -248,7 +1736,25 @@ void epd_wrapper_draw_line(EPDWrapper *wrapper, int x0, int y0, int x1, int y1,
         return;
     }
 
-    epd_draw_line(x0, y0, x1, y1, color, wrapper->framebuffer);
+    EpdRect visible;
+    ClipResult clip = clip_logical_rect(wrapper,
+                                        x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1,
+                                        (x0 < x1 ? x1 - x0 : x0 - x1) + 1, (y0 < y1 ? y1 - y0 : y0 - y1) + 1,
+                                        &visible);
+    if (clip == CLIP_OUTSIDE)
+    {
+        return;
+    }
+
+    if (clip == CLIP_INSIDE)
+    {
+        epd_draw_line(x0, y0, x1, y1, color, wrapper->framebuffer);
+    }
+    else
+    {
+        draw_line_clipped(wrapper, x0, y0, x1, y1, color >> 4);
+    }
+    epd_wrapper_mark_dirty(wrapper, visible.x, visible.y, visible.width, visible.height);
 }
 
 void epd_wrapper_draw_rect(EPDWrapper *wrapper, int x, int y, int width, int height, uint8_t color)
@@ -258,14 +1764,17 @@ void epd_wrapper_draw_rect(EPDWrapper *wrapper, int x, int y, int width, int hei
         ESP_LOGE(TAG, "EPD wrapper not properly initialized");
         return;
     }
+    if (width <= 0 || height <= 0)
+    {
+        return;
+    }
 
-    EpdRect rect = {
-        .x = x,
-        .y = y,
-        .width = width,
-        .height = height};
-
-    epd_draw_rect(rect, color, wrapper->framebuffer);
+    // epd_draw_rect() と同じく上下の辺、左右の辺をそれぞれ矩形の塗りつぶしで描画する
+    color >>= 4;
+    fill_logical_rect(wrapper, x, y, width, 1, color);
+    fill_logical_rect(wrapper, x, y + height - 1, width, 1, color);
+    fill_logical_rect(wrapper, x, y, 1, height, color);
+    fill_logical_rect(wrapper, x + width - 1, y, 1, height, color);
 }
 
 void epd_wrapper_fill_rect(EPDWrapper *wrapper, int x, int y, int width, int height, uint8_t color)
@@ -276,13 +1785,8 @@ void epd_wrapper_fill_rect(EPDWrapper *wrapper, int x, int y, int width, int hei
         return;
     }
 
-    EpdRect rect = {
-        .x = x,
-        .y = y,
-        .width = width,
-        .height = height};
-
-    epd_fill_rect(rect, color, wrapper->framebuffer);
+    // epdiyの描画関数と同じく色は上位4ビットを使用する
+    fill_logical_rect(wrapper, x, y, width, height, color >> 4);
 }
 
 void epd_wrapper_draw_image(EPDWrapper *wrapper, int x, int y, int width, int height, const uint8_t *image_data)
@@ -299,7 +1803,219 @@ void epd_wrapper_draw_image(EPDWrapper *wrapper, int x, int y, int width, int he
         .width = width,
         .height = height};
 
-    epd_copy_to_framebuffer(image_area, image_data, wrapper->framebuffer);
+    copy_image_clipped(wrapper, image_area, image_data);
+}
+
+/**
+ * @brief 1行分のフレームバッファ上の1ピクセル（ニブル）を書き換える
+ */
+static inline void put_nibble(uint8_t *row, int x, uint8_t value)
+{
+    if (x % 2 == 0)
+    {
+        row[x / 2] = (row[x / 2] & 0xF0) | value;
+    }
+    else
+    {
+        row[x / 2] = (row[x / 2] & 0x0F) | (value << 4);
+    }
+}
+
+/**
+ * @brief フレームバッファ座標系の1ピクセルをクリップ矩形の内側だけに描画する
+ * @param color 色（0-15のグレースケール）
+ * @return 描画した場合true
+ *
+ * ダーティ矩形は記録しないため、呼び出し側で描画範囲をまとめて記録してください。
+ */
+static inline bool put_pixel(EPDWrapper *wrapper, int x, int y, uint8_t color)
+{
+    // クリップ矩形（常に画面内）の外側は描画しない
+    const EpdRect *clip = &wrapper->clip;
+    if (x < clip->x || x >= clip->x + clip->width || y < clip->y || y >= clip->y + clip->height)
+    {
+        return false;
+    }
+    put_nibble(wrapper->framebuffer + y * (EPD_DISPLAY_WIDTH / 2), x, color & 0x0F);
+    return true;
+}
+
+/**
+ * @brief 4ビット/ピクセルのデータから1ピクセル（ニブル）を取り出す
+ */
+static inline uint8_t get_nibble(const uint8_t *data, int index)
+{
+    return (index % 2 == 0) ? (data[index / 2] & 0x0F) : (data[index / 2] >> 4);
+}
+
+/**
+ * @brief 4ビット/ピクセルのデータから指定位置から始まる8ピクセル分を32ビットで取り出す
+ *
+ * フレームバッファと同じく下位ニブルが先のピクセルになるリトルエンディアンの並びで返します。
+ * 奇数位置から始まる場合は1ニブル分ずらして組み立てます。
+ */
+static inline uint32_t load_nibble_word(const uint8_t *data, int index)
+{
+    uint32_t word;
+    const uint8_t *p = data + index / 2;
+    memcpy(&word, p, sizeof(word));
+    if (index % 2 != 0)
+    {
+        word = (word >> 4) | ((uint32_t)p[4] << 28);
+    }
+    return word;
+}
+
+/**
+ * @brief 32ビットに詰めた8ピクセルを指定位置から書き込む
+ *
+ * load_nibble_word() と同じ並びの値を受け取り、奇数位置から始まる場合は
+ * 前後のバイトの残りのニブルを保ったまま5バイトにまたがって書き込みます。
+ */
+static inline void store_nibble_word(uint8_t *data, int index, uint32_t word)
+{
+    uint8_t *p = data + index / 2;
+    if (index % 2 == 0)
+    {
+        memcpy(p, &word, sizeof(word));
+    }
+    else
+    {
+        p[0] = (p[0] & 0x0F) | (uint8_t)(word << 4);
+        p[1] = (uint8_t)(word >> 4);
+        p[2] = (uint8_t)(word >> 12);
+        p[3] = (uint8_t)(word >> 20);
+        p[4] = (p[4] & 0xF0) | (uint8_t)(word >> 28);
+    }
+}
+
+/**
+ * @brief 32ビットに詰めた8ピクセルの並びを左右反転する
+ */
+static inline uint32_t reverse_nibble_word(uint32_t word)
+{
+    word = ((word >> 4) & 0x0F0F0F0F) | ((word & 0x0F0F0F0F) << 4);
+    return __builtin_bswap32(word);
+}
+
+/**
+ * @brief 8x8ピクセルのタイルを転置する
+ * @param rows 8行分のピクセル（1行8ピクセルを32ビットに詰めたもの）
+ *
+ * 4x4、2x2、1x1のブロック単位で対角の要素を入れ替える手順で、
+ * rows[i]のj番目のピクセルとrows[j]のi番目のピクセルを交換します。
+ */
+static inline void transpose_nibble_tile(uint32_t rows[8])
+{
+    for (int i = 0; i < 4; i++)
+    {
+        uint32_t a = rows[i];
+        uint32_t b = rows[i + 4];
+        rows[i] = (a & 0x0000FFFF) | (b << 16);
+        rows[i + 4] = (a >> 16) | (b & 0xFFFF0000);
+    }
+    for (int block = 0; block < 8; block += 4)
+    {
+        for (int i = block; i < block + 2; i++)
+        {
+            uint32_t a = rows[i];
+            uint32_t b = rows[i + 2];
+            rows[i] = (a & 0x00FF00FF) | ((b << 8) & 0xFF00FF00);
+            rows[i + 2] = ((a >> 8) & 0x00FF00FF) | (b & 0xFF00FF00);
+        }
+    }
+    for (int i = 0; i < 8; i += 2)
+    {
+        uint32_t a = rows[i];
+        uint32_t b = rows[i + 1];
+        rows[i] = (a & 0x0F0F0F0F) | ((b << 4) & 0xF0F0F0F0);
+        rows[i + 1] = ((a >> 4) & 0x0F0F0F0F) | (b & 0xF0F0F0F0);
+    }
+}
+
+/**
+ * @brief 元画像の1ピクセルを回転後の位置へ書き込む（タイルに収まらない端の処理用）
+ */
+static inline void rotate_pixel(const uint8_t *src_data, int src_width_bytes, int src_width, int src_height,
+                                int rotation, uint8_t *dst_data, int dst_width_bytes, int x, int y)
+{
+    uint8_t value = get_nibble(src_data + y * src_width_bytes, x);
+    int new_x, new_y;
+    switch (rotation)
+    {
+    case 1: // 90度時計回り
+        new_x = src_height - 1 - y;
+        new_y = x;
+        break;
+    case 2: // 180度
+        new_x = src_width - 1 - x;
+        new_y = src_height - 1 - y;
+        break;
+    default: // 270度時計回り
+        new_x = y;
+        new_y = src_width - 1 - x;
+        break;
+    }
+    put_nibble(dst_data + new_y * dst_width_bytes, new_x, value);
+}
+
+/**
+ * @brief 1行を左右反転して書き込む（src_rowとdst_rowは別の領域であること）
+ */
+static void reverse_row(const uint8_t *src_row, uint8_t *dst_row, int width)
+{
+    int full_width = width & ~7;
+    for (int x = 0; x < full_width; x += 8)
+    {
+        uint32_t word;
+        memcpy(&word, src_row + x / 2, sizeof(word));
+        store_nibble_word(dst_row, width - 8 - x, reverse_nibble_word(word));
+    }
+    for (int x = full_width; x < width; x++)
+    {
+        put_nibble(dst_row, width - 1 - x, get_nibble(src_row, x));
+    }
+}
+
+/**
+ * @brief 180度回転を元のバッファ上で行う
+ *
+ * 上下対称の位置にある2行を、1行分の作業領域を使って反転しながら入れ替えます。
+ */
+static int rotate_image_180_in_place(uint8_t *data, int width, int height)
+{
+    int row_bytes = (width + 1) / 2;
+
+    // 画面幅までの作業領域はスタックに置き、それより大きい画像だけ内部RAMから確保する
+    uint8_t stack_row[EPD_DISPLAY_WIDTH / 2];
+    uint8_t *scratch = stack_row;
+    if (row_bytes > (int)sizeof(stack_row))
+    {
+        scratch = heap_caps_malloc(row_bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (scratch == NULL)
+        {
+            return -1;
+        }
+    }
+
+    for (int top = 0, bottom = height - 1; top <= bottom; top++, bottom--)
+    {
+        uint8_t *top_row = data + top * row_bytes;
+        uint8_t *bottom_row = data + bottom * row_bytes;
+
+        reverse_row(top_row, scratch, width);
+        if (top != bottom)
+        {
+            reverse_row(bottom_row, top_row, width);
+        }
+        memcpy(bottom_row, scratch, row_bytes);
+    }
+
+    if (scratch != stack_row)
+    {
+        heap_caps_free(scratch);
+    }
+    return 0;
 }
 
 /**
@@ -313,146 +2029,109 @@ void epd_wrapper_draw_image(EPDWrapper *wrapper, int x, int y, int width, int he
  *
  * 注意：dst_dataバッファは、回転後の画像サイズに合わせて事前に確保されている必要があります。
  * 90度・270度回転時は幅と高さが入れ替わることに注意してください。
+ *
+ * 90度・270度回転は8x8ピクセルのタイル単位でレジスタ上で転置し、
+ * 書き込み先の8行へ4バイトずつまとめて書き込みます。
+ * 0度・180度回転はsrc_dataとdst_dataに同じバッファを指定できます（元の画像を上書き）。
+ * 書き込み先はすべてのピクセルが上書きされるため、事前に初期化する必要はありません。
  */
 int rotate_image_data(const uint8_t *src_data, int src_width, int src_height, int rotation, uint8_t *dst_data)
 {
-    if (src_data == NULL || dst_data == NULL)
+    if (src_data == NULL || dst_data == NULL || src_width <= 0 || src_height <= 0)
     {
         return -1;
     }
 
     // 4ビット/ピクセルのフォーマットで1バイトが2ピクセル分
     int src_width_bytes = (src_width + 1) / 2; // 奇数幅の場合も考慮
-    int dst_width, dst_width_bytes;
-
-    // 回転後のサイズを計算
-    if (rotation == 1 || rotation == 3)
-    {
-        // 90度・270度回転は幅と高さが入れ替わる
-        dst_width = src_height;
-    }
-    else
-    {
-        // 0度・180度回転はサイズはそのまま
-        dst_width = src_width;
-    }
+    int dst_width = (rotation == 1 || rotation == 3) ? src_height : src_width;
+    int dst_width_bytes = (dst_width + 1) / 2;
 
-    dst_width_bytes = (dst_width + 1) / 2; // 奇数幅の場合も考慮
+    // 8x8のタイルに収まる範囲
+    int full_width = src_width & ~7;
+    int full_height = src_height & ~7;
 
-    // 回転処理
     switch (rotation)
     {
     case 0: // 0度（変更なし）
-        memcpy(dst_data, src_data, src_width_bytes * src_height);
-        break;
-
-    case 1: // 90度時計回り
-        for (int y = 0; y < src_height; y++)
+        if (dst_data != src_data)
         {
-            for (int x = 0; x < src_width; x++)
-            {
-                // 元の位置からピクセル値を取得
-                uint8_t src_value;
-                int src_index = y * src_width_bytes + x / 2;
-                if (x % 2 == 0)
-                {
-                    src_value = src_data[src_index] & 0x0F; // 下位4ビット
-                }
-                else
-                {
-                    src_value = (src_data[src_index] & 0xF0) >> 4; // 上位4ビット
-                }
-
-                // 回転後の位置を計算（時計回り90度）
-                int new_x = src_height - 1 - y;
-                int new_y = x;
-
-                // 新しい位置に設定
-                int dst_index = new_y * dst_width_bytes + new_x / 2;
-                if (new_x % 2 == 0)
-                {
-                    dst_data[dst_index] = (dst_data[dst_index] & 0xF0) | src_value;
-                }
-                else
-                {
-                    dst_data[dst_index] = (dst_data[dst_index] & 0x0F) | (src_value << 4);
-                }
-            }
+            memcpy(dst_data, src_data, src_width_bytes * src_height);
         }
-        break;
+        return 0;
 
     case 2: // 180度
+        if (dst_data == src_data)
+        {
+            return rotate_image_180_in_place(dst_data, src_width, src_height);
+        }
         for (int y = 0; y < src_height; y++)
         {
-            for (int x = 0; x < src_width; x++)
-            {
-                // 元の位置からピクセル値を取得
-                uint8_t src_value;
-                int src_index = y * src_width_bytes + x / 2;
-                if (x % 2 == 0)
-                {
-                    src_value = src_data[src_index] & 0x0F; // 下位4ビット
-                }
-                else
-                {
-                    src_value = (src_data[src_index] & 0xF0) >> 4; // 上位4ビット
-                }
-
-                // 回転後の位置を計算（180度）
-                int new_x = src_width - 1 - x;
-                int new_y = src_height - 1 - y;
-
-                // 新しい位置に設定
-                int dst_index = new_y * dst_width_bytes + new_x / 2;
-                if (new_x % 2 == 0)
-                {
-                    dst_data[dst_index] = (dst_data[dst_index] & 0xF0) | src_value;
-                }
-                else
-                {
-                    dst_data[dst_index] = (dst_data[dst_index] & 0x0F) | (src_value << 4);
-                }
-            }
+            reverse_row(src_data + y * src_width_bytes,
+                        dst_data + (src_height - 1 - y) * dst_width_bytes, src_width);
         }
-        break;
+        return 0;
 
+    case 1: // 90度時計回り
     case 3: // 270度時計回り
-        for (int y = 0; y < src_height; y++)
+        break;
+
+    default:
+        return -2; // 不正な回転値
+    }
+
+    // 90度・270度回転は元の画像を上書きできない
+    if (dst_data == src_data)
+    {
+        return -1;
+    }
+
+    // 書き込み先の行を連続して埋めるため、元画像の列方向（書き込み先の行方向）を外側のループにする
+    for (int tile_x = 0; tile_x < full_width; tile_x += 8)
+    {
+        for (int tile_y = 0; tile_y < full_height; tile_y += 8)
         {
-            for (int x = 0; x < src_width; x++)
+            uint32_t rows[8];
+            const uint8_t *src = src_data + tile_y * src_width_bytes + tile_x / 2;
+            for (int i = 0; i < 8; i++)
             {
-                // 元の位置からピクセル値を取得
-                uint8_t src_value;
-                int src_index = y * src_width_bytes + x / 2;
-                if (x % 2 == 0)
-                {
-                    src_value = src_data[src_index] & 0x0F; // 下位4ビット
-                }
-                else
-                {
-                    src_value = (src_data[src_index] & 0xF0) >> 4; // 上位4ビット
-                }
+                memcpy(&rows[i], src + i * src_width_bytes, sizeof(rows[i]));
+            }
 
-                // 回転後の位置を計算（反時計回り90度＝時計回り270度）
-                int new_x = y;
-                int new_y = src_width - 1 - x;
+            // rows[j]のi番目のピクセル = 元画像の (tile_x + j, tile_y + i)
+            transpose_nibble_tile(rows);
 
-                // 新しい位置に設定
-                int dst_index = new_y * dst_width_bytes + new_x / 2;
-                if (new_x % 2 == 0)
+            if (rotation == 1)
+            {
+                // (x, y) -> (src_height - 1 - y, x)：列の並びが逆になる
+                int dst_x = src_height - 8 - tile_y;
+                for (int j = 0; j < 8; j++)
                 {
-                    dst_data[dst_index] = (dst_data[dst_index] & 0xF0) | src_value;
+                    store_nibble_word(dst_data + (tile_x + j) * dst_width_bytes, dst_x,
+                                      reverse_nibble_word(rows[j]));
                 }
-                else
+            }
+            else
+            {
+                // (x, y) -> (y, src_width - 1 - x)：行の並びが逆になる
+                for (int j = 0; j < 8; j++)
                 {
-                    dst_data[dst_index] = (dst_data[dst_index] & 0x0F) | (src_value << 4);
+                    store_nibble_word(dst_data + (src_width - 1 - tile_x - j) * dst_width_bytes, tile_y,
+                                      rows[j]);
                 }
             }
         }
-        break;
+    }
 
-    default:
-        return -2; // 不正な回転値
+    // タイルに収まらない右端の列と下端の行は1ピクセルずつ処理する
+    for (int y = 0; y < src_height; y++)
+    {
+        int x_start = (y < full_height) ? full_width : 0;
+        for (int x = x_start; x < src_width; x++)
+        {
+            rotate_pixel(src_data, src_width_bytes, src_width, src_height, rotation,
+                         dst_data, dst_width_bytes, x, y);
+        }
     }
 
     return 0;
@@ -488,6 +2167,15 @@ void epd_wrapper_draw_rotated_image_with_transparency(EPDWrapper *wrapper,
     // 透明色を4ビット値（0-15）に制限
     transparent_color &= 0x0F;
 
+    // どの経路で描画しても回転後の座標で (x, y, width, height) の範囲に収まるため、
+    // クリップ矩形の外側にある画像は回転・コピーの前に読み飛ばす
+    EpdRect visible;
+    if (clip_logical_rect(wrapper, x, y, width, height, &visible) == CLIP_OUTSIDE)
+    {
+        return;
+    }
+    epd_wrapper_mark_dirty(wrapper, visible.x, visible.y, visible.width, visible.height);
+
     // 透明色を8ビット値に変換（epdiyの関数で使用するため）
     //uint8_t transparent_color_8bit = transparent_color << 4;
 
@@ -505,14 +2193,33 @@ void epd_wrapper_draw_rotated_image_with_transparency(EPDWrapper *wrapper,
                 .y = y,
                 .width = width,
                 .height = height};
-            epd_copy_to_framebuffer(image_area, image_data, wrapper->framebuffer);
+            copy_image_clipped(wrapper, image_area, image_data);
+            return;
+        }
+
+        // 見える範囲の行と列だけを処理する
+        EpdRect image_area = {
+            .x = x,
+            .y = y,
+            .width = width,
+            .height = height};
+        EpdRect src = visible_image_rect(wrapper, image_area, visible);
+
+        // 回転なしの場合は1行ずつ透明色を除いてコピー（画像データは行間の詰め物なしで連続）
+        if (rotation == 0)
+        {
+            for (int img_y = src.y; img_y < src.y + src.height; img_y++)
+            {
+                epd_wrapper_blit_span_transparent(wrapper, x + src.x, y + img_y, image_data,
+                                                  img_y * width + src.x, src.width, transparent_color);
+            }
             return;
         }
 
-        // 透明処理を使用する場合はピクセルごとに判断
-        for (int img_y = 0; img_y < height; img_y++)
+        // 座標のみ回転させる場合はピクセルごとに判断
+        for (int img_y = src.y; img_y < src.y + src.height; img_y++)
         {
-            for (int img_x = 0; img_x < width; img_x++)
+            for (int img_x = src.x; img_x < src.x + src.width; img_x++)
             {
                 // 画像のピクセル位置 - ピクセル単位で計算
                 int img_pos = img_y * width + img_x;
@@ -532,15 +2239,13 @@ void epd_wrapper_draw_rotated_image_with_transparency(EPDWrapper *wrapper,
                 }
 
                 // 透明色でない場合のみ描画
-                if (!use_transparency || img_pixel != transparent_color)
+                if (img_pixel != transparent_color)
                 {
                     int dx = x + img_x;
                     int dy = y + img_y;
 
-                    // EPDIYライブラリの描画関数を使用して回転を正しく処理
-                    // epdiyは8ビット値を期待するので、4ビット値を8ビット形式に変換
-                    uint8_t color_8bit = (img_pixel << 4) | img_pixel; // 4ビット値を8ビットに拡張
-                    epd_draw_pixel(dx, dy, color_8bit, wrapper->framebuffer);
+                    // 回転を考慮してクリップ矩形の内側だけに描画
+                    put_logical_pixel(wrapper, dx, dy, img_pixel);
                 }
             }
         }
@@ -576,9 +2281,6 @@ void epd_wrapper_draw_rotated_image_with_transparency(EPDWrapper *wrapper,
             return;
         }
 
-        // バッファを0で初期化（重要：回転処理でビット演算を行うため）
-        memset(rotated_data, 0, rotated_bytes);
-
         // 画像データを回転
         if (rotate_image_data(image_data, width, height, rotation, rotated_data) != 0)
         {
@@ -615,47 +2317,48 @@ void epd_wrapper_draw_rotated_image_with_transparency(EPDWrapper *wrapper,
             .width = rotated_width,
             .height = rotated_height};
 
-        epd_copy_to_framebuffer(image_area, rotated_data, wrapper->framebuffer);
+        copy_image_clipped(wrapper, image_area, rotated_data);
 
         // 一時バッファを解放
         heap_caps_free(rotated_data);
     }
     else
     {
-        // 透明処理を使用する場合はピクセルごとに判断
-        for (int img_y = 0; img_y < height; img_y++)
+        // 透明処理を使用する場合は、画像を回転させてから1行ずつ透明色を除いてコピー
+        int rotated_width = (rotation == 1 || rotation == 3) ? height : width;
+        int rotated_height = (rotation == 1 || rotation == 3) ? width : height;
+        int rotated_row_bytes = (rotated_width + 1) / 2;
+
+        uint8_t *rotated_data = heap_caps_malloc(rotated_row_bytes * rotated_height, MALLOC_CAP_8BIT);
+        if (rotated_data == NULL)
         {
-            for (int img_x = 0; img_x < width; img_x++)
-            {
-                // 画像のピクセル位置を計算
-                int img_row_offset = img_y * ((width + 1) / 2); // 4bit/pixelのバイト数で1行のオフセットを計算
-                int img_byte_pos = img_row_offset + (img_x / 2);
-                uint8_t img_pixel;
+            ESP_LOGE(TAG, "Failed to allocate memory for rotated image");
+            return;
+        }
 
-                // 4ビット/ピクセルのデータを取得
-                if (img_x % 2 == 0)
-                {
-                    // 偶数ピクセルは下位4ビット
-                    img_pixel = image_data[img_byte_pos] & 0x0F;
-                }
-                else
-                {
-                    // 奇数ピクセルは上位4ビット
-                    img_pixel = (image_data[img_byte_pos] & 0xF0) >> 4;
-                }
+        if (rotate_image_data(image_data, width, height, rotation, rotated_data) != 0)
+        {
+            ESP_LOGE(TAG, "Failed to rotate image data");
+            heap_caps_free(rotated_data);
+            return;
+        }
 
-                // 透明色でない場合のみ描画
-                if (img_pixel != transparent_color)
-                {
-                    int dx = x + img_x;
-                    int dy = y + img_y;
+        // 回転後の画像の配置位置（フレームバッファ座標系）
+        EpdRect logical_area = {
+            .x = x,
+            .y = y,
+            .width = width,
+            .height = height};
+        EpdRect physical_area = rect_to_physical(rotation, logical_area);
 
-                    // epd_draw_pixelは回転を考慮しなくても良い
-                    uint8_t color_8bit = img_pixel << 4 | img_pixel; // 4ビット値を8ビットに拡張
-                    epd_draw_pixel(dx, dy, color_8bit, wrapper->framebuffer);
-                }
-            }
+        for (int row = 0; row < rotated_height; row++)
+        {
+            epd_wrapper_blit_span_transparent(wrapper, physical_area.x, physical_area.y + row,
+                                              rotated_data + row * rotated_row_bytes, 0,
+                                              rotated_width, transparent_color);
         }
+
+        heap_caps_free(rotated_data);
     }
 }
 
@@ -712,6 +2415,7 @@ void epd_wrapper_draw_grayscale_test(EPDWrapper *wrapper, int x, int y, int widt
     }
 
     // グレースケールパターンを描画（16段階）
+    epd_wrapper_mark_dirty(wrapper, x, y, (width / 16) * 16, height);
     for (int i = 0; i < 16; i++)
     {
         int pattern_x = x + i * (width / 16);
@@ -719,22 +2423,7 @@ void epd_wrapper_draw_grayscale_test(EPDWrapper *wrapper, int x, int y, int widt
 
         for (int dy = 0; dy < height; dy++)
         {
-            for (int dx = 0; dx < pattern_width; dx++)
-            {
-                int pos = (y + dy) * EPD_DISPLAY_WIDTH + (pattern_x + dx);
-                int byte_pos = pos / 2;
-
-                if (pos % 2 == 0)
-                {
-                    // 偶数ピクセルは下位4ビット
-                    wrapper->framebuffer[byte_pos] = (wrapper->framebuffer[byte_pos] & 0xF0) | i;
-                }
-                else
-                {
-                    // 奇数ピクセルは上位4ビット
-                    wrapper->framebuffer[byte_pos] = (wrapper->framebuffer[byte_pos] & 0x0F) | (i << 4);
-                }
-            }
+            epd_wrapper_fill_span(wrapper, pattern_x, y + dy, pattern_width, i);
         }
     }
 }
@@ -858,16 +2547,495 @@ void epd_wrapper_draw_pixel(EPDWrapper *wrapper, int x, int y, uint8_t color) {
         return;
     }
 
-    // 正確なピクセル位置を計算
-    int pos = y * EPD_DISPLAY_WIDTH + x;
-    int byte_pos = pos / 2;
-    
-    // 4ビット/ピクセルのバッファでは、1バイトに2つのピクセルが格納される
-    if (pos % 2 == 0) {
-        // 偶数ピクセル（下位4ビット）
-        wrapper->framebuffer[byte_pos] = (wrapper->framebuffer[byte_pos] & 0xF0) | (color & 0x0F);
-    } else {
-        // 奇数ピクセル（上位4ビット）
-        wrapper->framebuffer[byte_pos] = (wrapper->framebuffer[byte_pos] & 0x0F) | ((color & 0x0F) << 4);
+    if (put_pixel(wrapper, x, y, color)) {
+        epd_wrapper_mark_dirty(wrapper, x, y, 1, 1);
+    }
+}
+
+void epd_wrapper_put_pixel(EPDWrapper *wrapper, int x, int y, uint8_t color)
+{
+    if (wrapper == NULL || !wrapper->is_initialized || wrapper->framebuffer == NULL)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not properly initialized");
+        return;
+    }
+
+    put_pixel(wrapper, x, y, color);
+}
+
+/**
+ * @brief 32ビットに詰めた8ピクセルのうち、透明色と異なるピクセルのニブルマスクを求める
+ */
+static inline uint32_t opaque_nibble_mask(uint32_t word, uint32_t transparent_word)
+{
+    uint32_t diff = word ^ transparent_word;
+    diff |= diff >> 1;
+    diff |= diff >> 2;
+    return (diff & 0x11111111) * 0x0F;
+}
+
+/**
+ * @brief 水平スパンをクリップ矩形（常に画面内）に切り詰める
+ * @return 描画すべきピクセルが残っていればtrue
+ */
+static bool clip_span(const EpdRect *clip, int *x, int y, int *length, int *src_x)
+{
+    if (y < clip->y || y >= clip->y + clip->height || *length <= 0)
+    {
+        return false;
+    }
+    if (*x < clip->x)
+    {
+        int skip = clip->x - *x;
+        *length -= skip;
+        if (src_x != NULL)
+        {
+            *src_x += skip;
+        }
+        *x = clip->x;
+    }
+    if (*x + *length > clip->x + clip->width)
+    {
+        *length = clip->x + clip->width - *x;
+    }
+    return *length > 0;
+}
+
+/**
+ * @brief 1行分のフレームバッファに同じ色のピクセルを連続して書き込む（範囲の確認なし）
+ */
+static void fill_row_span(uint8_t *row, int x, int length, uint8_t color)
+{
+    int end = x + length;
+
+    // 先頭の奇数ピクセル（上位ニブル）
+    if (x % 2 != 0)
+    {
+        put_nibble(row, x, color);
+        x++;
+    }
+
+    // 2ピクセル単位のバイト列を32ビット境界に揃えてから32ビットずつ書き込む
+    uint8_t *p = row + x / 2;
+    uint8_t *p_end = row + end / 2;
+    uint8_t fill_byte = color | (color << 4);
+    while (p < p_end && ((uintptr_t)p & 3) != 0)
+    {
+        *p++ = fill_byte;
+    }
+    uint32_t fill_word = fill_byte * 0x01010101u;
+    while (p + 4 <= p_end)
+    {
+        *(uint32_t *)p = fill_word;
+        p += 4;
+    }
+    while (p < p_end)
+    {
+        *p++ = fill_byte;
+    }
+
+    // 末尾の偶数ピクセル（下位ニブル）
+    if (end % 2 != 0 && end - 1 >= x)
+    {
+        put_nibble(row, end - 1, color);
+    }
+}
+
+void epd_wrapper_fill_span(EPDWrapper *wrapper, int x, int y, int length, uint8_t color)
+{
+    if (wrapper == NULL || !wrapper->is_initialized || wrapper->framebuffer == NULL)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not properly initialized");
+        return;
+    }
+    if (!clip_span(&wrapper->clip, &x, y, &length, NULL))
+    {
+        return;
+    }
+
+    epd_wrapper_mark_dirty(wrapper, x, y, length, 1);
+    fill_row_span(wrapper->framebuffer + y * (EPD_DISPLAY_WIDTH / 2), x, length, color & 0x0F);
+}
+
+/**
+ * @brief スパンコピーの共通処理
+ * @param transparent trueの場合、transparent_colorのピクセルは書き込まない
+ */
+static void blit_span_internal(EPDWrapper *wrapper, int x, int y,
+                               const uint8_t *src, int src_x, int length,
+                               bool transparent, uint8_t transparent_color)
+{
+    if (wrapper == NULL || !wrapper->is_initialized || wrapper->framebuffer == NULL || src == NULL)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not properly initialized or invalid image data");
+        return;
+    }
+    if (!clip_span(&wrapper->clip, &x, y, &length, &src_x))
+    {
+        return;
+    }
+
+    epd_wrapper_mark_dirty(wrapper, x, y, length, 1);
+
+    transparent_color &= 0x0F;
+    uint32_t transparent_word = transparent_color * 0x11111111u;
+    uint8_t *row = wrapper->framebuffer + y * (EPD_DISPLAY_WIDTH / 2);
+    int end = x + length;
+
+    // 先頭の奇数ピクセル（上位ニブル）
+    if (x % 2 != 0)
+    {
+        uint8_t value = get_nibble(src, src_x);
+        if (!transparent || value != transparent_color)
+        {
+            put_nibble(row, x, value);
+        }
+        x++;
+        src_x++;
+    }
+
+    // 32ビット境界までは1バイト（2ピクセル）ずつ
+    while (x + 2 <= end && ((uintptr_t)(row + x / 2) & 3) != 0)
+    {
+        uint8_t lo = get_nibble(src, src_x);
+        uint8_t hi = get_nibble(src, src_x + 1);
+        if (!transparent || lo != transparent_color)
+        {
+            put_nibble(row, x, lo);
+        }
+        if (!transparent || hi != transparent_color)
+        {
+            put_nibble(row, x + 1, hi);
+        }
+        x += 2;
+        src_x += 2;
+    }
+
+    // 8ピクセルずつ32ビット単位で書き込む
+    while (x + 8 <= end)
+    {
+        uint32_t word = load_nibble_word(src, src_x);
+        uint32_t *dst = (uint32_t *)(row + x / 2);
+        if (transparent)
+        {
+            uint32_t mask = opaque_nibble_mask(word, transparent_word);
+            *dst = (*dst & ~mask) | (word & mask);
+        }
+        else
+        {
+            *dst = word;
+        }
+        x += 8;
+        src_x += 8;
+    }
+
+    // 末尾の端数
+    while (x < end)
+    {
+        uint8_t value = get_nibble(src, src_x);
+        if (!transparent || value != transparent_color)
+        {
+            put_nibble(row, x, value);
+        }
+        x++;
+        src_x++;
+    }
+}
+
+void epd_wrapper_blit_span(EPDWrapper *wrapper, int x, int y,
+                           const uint8_t *src, int src_x, int length)
+{
+    blit_span_internal(wrapper, x, y, src, src_x, length, false, 0);
+}
+
+void epd_wrapper_blit_span_transparent(EPDWrapper *wrapper, int x, int y,
+                                       const uint8_t *src, int src_x, int length,
+                                       uint8_t transparent_color)
+{
+    blit_span_internal(wrapper, x, y, src, src_x, length, true, transparent_color);
+}
+
+/**
+ * @brief 回転後の論理座標の1ピクセルをクリップ矩形の内側だけに描画する
+ * @param color 色（0-15のグレースケール）
+ *
+ * ダーティ矩形は記録しないため、呼び出し側で描画範囲をまとめて記録してください。
+ */
+static void put_logical_pixel(EPDWrapper *wrapper, int x, int y, uint8_t color)
+{
+    // epdiyの描画関数と同じ座標変換
+    int px, py;
+    switch (wrapper->rotation)
+    {
+    case 1: // 90度回転
+        px = EPD_DISPLAY_WIDTH - y - 1;
+        py = x;
+        break;
+    case 2: // 180度回転
+        px = EPD_DISPLAY_WIDTH - x - 1;
+        py = EPD_DISPLAY_HEIGHT - y - 1;
+        break;
+    case 3: // 270度回転
+        px = y;
+        py = EPD_DISPLAY_HEIGHT - x - 1;
+        break;
+    default: // 0度回転
+        px = x;
+        py = y;
+        break;
+    }
+
+    put_pixel(wrapper, px, py, color);
+}
+
+/**
+ * @brief 回転後の論理座標の矩形をクリップ矩形の内側だけ塗りつぶす
+ * @param color 色（0-15のグレースケール）
+ */
+static void fill_logical_rect(EPDWrapper *wrapper, int x, int y, int width, int height, uint8_t color)
+{
+    EpdRect visible;
+    if (clip_logical_rect(wrapper, x, y, width, height, &visible) == CLIP_OUTSIDE)
+    {
+        return;
+    }
+
+    epd_wrapper_mark_dirty(wrapper, visible.x, visible.y, visible.width, visible.height);
+
+    uint8_t *row = wrapper->framebuffer + visible.y * (EPD_DISPLAY_WIDTH / 2);
+    for (int i = 0; i < visible.height; i++)
+    {
+        fill_row_span(row, visible.x, visible.width, color & 0x0F);
+        row += EPD_DISPLAY_WIDTH / 2;
+    }
+}
+
+/**
+ * @brief クリップ矩形の内側だけに直線を描画する（epd_draw_line() と同じ点を通る）
+ */
+static void draw_line_clipped(EPDWrapper *wrapper, int x0, int y0, int x1, int y1, uint8_t color)
+{
+    bool steep = (y1 > y0 ? y1 - y0 : y0 - y1) > (x1 > x0 ? x1 - x0 : x0 - x1);
+    int tmp;
+    if (steep)
+    {
+        tmp = x0, x0 = y0, y0 = tmp;
+        tmp = x1, x1 = y1, y1 = tmp;
+    }
+    if (x0 > x1)
+    {
+        tmp = x0, x0 = x1, x1 = tmp;
+        tmp = y0, y0 = y1, y1 = tmp;
+    }
+
+    int dx = x1 - x0;
+    int dy = y1 > y0 ? y1 - y0 : y0 - y1;
+    int err = dx / 2;
+    int ystep = y0 < y1 ? 1 : -1;
+
+    for (; x0 <= x1; x0++)
+    {
+        if (steep)
+        {
+            put_logical_pixel(wrapper, y0, x0, color);
+        }
+        else
+        {
+            put_logical_pixel(wrapper, x0, y0, color);
+        }
+        err -= dy;
+        if (err < 0)
+        {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+}
+
+/**
+ * @brief クリップ矩形の内側だけに円を描画する（epd_draw_circle() と同じ点を通る）
+ */
+static void draw_circle_clipped(EPDWrapper *wrapper, int x0, int y0, int r, uint8_t color)
+{
+    int f = 1 - r;
+    int ddF_x = 1;
+    int ddF_y = -2 * r;
+    int x = 0;
+    int y = r;
+
+    put_logical_pixel(wrapper, x0, y0 + r, color);
+    put_logical_pixel(wrapper, x0, y0 - r, color);
+    put_logical_pixel(wrapper, x0 + r, y0, color);
+    put_logical_pixel(wrapper, x0 - r, y0, color);
+
+    while (x < y)
+    {
+        if (f >= 0)
+        {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        put_logical_pixel(wrapper, x0 + x, y0 + y, color);
+        put_logical_pixel(wrapper, x0 - x, y0 + y, color);
+        put_logical_pixel(wrapper, x0 + x, y0 - y, color);
+        put_logical_pixel(wrapper, x0 - x, y0 - y, color);
+        put_logical_pixel(wrapper, x0 + y, y0 + x, color);
+        put_logical_pixel(wrapper, x0 - y, y0 + x, color);
+        put_logical_pixel(wrapper, x0 + y, y0 - x, color);
+        put_logical_pixel(wrapper, x0 - y, y0 - x, color);
+    }
+}
+
+/**
+ * @brief クリップ矩形の内側だけを塗りつぶした円を描画する（epd_fill_circle() と同じ範囲）
+ */
+static void fill_circle_clipped(EPDWrapper *wrapper, int x0, int y0, int r, uint8_t color)
+{
+    fill_logical_rect(wrapper, x0, y0 - r, 1, 2 * r + 1, color);
+
+    int f = 1 - r;
+    int ddF_x = 1;
+    int ddF_y = -2 * r;
+    int x = 0;
+    int y = r;
+    int px = x;
+    int py = y;
+
+    while (x < y)
+    {
+        if (f >= 0)
+        {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        // 中心から左右に縦線を引いて塗りつぶす
+        if (x < y + 1)
+        {
+            fill_logical_rect(wrapper, x0 + x, y0 - y, 1, 2 * y + 1, color);
+            fill_logical_rect(wrapper, x0 - x, y0 - y, 1, 2 * y + 1, color);
+        }
+        if (y != py)
+        {
+            fill_logical_rect(wrapper, x0 + py, y0 - px, 1, 2 * px + 1, color);
+            fill_logical_rect(wrapper, x0 - py, y0 - px, 1, 2 * px + 1, color);
+            py = y;
+        }
+        px = x;
+    }
+}
+
+/**
+ * @brief 4ビット/ピクセルの画像をクリップ矩形の内側だけにコピーする
+ * @param area 描画先（回転後の論理座標）
+ * @param image_data 画像データ（1行は (幅 + 1) / 2 バイト、epd_copy_to_framebuffer() と同じ並び）
+ *
+ * 回転なしの場合は見える行だけを行単位でコピーし、回転ありの場合は全体が見えるときだけ
+ * epd_copy_to_framebuffer() を使い、一部だけ見えるときは見える範囲の行と列だけをピクセル単位で書き込みます。
+ */
+static void copy_image_clipped(EPDWrapper *wrapper, EpdRect area, const uint8_t *image_data)
+{
+    EpdRect visible;
+    ClipResult clip = clip_logical_rect(wrapper, area.x, area.y, area.width, area.height, &visible);
+    if (clip == CLIP_OUTSIDE)
+    {
+        return;
+    }
+
+    epd_wrapper_mark_dirty(wrapper, visible.x, visible.y, visible.width, visible.height);
+    int row_bytes = (area.width + 1) / 2;
+
+    if (wrapper->rotation == 0)
+    {
+        // 論理座標とフレームバッファ座標が一致するため、見える行だけをスパンでコピー
+        for (int y = visible.y; y < visible.y + visible.height; y++)
+        {
+            blit_span_internal(wrapper, area.x, y, image_data + (y - area.y) * row_bytes, 0,
+                               area.width, false, 0);
+        }
+        return;
+    }
+
+    if (clip == CLIP_INSIDE)
+    {
+        epd_copy_to_framebuffer(area, image_data, wrapper->framebuffer);
+        return;
+    }
+
+    // 見える範囲の外側の行と列は読み飛ばす
+    EpdRect src = visible_image_rect(wrapper, area, visible);
+    for (int img_y = src.y; img_y < src.y + src.height; img_y++)
+    {
+        const uint8_t *row = image_data + img_y * row_bytes;
+        for (int img_x = src.x; img_x < src.x + src.width; img_x++)
+        {
+            put_logical_pixel(wrapper, area.x + img_x, area.y + img_y, get_nibble(row, img_x));
+        }
+    }
+}
+
+void epd_wrapper_draw_image_rows(EPDWrapper *wrapper, int x, int y, int width, int height,
+                                 const uint8_t *image_data, bool use_transparency,
+                                 uint8_t transparent_color)
+{
+    if (wrapper == NULL || !wrapper->is_initialized || wrapper->framebuffer == NULL || image_data == NULL)
+    {
+        ESP_LOGE(TAG, "EPD wrapper not properly initialized or invalid image data");
+        return;
+    }
+
+    if (!use_transparency)
+    {
+        EpdRect image_area = {
+            .x = x,
+            .y = y,
+            .width = width,
+            .height = height};
+        copy_image_clipped(wrapper, image_area, image_data);
+        return;
+    }
+
+    // クリップ矩形の外側にある帯は丸ごと読み飛ばす
+    EpdRect image_area = {
+        .x = x,
+        .y = y,
+        .width = width,
+        .height = height};
+    EpdRect visible;
+    if (clip_logical_rect(wrapper, x, y, width, height, &visible) == CLIP_OUTSIDE)
+    {
+        return;
+    }
+    epd_wrapper_mark_dirty(wrapper, visible.x, visible.y, visible.width, visible.height);
+
+    // 見える範囲の行と列だけを処理する
+    EpdRect src = visible_image_rect(wrapper, image_area, visible);
+    transparent_color &= 0x0F;
+    int row_bytes = (width + 1) / 2;
+    for (int img_y = src.y; img_y < src.y + src.height; img_y++)
+    {
+        const uint8_t *row = image_data + img_y * row_bytes;
+        if (wrapper->rotation == 0)
+        {
+            blit_span_internal(wrapper, x + src.x, y + img_y, row, src.x, src.width, true, transparent_color);
+            continue;
+        }
+        for (int img_x = src.x; img_x < src.x + src.width; img_x++)
+        {
+            uint8_t value = get_nibble(row, img_x);
+            if (value != transparent_color)
+            {
+                put_logical_pixel(wrapper, x + img_x, y + img_y, value);
+            }
+        }
     }
 }
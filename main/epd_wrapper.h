@@ -10,6 +10,12 @@
 #define EPD_WRAPPER_H
 
 #include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
 #include "epdiy.h"
 #include "epd_highlevel.h"
 
@@ -21,15 +27,204 @@
 #define EPD_DISPLAY_DEPTH 4 // 16 grayscale levels (4 bits)
 
 /**
- * @brief EPDラッパーの状態を保持する構造体
+ * @brief 変更領域（ダーティ矩形）トラッキングの設定
+ */
+#define EPD_WRAPPER_MAX_DIRTY_RECTS 8 // 保持するダーティ矩形の最大数
+#define EPD_WRAPPER_DIRTY_MERGE_GAP 16 // この距離(px)以内の矩形は1つに統合する
+
+/**
+ * @brief クリップ矩形スタックの設定
+ */
+#define EPD_WRAPPER_MAX_CLIP_DEPTH 8 // 入れ子にできるクリップ矩形の最大数
+
+/**
+ * @brief 残像（ゴースト）管理の設定
+ *
+ * 画面をタイルに分け、タイルごとに高速・部分更新の回数をコストとして数えます。
+ * コストが上限に達したタイルは、リフレッシュタスクが一定時間暇になったとき
+ * （または epd_wrapper_clean_ghosting() の呼び出し時）にGC16で反転・復元して消去します。
+ */
+#ifndef EPD_WRAPPER_GHOST_TILE_SIZE
+#define EPD_WRAPPER_GHOST_TILE_SIZE 60 // タイルの一辺(px)。960と540の公約数にする
+#endif
+#ifndef EPD_WRAPPER_GHOST_BUDGET
+#define EPD_WRAPPER_GHOST_BUDGET 16 // 消去するまでに許容するタイルごとのコスト
+#endif
+#ifndef EPD_WRAPPER_GHOST_COST_FAST
+#define EPD_WRAPPER_GHOST_COST_FAST 2 // DU・A2など高速モード1回のコスト
+#endif
+#ifndef EPD_WRAPPER_GHOST_COST_GRAY
+#define EPD_WRAPPER_GHOST_COST_GRAY 1 // GC16・GL16など階調モード1回のコスト
+#endif
+#ifndef EPD_WRAPPER_GHOST_IDLE_MS
+#define EPD_WRAPPER_GHOST_IDLE_MS 2000 // この時間更新がなければ消去を始める
+#endif
+#define EPD_WRAPPER_GHOST_TILES_X (EPD_DISPLAY_WIDTH / EPD_WRAPPER_GHOST_TILE_SIZE)
+#define EPD_WRAPPER_GHOST_TILES_Y (EPD_DISPLAY_HEIGHT / EPD_WRAPPER_GHOST_TILE_SIZE)
+
+/**
+ * @brief パネル電源の管理
+ *
+ * 更新時に電源が切れていれば自動的に入れ、昇圧電源とVCOMが安定するまで
+ * EPD_WRAPPER_POWER_SETTLE_MS 待ってから駆動します。入力があった時点で
+ * epd_wrapper_power_prewarm() を呼ぶと、描画と並行して電源を入れて待ち時間を隠せます。
+ *
+ * 自動で電源を切るのは非同期更新中だけです。最後の駆動から EPD_WRAPPER_POWER_IDLE_MS の間
+ * 更新がなければリフレッシュタスクが電源を切ります。同期更新では epd_wrapper_power_off() で
+ * 明示的に切ってください。
+ */
+#ifndef EPD_WRAPPER_POWER_IDLE_MS
+#define EPD_WRAPPER_POWER_IDLE_MS 3000 // 0にすると自動で電源を切らない
+#endif
+#ifndef EPD_WRAPPER_POWER_SETTLE_MS
+#define EPD_WRAPPER_POWER_SETTLE_MS 100 // 電源を入れてから駆動できるまでの時間
+#endif
+
+/**
+ * @brief 波形選択に使う温度の取得
+ *
+ * 更新のたびにセンサーを読まず、キャッシュした値を使います。初期化時に一度読み、
+ * その後は EPD_WRAPPER_TEMPERATURE_PERIOD_MS ごとに esp_timer のタスクで読み直すので、
+ * 同期・非同期のどちらの更新でも駆動の直前にセンサーを待つことはありません。
+ * 読んだ値がキャッシュから EPD_WRAPPER_TEMPERATURE_HYSTERESIS 以上離れた場合だけ値を更新します。
+ */
+#ifndef EPD_WRAPPER_TEMPERATURE_PERIOD_MS
+#define EPD_WRAPPER_TEMPERATURE_PERIOD_MS 30000 // センサーを読み直す間隔
+#endif
+#ifndef EPD_WRAPPER_TEMPERATURE_HYSTERESIS
+#define EPD_WRAPPER_TEMPERATURE_HYSTERESIS 1.0f // 値を更新する最小の変化(℃)
+#endif
+
+/**
+ * @brief パネル電源の状態ごとの累計時間
  */
 typedef struct
+{
+    uint64_t on_ms;          // 電源ONの累計時間(ms)
+    uint64_t off_ms;         // 電源OFFの累計時間(ms)
+    uint32_t power_on_count; // 電源を入れた回数
+} EPDWrapperPowerStats;
+
+/**
+ * @brief 非同期更新（リフレッシュタスク）の設定
+ */
+#define EPD_WRAPPER_UPDATE_QUEUE_LENGTH 8     // 保留できる更新要求の数
+#define EPD_WRAPPER_REFRESH_TASK_STACK 4096   // リフレッシュタスクのスタックサイズ
+#define EPD_WRAPPER_REFRESH_TASK_PRIORITY 6   // リフレッシュタスクの優先度
+
+/**
+ * @brief 更新要求をまとめる時間(ms)
+ *
+ * リフレッシュタスクは要求を受け取ってからこの時間内に届いた要求と、
+ * 駆動中にキューに溜まった要求を1回の駆動にまとめます（領域は和、モードは最も厳しいもの）。
+ * 0にすると待たずに、その時点でキューにある要求だけをまとめます。
+ */
+#ifndef EPD_WRAPPER_COALESCE_MS
+#define EPD_WRAPPER_COALESCE_MS 20
+#endif
+
+/**
+ * @brief 非同期更新のイベントビット（update_events）
+ */
+#define EPD_WRAPPER_EVENT_IDLE (1 << 0)        // 保留中・実行中の更新がない
+#define EPD_WRAPPER_EVENT_UPDATE_DONE (1 << 1) // 更新が1つ完了した（待つ側でクリアする）
+#define EPD_WRAPPER_EVENT_TASK_STOPPED (1 << 2) // リフレッシュタスクが終了した
+
+/**
+ * @brief 更新モードの自動選択
+ *
+ * 更新関数のmodeに EPD_WRAPPER_MODE_AUTO を渡すと、表示中の内容と新しい内容の差分から
+ * 正しく表示できる最も速いモードを選びます。変化したピクセルの新旧の階調で次のように決めます。
+ *   - 変化なし                      : パネルを駆動しない
+ *   - 新旧とも黒・白のみ            : EPD_WRAPPER_AUTO_MODE_MONO（A2を持つ波形ならA2にできる）
+ *   - 新しい内容が黒・白のみ        : EPD_WRAPPER_AUTO_MODE_TO_MONO
+ *   - 白の上に中間調を描いた        : EPD_WRAPPER_AUTO_MODE_GRAY_ON_WHITE
+ *   - それ以外（中間調から中間調など）: EPD_WRAPPER_AUTO_MODE_GRAY
+ */
+#define EPD_WRAPPER_MODE_AUTO ((enum EpdDrawMode)0x3E)
+
+#ifndef EPD_WRAPPER_AUTO_MODE_MONO
+#define EPD_WRAPPER_AUTO_MODE_MONO MODE_DU
+#endif
+#ifndef EPD_WRAPPER_AUTO_MODE_TO_MONO
+#define EPD_WRAPPER_AUTO_MODE_TO_MONO MODE_DU
+#endif
+#ifndef EPD_WRAPPER_AUTO_MODE_GRAY_ON_WHITE
+#define EPD_WRAPPER_AUTO_MODE_GRAY_ON_WHITE MODE_GL16
+#endif
+#ifndef EPD_WRAPPER_AUTO_MODE_GRAY
+#define EPD_WRAPPER_AUTO_MODE_GRAY MODE_GC16
+#endif
+
+/**
+ * @brief 表示中の内容と新しい内容の差分のヒストグラム
+ */
+typedef struct
+{
+    uint32_t changed;        // 変化したピクセル数
+    uint32_t old_levels[16]; // 変化したピクセルの表示中の階調の分布
+    uint32_t new_levels[16]; // 変化したピクセルの新しい階調の分布
+} EPDWrapperDiffHistogram;
+
+struct EPDWrapper;
+
+/**
+ * @brief 非同期更新の完了時に呼ばれるコールバック
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param area 更新した領域（フレームバッファ座標系、回転なし）
+ * @param mode 更新モード（自動選択の場合は選ばれたモード。変化がなく駆動しなかった場合は EPD_WRAPPER_MODE_AUTO）
+ * @param user_data 登録時に渡したポインタ
+ *
+ * リフレッシュタスクのコンテキストで呼ばれます。時間のかかる処理は避けてください。
+ */
+typedef void (*EPDWrapperUpdateCallback)(struct EPDWrapper *wrapper, EpdRect area,
+                                         enum EpdDrawMode mode, void *user_data);
+
+/**
+ * @brief EPDラッパーの状態を保持する構造体
+ */
+typedef struct EPDWrapper
 {
     EpdiyHighlevelState hl_state; // epdiyのハイレベル状態
     uint8_t *framebuffer;         // フレームバッファへのポインタ
     bool is_initialized;          // 初期化済みかどうか
     bool is_powered_on;           // 電源がONかどうか
     int rotation;                 // 画面の回転（0:0度, 1:90度, 2:180度, 3:270度）
+
+    // ダーティ矩形（フレームバッファ座標系、回転なし）
+    EpdRect dirty_rects[EPD_WRAPPER_MAX_DIRTY_RECTS]; // 前回の更新以降に描画された領域
+    int dirty_count;                                  // 有効なダーティ矩形の数
+
+    // クリップ矩形（フレームバッファ座標系、回転なし）
+    EpdRect clip;                                  // 現在のクリップ矩形（スタック全体と画面の共通部分）
+    EpdRect clip_stack[EPD_WRAPPER_MAX_CLIP_DEPTH]; // push前のクリップ矩形
+    int clip_depth;                                // スタックに積まれている数
+
+    // 残像管理（タイルごとの高速・部分更新のコスト。フレームバッファ座標系）
+    uint8_t ghost_cost[EPD_WRAPPER_GHOST_TILES_Y][EPD_WRAPPER_GHOST_TILES_X];
+
+    // 電源管理
+    TickType_t power_changed_at;      // 電源の状態が最後に変わった時刻（ONの場合は電源を入れた時刻）
+    TickType_t last_activity;         // 最後にパネルを駆動した（または電源を事前投入した）時刻
+    EPDWrapperPowerStats power_stats; // 前回の状態変化までの累計
+
+    // 温度のキャッシュ（温度と時刻は temperature_lock を取得して一緒に読み書きする）
+    float temperature;                    // 波形選択に使う温度(℃)
+    TickType_t temperature_sampled_at;    // 最後にセンサーを読んだ時刻
+    SemaphoreHandle_t temperature_lock;   // 温度と時刻を保護する
+    esp_timer_handle_t temperature_timer; // 定期的にセンサーを読むタイマー
+
+    // 非同期更新（有効時は framebuffer が描画用バッファを指す）
+    bool is_async;                          // 非同期更新が有効かどうか
+    uint8_t *compose_fb;                    // 描画用バッファ（PSRAM）
+    uint8_t *staging_fb;                    // 更新要求時点の内容を保持するバッファ（PSRAM）
+    SemaphoreHandle_t fb_lock;              // staging_fb と保留数を保護する
+    QueueHandle_t update_queue;             // 更新要求のキュー
+    EventGroupHandle_t update_events;       // 完了通知用のイベントグループ
+    TaskHandle_t refresh_task;              // リフレッシュタスク
+    volatile int pending_updates;           // 保留中・実行中の更新要求の数
+    EPDWrapperUpdateCallback update_callback; // 更新完了時のコールバック
+    void *update_callback_data;             // コールバックに渡すポインタ
 } EPDWrapper;
 
 /**
@@ -50,15 +245,46 @@ void epd_wrapper_deinit(EPDWrapper *wrapper);
 /**
  * @brief 電源をONにする
  * @param wrapper EPDラッパー構造体へのポインタ
+ *
+ * 更新関数は必要に応じて電源を入れるため、通常は呼ぶ必要はありません。
+ * 非同期更新中は epd_wrapper_power_prewarm() と同じです。
  */
 void epd_wrapper_power_on(EPDWrapper *wrapper);
 
 /**
  * @brief 電源をOFFにする
  * @param wrapper EPDラッパー構造体へのポインタ
+ *
+ * 非同期更新中は、保留中の更新が終わった後にリフレッシュタスクが電源を切ります。
  */
 void epd_wrapper_power_off(EPDWrapper *wrapper);
 
+/**
+ * @brief 更新が近いことを知らせ、電源を先に入れておく
+ * @param wrapper EPDラッパー構造体へのポインタ
+ *
+ * タッチなどの入力を受け取った時点で呼ぶと、描画している間に電源が立ち上がり、
+ * 自動で電源を切るまでの時間も延長されます。非同期更新中はすぐに戻ります。
+ */
+void epd_wrapper_power_prewarm(EPDWrapper *wrapper);
+
+/**
+ * @brief 波形選択に使う温度を取得する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param age_ms 最後にセンサーを読んでからの経過時間(ms)の格納先（NULL可）
+ * @return キャッシュしている温度(℃)
+ *
+ * センサーは読まず、キャッシュした値を返します。
+ */
+float epd_wrapper_get_temperature(EPDWrapper *wrapper, uint32_t *age_ms);
+
+/**
+ * @brief 電源の状態ごとの累計時間を取得する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param stats 格納先（現在の状態の経過時間を含む）
+ */
+void epd_wrapper_get_power_stats(EPDWrapper *wrapper, EPDWrapperPowerStats *stats);
+
 /**
  * @brief ディスプレイを指定した色で塗りつぶす
  * @param wrapper EPDラッパー構造体へのポインタ
@@ -76,10 +302,164 @@ void epd_wrapper_clear_cycles(EPDWrapper *wrapper, int cycles);
 /**
  * @brief フレームバッファの内容をディスプレイに反映する
  * @param wrapper EPDラッパー構造体へのポインタ
- * @param mode 更新モード（例：MODE_GC16）
+ * @param mode 更新モード（例：MODE_GC16、EPD_WRAPPER_MODE_AUTO）
  */
 void epd_wrapper_update_screen(EPDWrapper *wrapper, enum EpdDrawMode mode);
 
+/**
+ * @brief フレームバッファの指定領域だけをディスプレイに反映する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param area 更新する領域（フレームバッファ座標系、回転なし）
+ * @param mode 更新モード（例：MODE_DU、EPD_WRAPPER_MODE_AUTO）
+ */
+void epd_wrapper_update_area(EPDWrapper *wrapper, EpdRect area, enum EpdDrawMode mode);
+
+/**
+ * @brief 前回の更新以降に描画された領域だけをディスプレイに反映する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param mode 更新モード（例：MODE_DU、EPD_WRAPPER_MODE_AUTO）
+ * @return 更新した矩形の数（変更がなければ0）
+ *
+ * 描画関数が記録したダーティ矩形を統合済みの状態で1つずつ
+ * epd_hl_update_area() で部分更新し、記録をクリアします。
+ */
+int epd_wrapper_update_dirty(EPDWrapper *wrapper, enum EpdDrawMode mode);
+
+/**
+ * @brief 描画した内容と表示中の内容の差分のヒストグラムを求める
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param area 対象の領域（フレームバッファ座標系、回転なし）
+ * @param hist 結果の格納先
+ *
+ * 非同期更新中は、保留中の更新がまだ表示に反映されていない可能性があります。
+ */
+void epd_wrapper_diff_histogram(EPDWrapper *wrapper, EpdRect area, EPDWrapperDiffHistogram *hist);
+
+/**
+ * @brief 差分のヒストグラムから更新モードを選ぶ
+ * @param hist epd_wrapper_diff_histogram() の結果
+ * @return EPD_WRAPPER_MODE_AUTO で使われるモード（変化がない場合は EPD_WRAPPER_AUTO_MODE_MONO）
+ */
+enum EpdDrawMode epd_wrapper_select_mode(const EPDWrapperDiffHistogram *hist);
+
+/**
+ * @brief 領域をダーティとして記録する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param x 左上X座標（フレームバッファ座標系、回転なし）
+ * @param y 左上Y座標（フレームバッファ座標系、回転なし）
+ * @param width 幅
+ * @param height 高さ
+ *
+ * フレームバッファを直接書き換えた場合に呼び出してください。
+ * ラッパーの描画関数は自動的に記録します。
+ */
+void epd_wrapper_mark_dirty(EPDWrapper *wrapper, int x, int y, int width, int height);
+
+/**
+ * @brief 記録済みのダーティ矩形を破棄する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ */
+void epd_wrapper_clear_dirty(EPDWrapper *wrapper);
+
+/**
+ * @brief クリップ矩形を積む
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param x 左上X座標（フレームバッファ座標系、回転なし）
+ * @param y 左上Y座標（フレームバッファ座標系、回転なし）
+ * @param width 幅
+ * @param height 高さ
+ * @return 積めた場合はtrue（スタックが一杯の場合はfalse）
+ *
+ * 現在のクリップ矩形との共通部分が新しいクリップ矩形になります。
+ * 以降の描画関数（図形・画像・スパン・文字）はクリップ矩形の外側に描画せず、
+ * 完全に外側にある図形・画像の行・文字はピクセル単位の処理の前に読み飛ばします。
+ * 共通部分が空の場合は、対応するpopまで何も描画されません。
+ */
+bool epd_wrapper_push_clip(EPDWrapper *wrapper, int x, int y, int width, int height);
+
+/**
+ * @brief 最後に積んだクリップ矩形を取り除き、その前のクリップ矩形に戻す
+ * @param wrapper EPDラッパー構造体へのポインタ
+ */
+void epd_wrapper_pop_clip(EPDWrapper *wrapper);
+
+/**
+ * @brief 現在のクリップ矩形を返す
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @return クリップ矩形（フレームバッファ座標系、回転なし）
+ */
+EpdRect epd_wrapper_get_clip(EPDWrapper *wrapper);
+
+/**
+ * @brief 矩形を現在のクリップ矩形に切り詰める
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param rect 切り詰める矩形（フレームバッファ座標系、回転なし）
+ * @return 見える部分が残っていればtrue（falseの場合は描画を省略できる）
+ */
+bool epd_wrapper_clip_rect(EPDWrapper *wrapper, EpdRect *rect);
+
+/**
+ * @brief 回転後の論理座標の矩形をフレームバッファ座標系の矩形に変換する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param rect 変換する矩形（回転後の論理座標）
+ * @return 現在の回転で変換した矩形（フレームバッファ座標系、回転なし）
+ *
+ * 論理座標で計算した領域をクリップ矩形やダーティ矩形として使う場合に使います。
+ */
+EpdRect epd_wrapper_to_physical_rect(EPDWrapper *wrapper, EpdRect rect);
+
+/**
+ * @brief 残像のコストが上限に達したタイルを消去する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @return 消去したタイルの数（非同期更新中は呼び出し時点で上限に達しているタイルの数）
+ *
+ * 対象のタイルを隣接するもの同士で矩形にまとめ、表示内容を反転・復元する
+ * 2回のGC16更新で全ピクセルを駆動し直します。非同期更新中はリフレッシュタスクに
+ * 消去を依頼してすぐに戻り、保留中の更新を反映した後に対象を判定します
+ * （一定時間更新がないときには自動的にも行われます）。
+ */
+int epd_wrapper_clean_ghosting(EPDWrapper *wrapper);
+
+/**
+ * @brief 非同期更新を開始する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param core_id リフレッシュタスクを固定するコア番号
+ * @return 開始に成功したかどうか
+ *
+ * 以降、描画関数はPSRAM上の描画用バッファに書き込み、
+ * epd_wrapper_update_screen() / epd_wrapper_update_area() / epd_wrapper_update_dirty() は
+ * 領域を確定してキューに積むだけで、すぐに戻ります。
+ * 更新要求の時点でその領域の内容をコピーするため、パネルの駆動中も次の画面を描画できます。
+ * 同じ領域の要求が駆動前に重なった場合は新しい内容が表示されます。
+ * 短い間隔で続いた要求は EPD_WRAPPER_COALESCE_MS に従って1回の駆動にまとめられ、
+ * 完了コールバックもまとめた領域について1回だけ呼ばれます。
+ */
+bool epd_wrapper_start_async(EPDWrapper *wrapper, int core_id);
+
+/**
+ * @brief 非同期更新を終了し、同期更新に戻す
+ * @param wrapper EPDラッパー構造体へのポインタ
+ *
+ * 保留中の更新がすべて終わるまで待ちます。
+ */
+void epd_wrapper_stop_async(EPDWrapper *wrapper);
+
+/**
+ * @brief 保留中の更新がすべて完了するまで待つ
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param timeout 最大待ち時間（tick）
+ * @return 完了した場合はtrue（同期更新時は常にtrue）
+ */
+bool epd_wrapper_wait_idle(EPDWrapper *wrapper, TickType_t timeout);
+
+/**
+ * @brief 非同期更新の完了コールバックを登録する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param callback コールバック（NULLで解除）
+ * @param user_data コールバックに渡すポインタ
+ */
+void epd_wrapper_set_update_callback(EPDWrapper *wrapper, EPDWrapperUpdateCallback callback, void *user_data);
+
 /**
  * @brief 円を描画する
  * @param wrapper EPDラッパー構造体へのポインタ
@@ -179,6 +559,24 @@ void epd_wrapper_draw_transparent_image(EPDWrapper *wrapper, int x, int y,
  */
 void epd_wrapper_draw_image(EPDWrapper *wrapper, int x, int y, int width, int height, const uint8_t *image_data);
 
+/**
+ * @brief 画像の連続する数行を描画する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param x 左上X座標（回転後の論理座標）
+ * @param y 先頭行のY座標（回転後の論理座標）
+ * @param width 画像の幅
+ * @param height 描画する行数
+ * @param image_data 画像データ（1行は (幅 + 1) / 2 バイト）
+ * @param use_transparency 透明処理を有効にするかどうか
+ * @param transparent_color 透明とする色（0-15の値）
+ *
+ * ファイルなどから画像を数行ずつ展開しながら描画する場合に使います。
+ * epd_wrapper_draw_image() と同様に画像は表示の回転に合わせて回転し、一時バッファは使いません。
+ */
+void epd_wrapper_draw_image_rows(EPDWrapper *wrapper, int x, int y, int width, int height,
+                                 const uint8_t *image_data, bool use_transparency,
+                                 uint8_t transparent_color);
+
 /**
  * @brief 画像データを回転させて描画する関数
  * @param wrapper EPDラッパー構造体へのポインタ
@@ -199,6 +597,8 @@ void epd_wrapper_draw_rotated_image(EPDWrapper *wrapper, int x, int y, int width
  * @param rotation 回転角度（0:0度, 1:90度, 2:180度, 3:270度）
  * @param dst_data 回転後の画像データを格納するバッファ（事前に確保必要）
  * @return 成功時は0、失敗時は負の値
+ *
+ * 0度・180度回転ではsrc_dataとdst_dataに同じバッファを指定できます。
  */
 int rotate_image_data(const uint8_t *src_data, int src_width, int src_height, int rotation, uint8_t *dst_data);
 
@@ -251,10 +651,64 @@ int epd_wrapper_get_height(EPDWrapper *wrapper);
 /**
  * @brief 1ピクセルを描画する
  * @param wrapper EPDラッパー構造体へのポインタ
- * @param x X座標
- * @param y Y座標
+ * @param x X座標（フレームバッファ座標系、回転なし）
+ * @param y Y座標（フレームバッファ座標系、回転なし）
  * @param color 色（0-15のグレースケール）
+ *
+ * クリップ矩形の外側の座標は無視されます。
+ * 呼び出しごとにダーティ矩形を記録するため、多数のピクセルを描画する場合は
+ * epd_wrapper_put_pixel() を使い、描画範囲をまとめて記録してください。
  */
 void epd_wrapper_draw_pixel(EPDWrapper *wrapper, int x, int y, uint8_t color);
 
+/**
+ * @brief ダーティ矩形を記録せずに1ピクセルを描画する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param x X座標（フレームバッファ座標系、回転なし）
+ * @param y Y座標（フレームバッファ座標系、回転なし）
+ * @param color 色（0-15のグレースケール）
+ *
+ * クリップ矩形の外側の座標は無視されます。
+ * 描画した範囲は呼び出し側で epd_wrapper_mark_dirty() を1回呼び出して記録してください。
+ */
+void epd_wrapper_put_pixel(EPDWrapper *wrapper, int x, int y, uint8_t color);
+
+/**
+ * @brief 水平方向に同じ色のピクセルを連続して描画する
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param x 開始X座標（フレームバッファ座標系、回転なし）
+ * @param y Y座標（フレームバッファ座標系、回転なし）
+ * @param length ピクセル数
+ * @param color 色（0-15のグレースケール）
+ *
+ * 端数のニブルだけを個別に処理し、残りは32ビット単位で書き込みます。
+ */
+void epd_wrapper_fill_span(EPDWrapper *wrapper, int x, int y, int length, uint8_t color);
+
+/**
+ * @brief 4ビット/ピクセルの画像データ1行分をフレームバッファにコピーする
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param x 開始X座標（フレームバッファ座標系、回転なし）
+ * @param y Y座標（フレームバッファ座標系、回転なし）
+ * @param src 画像データ（偶数ピクセルが下位4ビット）
+ * @param src_x srcの先頭からのピクセル位置（コピー開始位置）
+ * @param length ピクセル数
+ */
+void epd_wrapper_blit_span(EPDWrapper *wrapper, int x, int y,
+                           const uint8_t *src, int src_x, int length);
+
+/**
+ * @brief 透明色を除いて4ビット/ピクセルの画像データ1行分をコピーする
+ * @param wrapper EPDラッパー構造体へのポインタ
+ * @param x 開始X座標（フレームバッファ座標系、回転なし）
+ * @param y Y座標（フレームバッファ座標系、回転なし）
+ * @param src 画像データ（偶数ピクセルが下位4ビット）
+ * @param src_x srcの先頭からのピクセル位置（コピー開始位置）
+ * @param length ピクセル数
+ * @param transparent_color 透明とする色（0-15の値）
+ */
+void epd_wrapper_blit_span_transparent(EPDWrapper *wrapper, int x, int y,
+                                       const uint8_t *src, int src_x, int length,
+                                       uint8_t transparent_color);
+
 #endif // EPD_WRAPPER_H
\ No newline at end of file
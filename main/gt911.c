@@ -6,6 +6,7 @@
 #include <string.h>
 #include "gt911.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "driver/gpio.h"
 #include "freertos/task.h"
 
@@ -38,6 +39,8 @@ static uint8_t gt911_default_config[] = {
 static void gt911_interrupt_handler(void *arg);
 static void gt911_task(void *pvParameters);
 static bool gt911_calculate_checksum(uint8_t *config, size_t len);
+static bool gt911_start_interrupt(GT911_Device *device);
+static void gt911_stop_interrupt(GT911_Device *device);
 
 /**
  * @brief GT911を初期化する
@@ -107,6 +110,12 @@ bool gt911_init(GT911_Device *device, gpio_num_t sda_pin, gpio_num_t scl_pin,
         // 初期化自体は続行
     }
 
+    // INTピンの割り込みでタッチを読み取る（失敗してもポーリングでは使用できる）
+    if (!gt911_start_interrupt(device))
+    {
+        ESP_LOGW(TAG, "Interrupt-driven touch reading is not available");
+    }
+
     ESP_LOGI(TAG, "GT911 initialized successfully");
     return true;
 }
@@ -121,26 +130,8 @@ void gt911_deinit(GT911_Device *device)
         return;
     }
 
-    // 割り込みハンドラを解除
-    if (device->int_pin != GPIO_NUM_NC)
-    {
-        gpio_isr_handler_remove(device->int_pin);
-        gpio_set_intr_type(device->int_pin, GPIO_INTR_DISABLE);
-    }
-
-    // タスクを終了
-    if (device->interrupt_task != NULL)
-    {
-        vTaskDelete(device->interrupt_task);
-        device->interrupt_task = NULL;
-    }
-
-    // セマフォを解放
-    if (device->touch_semaphore != NULL)
-    {
-        vSemaphoreDelete(device->touch_semaphore);
-        device->touch_semaphore = NULL;
-    }
+    // 割り込みハンドラと読み取りタスクを停止
+    gt911_stop_interrupt(device);
 
     // I2Cドライバを解放
     i2c_driver_delete(device->i2c_port);
@@ -164,37 +155,22 @@ bool gt911_read_registers(GT911_Device *device, uint16_t reg, uint8_t *data, siz
     buf[0] = (reg >> 8) & 0xFF;
     buf[1] = reg & 0xFF;
 
+    // レジスタアドレスの書き込みとデータの読み取りを、リピートスタートで1回の転送にまとめる
     i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    esp_err_t ret;
-
-    // レジスタアドレス書き込み
     i2c_master_start(cmd);
     i2c_master_write_byte(cmd, (device->i2c_addr << 1) | I2C_MASTER_WRITE, true);
     i2c_master_write(cmd, buf, 2, true);
-    i2c_master_stop(cmd);
-
-    ret = i2c_master_cmd_begin(device->i2c_port, cmd, GT911_I2C_TIMEOUT_MS / portTICK_PERIOD_MS);
-    i2c_cmd_link_delete(cmd);
-
-    if (ret != ESP_OK)
-    {
-        ESP_LOGE(TAG, "I2C write reg address failed: %s", esp_err_to_name(ret));
-        return false;
-    }
-
-    // データ読み取り
-    cmd = i2c_cmd_link_create();
     i2c_master_start(cmd);
     i2c_master_write_byte(cmd, (device->i2c_addr << 1) | I2C_MASTER_READ, true);
     i2c_master_read(cmd, data, len, I2C_MASTER_LAST_NACK);
     i2c_master_stop(cmd);
 
-    ret = i2c_master_cmd_begin(device->i2c_port, cmd, GT911_I2C_TIMEOUT_MS / portTICK_PERIOD_MS);
+    esp_err_t ret = i2c_master_cmd_begin(device->i2c_port, cmd, GT911_I2C_TIMEOUT_MS / portTICK_PERIOD_MS);
     i2c_cmd_link_delete(cmd);
 
     if (ret != ESP_OK)
     {
-        ESP_LOGE(TAG, "I2C read data failed: %s", esp_err_to_name(ret));
+        ESP_LOGE(TAG, "I2C read reg 0x%04X failed: %s", reg, esp_err_to_name(ret));
         return false;
     }
 
@@ -237,92 +213,162 @@ bool gt911_write_registers(GT911_Device *device, uint16_t reg, const uint8_t *da
 }
 
 /**
- * @brief タッチデータを読み取る
+ * @brief ステータスと全タッチポイントを一度に読み取る
+ * @param device GT911デバイス構造体へのポインタ
+ * @param event 読み取った内容を格納するイベント（timestamp_usは変更しない）
+ * @return 新しい座標データがあった場合true
+ *
+ * 0x814Eのステータスに続いて、各ポイントが8バイト
+ * （追跡ID、X、Y、サイズ、予約）で並んでいます。
+ * 新しいデータを読み取った場合はステータスをクリアします。
  */
-bool gt911_read_touch_data(GT911_Device *device)
+static bool gt911_read_event(GT911_Device *device, GT911_TouchEvent *event)
 {
-    if (device == NULL || !device->is_initialized)
+    uint8_t buf[GT911_BURST_READ_SIZE];
+    if (!gt911_read_registers(device, GT911_REG_STATUS, buf, sizeof(buf)))
     {
-        ESP_LOGE(TAG, "Device not initialized for reading touch data");
         return false;
     }
 
-    // ステータスレジスタを読み取り
-    uint8_t status;
-    if (!gt911_read_registers(device, GT911_REG_STATUS, &status, 1))
+    uint8_t status = buf[0];
+    if (!(status & GT911_STATUS_TOUCH))
     {
-        ESP_LOGE(TAG, "Failed to read status register");
+        // 座標データがまだ準備できていない
         return false;
     }
 
-    ESP_LOGI(TAG, "Status register: 0x%02X", status);
+    uint8_t count = status & GT911_STATUS_TOUCH_MASK;
+    if (count > GT911_MAX_TOUCH_POINTS)
+    {
+        count = GT911_MAX_TOUCH_POINTS;
+    }
 
-    // タッチイベントチェック
-    if (status & GT911_STATUS_TOUCH)
+    event->point_count = count;
+    for (uint8_t i = 0; i < GT911_MAX_TOUCH_POINTS; i++)
     {
-        // タッチポイント数を取得
-        device->active_points = status & GT911_STATUS_TOUCH_MASK;
-        ESP_LOGI(TAG, "Touch detected: %d point(s)", device->active_points);
+        const uint8_t *p = &buf[1 + i * GT911_REG_POINT_SIZE];
+        GT911_TouchPoint *point = &event->points[i];
+
+        point->tracking_id = p[0];
+        point->x = p[1] | (p[2] << 8);    // X座標 (リトルエンディアン)
+        point->y = p[3] | (p[4] << 8);    // Y座標 (リトルエンディアン)
+        point->size = p[5] | (p[6] << 8); // サイズ (リトルエンディアン)
+        point->is_pressed = i < count;
+    }
 
-        if (device->active_points > GT911_MAX_TOUCH_POINTS)
+    // ステータスレジスタをクリアして次の座標データを受け付ける
+    if (!gt911_clear_status(device))
+    {
+        ESP_LOGE(TAG, "Failed to clear status register");
+    }
+
+    return true;
+}
+
+/**
+ * @brief タッチデータを読み取る
+ */
+bool gt911_read_touch_data(GT911_Device *device)
+{
+    if (device == NULL || !device->is_initialized)
+    {
+        ESP_LOGE(TAG, "Device not initialized for reading touch data");
+        return false;
+    }
+
+    GT911_TouchEvent event;
+    if (!gt911_read_event(device, &event))
+    {
+        // タッチなしの場合
+        device->active_points = 0;
+        for (uint8_t i = 0; i < GT911_MAX_TOUCH_POINTS; i++)
         {
-            device->active_points = GT911_MAX_TOUCH_POINTS;
+            device->points[i].is_pressed = false;
         }
+        return false;
+    }
 
-        // 各タッチポイントのデータを読み取り
-        if (device->active_points > 0)
-        {
-            for (uint8_t i = 0; i < device->active_points; i++)
-            {
-                uint8_t point_data[GT911_REG_POINT_SIZE];
-                uint16_t point_addr = GT911_REG_TOUCH1 + (i * GT911_REG_POINT_SIZE);
+    device->active_points = event.point_count;
+    memcpy(device->points, event.points, sizeof(device->points));
 
-                if (!gt911_read_registers(device, point_addr, point_data, GT911_REG_POINT_SIZE))
-                {
-                    ESP_LOGE(TAG, "Failed to read touch point %d data", i);
-                    continue;
-                }
+    for (uint8_t i = 0; i < device->active_points; i++)
+    {
+        ESP_LOGD(TAG, "Touch point %d: x=%d, y=%d, size=%d, id=%d",
+                 i, device->points[i].x, device->points[i].y,
+                 device->points[i].size, device->points[i].tracking_id);
+    }
 
-                // X座標 (2バイト, リトルエンディアン)
-                device->points[i].x = point_data[0] | (point_data[1] << 8);
+    return true;
+}
 
-                // Y座標 (2バイト, リトルエンディアン)
-                device->points[i].y = point_data[2] | (point_data[3] << 8);
+/**
+ * @brief リングバッファにイベントを追加する（読み取りタスクのみが呼び出す）
+ * @return 追加できた場合true。満杯の場合はイベントを破棄してfalse
+ */
+static bool gt911_ring_push(GT911_EventRing *ring, const GT911_TouchEvent *event)
+{
+    uint32_t head = ring->head;
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
 
-                // サイズ (2バイト, リトルエンディアン)
-                device->points[i].size = point_data[4] | (point_data[5] << 8);
+    if (head - tail >= GT911_EVENT_RING_SIZE)
+    {
+        ring->dropped++;
+        return false;
+    }
 
-                // 追跡ID
-                device->points[i].tracking_id = point_data[6];
+    ring->events[head & (GT911_EVENT_RING_SIZE - 1)] = *event;
+    // イベントの書き込みが完了してからheadを公開する
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
 
-                // 押下状態
-                device->points[i].is_pressed = true;
+/**
+ * @brief リングバッファからイベントを取り出す（利用側のみが呼び出す）
+ * @return 取り出せた場合true
+ */
+static bool gt911_ring_pop(GT911_EventRing *ring, GT911_TouchEvent *event)
+{
+    uint32_t tail = ring->tail;
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
 
-                ESP_LOGD(TAG, "Touch point %d: x=%d, y=%d, size=%d, id=%d",
-                         i, device->points[i].x, device->points[i].y,
-                         device->points[i].size, device->points[i].tracking_id);
-            }
-        }
+    if (head == tail)
+    {
+        return false;
+    }
 
-        // ステータスレジスタをクリア
-        if (!gt911_clear_status(device))
-        {
-            ESP_LOGE(TAG, "Failed to clear status register");
-        }
+    *event = ring->events[tail & (GT911_EVENT_RING_SIZE - 1)];
+    // イベントを読み終えてから領域を返す
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
 
-        return true;
+bool gt911_get_event(GT911_Device *device, GT911_TouchEvent *event, TickType_t timeout)
+{
+    if (device == NULL || event == NULL || device->touch_semaphore == NULL)
+    {
+        return false;
     }
-    else
+
+    TickType_t start = xTaskGetTickCount();
+    while (!gt911_ring_pop(&device->event_ring, event))
     {
-        // タッチなしの場合
-        device->active_points = 0;
-        for (uint8_t i = 0; i < GT911_MAX_TOUCH_POINTS; i++)
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        if (timeout == 0 || (timeout != portMAX_DELAY && elapsed >= timeout))
         {
-            device->points[i].is_pressed = false;
+            return false;
         }
+
+        // 読み取りタスクがイベントを追加するまで待つ
+        xSemaphoreTake(device->touch_semaphore,
+                       timeout == portMAX_DELAY ? portMAX_DELAY : timeout - elapsed);
     }
 
-    return false;
+    return true;
+}
+
+bool gt911_is_interrupt_enabled(GT911_Device *device)
+{
+    return device != NULL && device->interrupt_task != NULL;
 }
 
 /**
@@ -474,10 +520,6 @@ bool gt911_clear_status(GT911_Device *device)
     {
         ESP_LOGE(TAG, "Failed to clear status register");
     }
-    else
-    {
-        ESP_LOGI(TAG, "Status register cleared");
-    }
 
     return ret;
 }
@@ -539,17 +581,17 @@ bool gt911_set_refresh_rate(GT911_Device *device, uint8_t rate)
 
 /**
  * @brief 割り込みハンドラ
+ *
+ * 時刻を記録して読み取りタスクを起こすだけで、I2C通信はタスク側で行います。
  */
 static void IRAM_ATTR gt911_interrupt_handler(void *arg)
 {
     GT911_Device *device = (GT911_Device *)arg;
 
-    // ISR内ではESP_LOGIは使えないのでets_printfを使用
-    ESP_LOGI(TAG, "INT triggered!\n");
+    device->irq_time_us = esp_timer_get_time();
 
-    // セマフォを通知
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    xSemaphoreGiveFromISR(device->touch_semaphore, &xHigherPriorityTaskWoken);
+    vTaskNotifyGiveFromISR(device->interrupt_task, &xHigherPriorityTaskWoken);
 
     if (xHigherPriorityTaskWoken)
     {
@@ -558,60 +600,151 @@ static void IRAM_ATTR gt911_interrupt_handler(void *arg)
 }
 
 /**
- * @brief タッチ処理タスク
+ * @brief タッチ読み取りタスク
+ *
+ * 割り込みを受けるたびにステータスと全ポイントを一括で読み取り、
+ * タイムスタンプ付きのイベントとしてリングバッファに追加します。
+ * 割り込みがない間はI2C通信を行いません。
  */
 static void gt911_task(void *pvParameters)
 {
     GT911_Device *device = (GT911_Device *)pvParameters;
-    ESP_LOGI(TAG, "Touch task started");
-
-    uint32_t last_poll_time = 0;
-    const uint32_t POLLING_INTERVAL_MS = 50; // 50msごとにポーリング
+    ESP_LOGI(TAG, "Touch reader task started");
 
     while (1)
     {
-        // 割り込み待機と定期的なポーリングを組み合わせる
-        if (xSemaphoreTake(device->touch_semaphore, pdMS_TO_TICKS(POLLING_INTERVAL_MS)) == pdTRUE)
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        GT911_TouchEvent event;
+        event.timestamp_us = device->irq_time_us;
+        if (!gt911_read_event(device, &event))
         {
-            ESP_LOGI(TAG, "Semaphore received - interrupt triggered");
-            // 割り込みによるタッチ検出
-            if (gt911_read_touch_data(device))
-            {
-                if (device->active_points > 0 && callback)
-                {
-                    callback(device);
-                }
-            }
+            continue;
         }
-        else
+
+        device->active_points = event.point_count;
+        memcpy(device->points, event.points, sizeof(device->points));
+
+        if (gt911_ring_push(&device->event_ring, &event))
+        {
+            xSemaphoreGive(device->touch_semaphore);
+        }
+
+        if (device->active_points > 0 && callback)
+        {
+            callback(device);
+        }
+    }
+}
+
+/**
+ * @brief INTピンの割り込みと読み取りタスクを開始する
+ * @param device GT911デバイス構造体へのポインタ
+ * @return 成功した場合true
+ */
+static bool gt911_start_interrupt(GT911_Device *device)
+{
+    if (device->int_pin == GPIO_NUM_NC)
+    {
+        return false;
+    }
+
+    // INTの出力方式（モジュールスイッチ1のbit0-1）に合わせてエッジを選ぶ
+    gpio_int_type_t intr_type = GPIO_INTR_POSEDGE;
+    uint8_t switch1 = 0;
+    if (gt911_read_registers(device, GT911_REG_MODULE_SWITCH1, &switch1, 1))
+    {
+        switch (switch1 & GT911_INT_TRIGGER_MASK)
         {
-            // タイムアウト - 定期的なポーリングを実行
-            uint32_t current_time = xTaskGetTickCount() * portTICK_PERIOD_MS;
-            if (current_time - last_poll_time >= POLLING_INTERVAL_MS)
-            {
-                last_poll_time = current_time;
-
-                // ステータスレジスタを直接チェック
-                uint8_t status;
-                if (gt911_read_registers(device, GT911_REG_STATUS, &status, 1))
-                {
-                    ESP_LOGI(TAG, "Polling: status register = 0x%02X", status);
-
-                    if (status & GT911_STATUS_TOUCH)
-                    {
-                        ESP_LOGI(TAG, "Touch detected via polling");
-                        if (gt911_read_touch_data(device))
-                        {
-                            if (device->active_points > 0 && callback)
-                            {
-                                callback(device);
-                            }
-                        }
-                    }
-                }
-            }
+        case 0x01: // 立ち下がりエッジ
+        case 0x02: // LOWレベル（立ち下がりで検出）
+            intr_type = GPIO_INTR_NEGEDGE;
+            break;
+        default: // 立ち上がりエッジ、HIGHレベル
+            intr_type = GPIO_INTR_POSEDGE;
+            break;
         }
     }
+
+    memset(&device->event_ring, 0, sizeof(device->event_ring));
+    device->touch_semaphore = xSemaphoreCreateBinary();
+    if (device->touch_semaphore == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create touch semaphore");
+        return false;
+    }
+
+    if (xTaskCreate(gt911_task, "gt911_reader", GT911_READER_TASK_STACK, device,
+                    GT911_READER_TASK_PRIORITY, &device->interrupt_task) != pdPASS)
+    {
+        ESP_LOGE(TAG, "Failed to create touch reader task");
+        device->interrupt_task = NULL;
+        gt911_stop_interrupt(device);
+        return false;
+    }
+
+    gpio_config_t io_conf = {
+        .pin_bit_mask = 1ULL << device->int_pin,
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = intr_type,
+    };
+    esp_err_t err = gpio_config(&io_conf);
+
+    // ISRサービスは他のドライバがインストール済みの場合もある
+    if (err == ESP_OK)
+    {
+        err = gpio_install_isr_service(0);
+        if (err == ESP_ERR_INVALID_STATE)
+        {
+            err = ESP_OK;
+        }
+    }
+    if (err == ESP_OK)
+    {
+        err = gpio_isr_handler_add(device->int_pin, gt911_interrupt_handler, device);
+    }
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to set up INT pin interrupt: %s", esp_err_to_name(err));
+        gt911_stop_interrupt(device);
+        return false;
+    }
+
+    // 初期化中に溜まった座標データを読み捨ててINTを再開させる
+    xTaskNotifyGive(device->interrupt_task);
+
+    ESP_LOGI(TAG, "Interrupt-driven touch reading enabled on GPIO %d", device->int_pin);
+    return true;
+}
+
+/**
+ * @brief INTピンの割り込みと読み取りタスクを停止する
+ * @param device GT911デバイス構造体へのポインタ
+ */
+static void gt911_stop_interrupt(GT911_Device *device)
+{
+    // 割り込みハンドラを解除
+    if (device->int_pin != GPIO_NUM_NC)
+    {
+        gpio_isr_handler_remove(device->int_pin);
+        gpio_set_intr_type(device->int_pin, GPIO_INTR_DISABLE);
+    }
+
+    // タスクを終了
+    if (device->interrupt_task != NULL)
+    {
+        vTaskDelete(device->interrupt_task);
+        device->interrupt_task = NULL;
+    }
+
+    // セマフォを解放
+    if (device->touch_semaphore != NULL)
+    {
+        vSemaphoreDelete(device->touch_semaphore);
+        device->touch_semaphore = NULL;
+    }
 }
 
 /**
@@ -90,6 +90,14 @@
 // タッチポイント最大数
 #define GT911_MAX_TOUCH_POINTS 2 // 最大2点までのマルチタッチをサポート
 
+// 割り込み駆動の読み取り設定
+#define GT911_EVENT_RING_SIZE 16      // タッチイベントのリングバッファの要素数（2のべき乗）
+#define GT911_READER_TASK_STACK 3072  // 読み取りタスクのスタックサイズ
+#define GT911_READER_TASK_PRIORITY 10 // 読み取りタスクの優先度
+
+// ステータス(0x814E)から最後のタッチポイントまでを一度に読み取るバイト数
+#define GT911_BURST_READ_SIZE (1 + GT911_REG_POINT_SIZE * GT911_MAX_TOUCH_POINTS)
+
 // モジュールスイッチビット
 #define GT911_SWITCH_Y_REVERSE 0x80 // Y軸反転 (bit7)
 #define GT911_SWITCH_X_REVERSE 0x40 // X軸反転 (bit6)
@@ -110,6 +118,23 @@ typedef struct
     bool is_pressed;     // 押下状態
 } GT911_TouchPoint;
 
+// タッチイベント構造体（1回の割り込みで読み取った内容）
+typedef struct
+{
+    int64_t timestamp_us;                            // 割り込みが発生した時刻（esp_timer_get_time()）
+    uint8_t point_count;                             // タッチポイント数（0は指が離れたことを表す）
+    GT911_TouchPoint points[GT911_MAX_TOUCH_POINTS]; // タッチポイントデータ
+} GT911_TouchEvent;
+
+// タッチイベントのリングバッファ（読み取りタスクが書き込み、1つの利用側が読み出す）
+typedef struct
+{
+    GT911_TouchEvent events[GT911_EVENT_RING_SIZE]; // イベント
+    volatile uint32_t head;                         // 次に書き込む位置（読み取りタスクのみが更新）
+    volatile uint32_t tail;                         // 次に読み出す位置（利用側のみが更新）
+    volatile uint32_t dropped;                      // 満杯のため破棄したイベント数
+} GT911_EventRing;
+
 // タッチキー構造体
 typedef struct
 {
@@ -143,8 +168,10 @@ typedef struct
     gpio_num_t rst_pin; // リセットピン（使用する場合）
 
     // 割り込み処理用
-    SemaphoreHandle_t touch_semaphore; // タッチイベント通知用セマフォ
-    TaskHandle_t interrupt_task;       // 割り込み処理タスク
+    SemaphoreHandle_t touch_semaphore; // タッチイベント通知用セマフォ（利用側を起こす）
+    TaskHandle_t interrupt_task;       // 割り込み処理タスク（読み取りタスク）
+    volatile int64_t irq_time_us;      // 最後に割り込みが発生した時刻
+    GT911_EventRing event_ring;        // タッチイベントのリングバッファ
     
     void *user_data;                   // ユーザーデータポインタ
 } GT911_Device;
@@ -199,6 +226,25 @@ bool gt911_write_registers(GT911_Device *device, uint16_t reg, const uint8_t *da
  */
 bool gt911_read_touch_data(GT911_Device *device);
 
+/**
+ * @brief 割り込みで読み取ったタッチイベントを1つ取り出す
+ * @param device GT911デバイス構造体へのポインタ
+ * @param event 取り出したイベントを格納する構造体
+ * @param timeout イベントがない場合の最大待ち時間（0の場合は待たない）
+ * @return イベントを取り出せた場合true
+ *
+ * イベントはINTピンの割り込みを受けた読み取りタスクが書き込みます。
+ * 取り出しは1つのタスクからだけ行ってください。
+ */
+bool gt911_get_event(GT911_Device *device, GT911_TouchEvent *event, TickType_t timeout);
+
+/**
+ * @brief 割り込み駆動の読み取りが有効かどうかを返す
+ * @param device GT911デバイス構造体へのポインタ
+ * @return 読み取りタスクが動作している場合true
+ */
+bool gt911_is_interrupt_enabled(GT911_Device *device);
+
 /**
  * @brief タッチキーの状態を読み取る
  * @param device GT911デバイス構造体へのポインタ
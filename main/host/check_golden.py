@@ -0,0 +1,110 @@
+# ホストビルドの実行結果を基準（golden/）と比較する
+#
+# python main/host/check_golden.py build/esp32s3_paper_test.elf           # 比較（違いがあれば終了コード1）
+# python main/host/check_golden.py build/esp32s3_paper_test.elf --update  # 基準を更新
+#
+# 比較するもの:
+#   - EPD_HOST_STATS の各行（実行時間 time_us は除く）: golden/stats.txt
+#   - 各シナリオ後の表示内容（PGM）: golden/<シナリオ名>.pgm.gz
+
+import argparse
+import gzip
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+GOLDEN_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'golden')
+STATS_FILE = os.path.join(GOLDEN_DIR, 'stats.txt')
+PGM_HEADER = b'P5\n960 540\n255\n'
+WIDTH = 960
+HEIGHT = 540
+
+def run_host(executable, output_dir):
+    """ホストビルドを実行し、実行時間を除いた統計の行を返す"""
+    result = subprocess.run([executable, output_dir], stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            timeout=300, check=False)
+    output = result.stdout.decode('utf-8', errors='replace')
+    if result.returncode != 0:
+        print(output)
+        sys.exit(f"エラー: {executable} が終了コード {result.returncode} で終了しました")
+    stats = [re.sub(r' time_us=\d+', '', line.strip())
+             for line in output.splitlines() if line.startswith('EPD_HOST_STATS ')]
+    if not stats:
+        sys.exit("エラー: EPD_HOST_STATS の行が出力されませんでした")
+    return stats
+
+def compare_pgm(name, actual, expected):
+    """2つのPGMを比較し、違いがあれば内容を表示してFalseを返す"""
+    if actual == expected:
+        return True
+    if len(actual) != len(expected) or not actual.startswith(PGM_HEADER):
+        print(f"{name}: 画像の形式が異なります")
+        return False
+
+    # 違うピクセルの数と範囲を表示する
+    pixels_a = actual[len(PGM_HEADER):]
+    pixels_e = expected[len(PGM_HEADER):]
+    diffs = [i for i in range(WIDTH * HEIGHT) if pixels_a[i] != pixels_e[i]]
+    xs = [i % WIDTH for i in diffs]
+    ys = [i // WIDTH for i in diffs]
+    print(f"{name}: {len(diffs)} ピクセルが異なります "
+          f"(x={min(xs)}..{max(xs)}, y={min(ys)}..{max(ys)})")
+    return False
+
+def main():
+    parser = argparse.ArgumentParser(description='ホストビルドの描画結果を基準と比較')
+    parser.add_argument('executable', help='ホストビルドの実行ファイル（build/esp32s3_paper_test.elf）')
+    parser.add_argument('--update', action='store_true', help='比較せずに基準を更新')
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as output_dir:
+        stats = run_host(os.path.abspath(args.executable), output_dir)
+        images = {os.path.splitext(f)[0]: os.path.join(output_dir, f)
+                  for f in sorted(os.listdir(output_dir)) if f.endswith('.pgm')}
+
+        if args.update:
+            os.makedirs(GOLDEN_DIR, exist_ok=True)
+            with open(STATS_FILE, 'w', encoding='utf-8') as f:
+                f.write('\n'.join(stats) + '\n')
+            for name, path in images.items():
+                with open(path, 'rb') as src:
+                    # 再生成しても差分が出ないよう、gzipの時刻は0にする
+                    data = gzip.compress(src.read(), mtime=0)
+                with open(os.path.join(GOLDEN_DIR, f"{name}.pgm.gz"), 'wb') as dst:
+                    dst.write(data)
+            print(f"基準を更新しました: {len(stats)} 行の統計, {len(images)} 枚の画像")
+            return 0
+
+        ok = True
+        with open(STATS_FILE, encoding='utf-8') as f:
+            expected_stats = [line.strip() for line in f if line.strip()]
+        if stats != expected_stats:
+            ok = False
+            print("統計が異なります:")
+            for line in expected_stats:
+                if line not in stats:
+                    print(f"  - {line}")
+            for line in stats:
+                if line not in expected_stats:
+                    print(f"  + {line}")
+
+        expected_names = sorted(f[:-len('.pgm.gz')] for f in os.listdir(GOLDEN_DIR) if f.endswith('.pgm.gz'))
+        if expected_names != sorted(images):
+            ok = False
+            print(f"画像の種類が異なります: 基準={expected_names}, 実行結果={sorted(images)}")
+        for name in expected_names:
+            if name not in images:
+                continue
+            with open(images[name], 'rb') as f:
+                actual = f.read()
+            with gzip.open(os.path.join(GOLDEN_DIR, f"{name}.pgm.gz"), 'rb') as f:
+                expected = f.read()
+            ok = compare_pgm(name, actual, expected) and ok
+
+    print("基準と一致しました" if ok else "基準と一致しません（意図した変更であれば --update で更新してください）")
+    return 0 if ok else 1
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,29 @@
+/**
+ * @file epd_highlevel.h
+ * @brief ホスト（Linux）ビルド用のepdiyハイレベルAPI互換ヘッダー
+ */
+
+#ifndef EPD_HOST_EPD_HIGHLEVEL_H
+#define EPD_HOST_EPD_HIGHLEVEL_H
+
+#include "epdiy.h"
+
+/**
+ * @brief ハイレベルAPIの状態
+ *
+ * front_fbは描画用、back_fbはパネルに表示されている内容を表します。
+ */
+typedef struct
+{
+    uint8_t *front_fb;
+    uint8_t *back_fb;
+    const EpdWaveform *waveform;
+} EpdiyHighlevelState;
+
+EpdiyHighlevelState epd_hl_init(const EpdWaveform *waveform);
+uint8_t *epd_hl_get_framebuffer(EpdiyHighlevelState *state);
+enum EpdDrawError epd_hl_update_screen(EpdiyHighlevelState *state, enum EpdDrawMode mode, int temperature);
+enum EpdDrawError epd_hl_update_area(EpdiyHighlevelState *state, enum EpdDrawMode mode, int temperature, EpdRect area);
+void epd_hl_set_all_white(EpdiyHighlevelState *state);
+
+#endif // EPD_HOST_EPD_HIGHLEVEL_H
@@ -0,0 +1,617 @@
+/**
+ * @file epd_host.c
+ * @brief ホスト（Linux）用のディスプレイバックエンドの実装
+ *
+ * 描画関数の座標変換・ピクセル形式はepdiyと同じにしてあるため、
+ * 実機と同じフレームバッファの内容が得られます。
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+
+#include "epdiy.h"
+#include "epd_highlevel.h"
+#include "epd_board_m5papers3.h"
+#include "epd_host.h"
+
+static const char *TAG = "epd_host";
+
+#define HOST_WIDTH 960
+#define HOST_HEIGHT 540
+#define HOST_FB_SIZE (HOST_WIDTH * HOST_HEIGHT / 2)
+
+const EpdDisplay_t ED047TC1 = {
+    .width = HOST_WIDTH,
+    .height = HOST_HEIGHT,
+    .bus_width = 8,
+    .bus_speed = 20,
+};
+
+const EpdWaveform epdiy_ED047TC1 = {
+    .num_modes = 0,
+};
+
+// ボード定義はホストでは参照されるだけで使用しない
+const EpdBoardDefinition epd_board_m5papers3 = {0};
+
+/**
+ * @brief バックエンド全体の状態
+ */
+typedef struct
+{
+    const EpdDisplay_t *display;
+    enum EpdRotation rotation;
+    uint8_t *front_fb; // 描画用フレームバッファ
+    uint8_t *back_fb;  // パネルに表示されている内容
+    EPDHostStats stats;
+    EPDHostUpdate log[EPD_HOST_UPDATE_LOG_SIZE];
+    uint32_t log_count; // これまでに記録した数（上書き分を含む）
+    char dump_dir[256];
+    uint32_t dump_index;
+} HostState;
+
+static HostState s_host = {
+    .display = &ED047TC1,
+};
+
+void epd_init(const EpdBoardDefinition *board, const EpdDisplay_t *display, enum EpdInitOptions options)
+{
+    s_host.display = display != NULL ? display : &ED047TC1;
+    s_host.rotation = EPD_ROT_LANDSCAPE;
+
+    const char *dir = getenv("EPD_HOST_DUMP_DIR");
+    if (dir != NULL && dir[0] != '\0')
+    {
+        epd_host_set_dump_dir(dir);
+    }
+
+    ESP_LOGI(TAG, "Host display backend initialized (%dx%d)",
+             s_host.display->width, s_host.display->height);
+}
+
+void epd_deinit(void)
+{
+    free(s_host.front_fb);
+    free(s_host.back_fb);
+    s_host.front_fb = NULL;
+    s_host.back_fb = NULL;
+}
+
+void epd_poweron(void)
+{
+}
+
+void epd_poweroff(void)
+{
+}
+
+float epd_ambient_temperature(void)
+{
+    return 25.0f;
+}
+
+const EpdDisplay_t *epd_get_display(void)
+{
+    return s_host.display;
+}
+
+void epd_set_rotation(enum EpdRotation rotation)
+{
+    s_host.rotation = rotation;
+}
+
+enum EpdRotation epd_get_rotation(void)
+{
+    return s_host.rotation;
+}
+
+int epd_width(void)
+{
+    return s_host.display->width;
+}
+
+int epd_height(void)
+{
+    return s_host.display->height;
+}
+
+int epd_rotated_display_width(void)
+{
+    return (s_host.rotation == EPD_ROT_PORTRAIT || s_host.rotation == EPD_ROT_INVERTED_PORTRAIT)
+               ? epd_height()
+               : epd_width();
+}
+
+int epd_rotated_display_height(void)
+{
+    return (s_host.rotation == EPD_ROT_PORTRAIT || s_host.rotation == EPD_ROT_INVERTED_PORTRAIT)
+               ? epd_width()
+               : epd_height();
+}
+
+/**
+ * @brief 論理座標をパネル座標に変換する（epdiyの_rotateと同じ）
+ */
+static void rotate_point(int *x, int *y)
+{
+    int tmp;
+    switch (s_host.rotation)
+    {
+    case EPD_ROT_PORTRAIT:
+        tmp = *x;
+        *x = epd_width() - *y - 1;
+        *y = tmp;
+        break;
+    case EPD_ROT_INVERTED_LANDSCAPE:
+        *x = epd_width() - *x - 1;
+        *y = epd_height() - *y - 1;
+        break;
+    case EPD_ROT_INVERTED_PORTRAIT:
+        tmp = *x;
+        *x = *y;
+        *y = epd_height() - tmp - 1;
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief パネル座標の1ピクセルに4ビット値を書き込む
+ */
+static inline void put_nibble(uint8_t *framebuffer, int x, int y, uint8_t value)
+{
+    uint8_t *p = &framebuffer[y * epd_width() / 2 + x / 2];
+    if (x % 2)
+    {
+        *p = (*p & 0x0F) | (value << 4);
+    }
+    else
+    {
+        *p = (*p & 0xF0) | value;
+    }
+}
+
+void epd_draw_pixel(int x, int y, uint8_t color, uint8_t *framebuffer)
+{
+    if (x < 0 || x >= epd_rotated_display_width() || y < 0 || y >= epd_rotated_display_height())
+    {
+        return;
+    }
+    rotate_point(&x, &y);
+    put_nibble(framebuffer, x, y, color >> 4);
+}
+
+void epd_draw_hline(int x, int y, int length, uint8_t color, uint8_t *framebuffer)
+{
+    for (int i = 0; i < length; i++)
+    {
+        epd_draw_pixel(x + i, y, color, framebuffer);
+    }
+}
+
+void epd_draw_vline(int x, int y, int length, uint8_t color, uint8_t *framebuffer)
+{
+    for (int i = 0; i < length; i++)
+    {
+        epd_draw_pixel(x, y + i, color, framebuffer);
+    }
+}
+
+void epd_draw_circle(int x0, int y0, int r, uint8_t color, uint8_t *framebuffer)
+{
+    int f = 1 - r;
+    int ddF_x = 1;
+    int ddF_y = -2 * r;
+    int x = 0;
+    int y = r;
+
+    epd_draw_pixel(x0, y0 + r, color, framebuffer);
+    epd_draw_pixel(x0, y0 - r, color, framebuffer);
+    epd_draw_pixel(x0 + r, y0, color, framebuffer);
+    epd_draw_pixel(x0 - r, y0, color, framebuffer);
+
+    while (x < y)
+    {
+        if (f >= 0)
+        {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        epd_draw_pixel(x0 + x, y0 + y, color, framebuffer);
+        epd_draw_pixel(x0 - x, y0 + y, color, framebuffer);
+        epd_draw_pixel(x0 + x, y0 - y, color, framebuffer);
+        epd_draw_pixel(x0 - x, y0 - y, color, framebuffer);
+        epd_draw_pixel(x0 + y, y0 + x, color, framebuffer);
+        epd_draw_pixel(x0 - y, y0 + x, color, framebuffer);
+        epd_draw_pixel(x0 + y, y0 - x, color, framebuffer);
+        epd_draw_pixel(x0 - y, y0 - x, color, framebuffer);
+    }
+}
+
+void epd_fill_circle(int x0, int y0, int r, uint8_t color, uint8_t *framebuffer)
+{
+    epd_draw_vline(x0, y0 - r, 2 * r + 1, color, framebuffer);
+
+    int f = 1 - r;
+    int ddF_x = 1;
+    int ddF_y = -2 * r;
+    int x = 0;
+    int y = r;
+
+    while (x < y)
+    {
+        if (f >= 0)
+        {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        epd_draw_vline(x0 + x, y0 - y, 2 * y + 1, color, framebuffer);
+        epd_draw_vline(x0 + y, y0 - x, 2 * x + 1, color, framebuffer);
+        epd_draw_vline(x0 - x, y0 - y, 2 * y + 1, color, framebuffer);
+        epd_draw_vline(x0 - y, y0 - x, 2 * x + 1, color, framebuffer);
+    }
+}
+
+/**
+ * @brief 水平・垂直でない直線を描画する（epdiyの epd_write_line と同じ手順）
+ */
+static void write_line(int x0, int y0, int x1, int y1, uint8_t color, uint8_t *framebuffer)
+{
+    int steep = abs(y1 - y0) > abs(x1 - x0);
+    int tmp;
+    if (steep)
+    {
+        tmp = x0, x0 = y0, y0 = tmp;
+        tmp = x1, x1 = y1, y1 = tmp;
+    }
+    if (x0 > x1)
+    {
+        tmp = x0, x0 = x1, x1 = tmp;
+        tmp = y0, y0 = y1, y1 = tmp;
+    }
+
+    int dx = x1 - x0;
+    int dy = abs(y1 - y0);
+    int err = dx / 2;
+    int ystep = y0 < y1 ? 1 : -1;
+
+    for (; x0 <= x1; x0++)
+    {
+        if (steep)
+        {
+            epd_draw_pixel(y0, x0, color, framebuffer);
+        }
+        else
+        {
+            epd_draw_pixel(x0, y0, color, framebuffer);
+        }
+        err -= dy;
+        if (err < 0)
+        {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+}
+
+void epd_draw_line(int x0, int y0, int x1, int y1, uint8_t color, uint8_t *framebuffer)
+{
+    // 水平・垂直な線はepdiyと同様に hline/vline で描く
+    int tmp;
+    if (x0 == x1)
+    {
+        if (y0 > y1)
+        {
+            tmp = y0, y0 = y1, y1 = tmp;
+        }
+        epd_draw_vline(x0, y0, y1 - y0 + 1, color, framebuffer);
+    }
+    else if (y0 == y1)
+    {
+        if (x0 > x1)
+        {
+            tmp = x0, x0 = x1, x1 = tmp;
+        }
+        epd_draw_hline(x0, y0, x1 - x0 + 1, color, framebuffer);
+    }
+    else
+    {
+        write_line(x0, y0, x1, y1, color, framebuffer);
+    }
+}
+
+void epd_draw_rect(EpdRect rect, uint8_t color, uint8_t *framebuffer)
+{
+    epd_draw_hline(rect.x, rect.y, rect.width, color, framebuffer);
+    epd_draw_hline(rect.x, rect.y + rect.height - 1, rect.width, color, framebuffer);
+    epd_draw_vline(rect.x, rect.y, rect.height, color, framebuffer);
+    epd_draw_vline(rect.x + rect.width - 1, rect.y, rect.height, color, framebuffer);
+}
+
+void epd_fill_rect(EpdRect rect, uint8_t color, uint8_t *framebuffer)
+{
+    for (int y = rect.y; y < rect.y + rect.height; y++)
+    {
+        epd_draw_hline(rect.x, y, rect.width, color, framebuffer);
+    }
+}
+
+void epd_copy_to_framebuffer(EpdRect image_area, const uint8_t *image_data, uint8_t *framebuffer)
+{
+    for (int i = 0; i < image_area.width * image_area.height; i++)
+    {
+        int value_index = i;
+        // 幅が奇数の画像は行ごとに1ニブル余分に消費する
+        if (image_area.width % 2)
+        {
+            value_index += i / image_area.width;
+        }
+        uint8_t value = (value_index % 2) ? (image_data[value_index / 2] >> 4)
+                                          : (image_data[value_index / 2] & 0x0F);
+
+        int x = image_area.x + i % image_area.width;
+        int y = image_area.y + i / image_area.width;
+        if (x < 0 || x >= epd_rotated_display_width() || y < 0 || y >= epd_rotated_display_height())
+        {
+            continue;
+        }
+        rotate_point(&x, &y);
+        put_nibble(framebuffer, x, y, value);
+    }
+}
+
+EpdiyHighlevelState epd_hl_init(const EpdWaveform *waveform)
+{
+    EpdiyHighlevelState state = {0};
+
+    epd_deinit();
+    s_host.front_fb = malloc(HOST_FB_SIZE);
+    s_host.back_fb = malloc(HOST_FB_SIZE);
+    if (s_host.front_fb == NULL || s_host.back_fb == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate host framebuffers");
+        epd_deinit();
+        return state;
+    }
+
+    memset(s_host.front_fb, 0xFF, HOST_FB_SIZE);
+    memset(s_host.back_fb, 0xFF, HOST_FB_SIZE);
+    epd_host_reset_stats();
+
+    state.front_fb = s_host.front_fb;
+    state.back_fb = s_host.back_fb;
+    state.waveform = waveform;
+    return state;
+}
+
+uint8_t *epd_hl_get_framebuffer(EpdiyHighlevelState *state)
+{
+    return state->front_fb;
+}
+
+void epd_hl_set_all_white(EpdiyHighlevelState *state)
+{
+    memset(state->front_fb, 0xFF, HOST_FB_SIZE);
+}
+
+/**
+ * @brief パネル座標の矩形をフレームバッファの範囲に収める
+ */
+static bool clip_to_panel(EpdRect *area)
+{
+    int x0 = area->x < 0 ? 0 : area->x;
+    int y0 = area->y < 0 ? 0 : area->y;
+    int x1 = area->x + area->width > epd_width() ? epd_width() : area->x + area->width;
+    int y1 = area->y + area->height > epd_height() ? epd_height() : area->y + area->height;
+    if (x1 <= x0 || y1 <= y0)
+    {
+        return false;
+    }
+    *area = (EpdRect){.x = x0, .y = y0, .width = x1 - x0, .height = y1 - y0};
+    return true;
+}
+
+/**
+ * @brief 論理座標の矩形をパネル座標に変換する
+ */
+static EpdRect area_to_panel(EpdRect area)
+{
+    int x0 = area.x;
+    int y0 = area.y;
+    int x1 = area.x + area.width - 1;
+    int y1 = area.y + area.height - 1;
+    rotate_point(&x0, &y0);
+    rotate_point(&x1, &y1);
+
+    EpdRect result = {
+        .x = x0 < x1 ? x0 : x1,
+        .y = y0 < y1 ? y0 : y1,
+        .width = abs(x1 - x0) + 1,
+        .height = abs(y1 - y0) + 1,
+    };
+    return result;
+}
+
+/**
+ * @brief 描画用フレームバッファの指定領域をパネルに反映して記録する
+ */
+static void drive_panel(EpdiyHighlevelState *state, EpdRect area, enum EpdDrawMode mode,
+                        int temperature, bool full_screen)
+{
+    uint32_t changed = 0;
+
+    if (clip_to_panel(&area))
+    {
+        for (int y = area.y; y < area.y + area.height; y++)
+        {
+            for (int x = area.x; x < area.x + area.width; x++)
+            {
+                int index = y * epd_width() / 2 + x / 2;
+                int shift = (x % 2) ? 4 : 0;
+                uint8_t next = (state->front_fb[index] >> shift) & 0x0F;
+                uint8_t current = (state->back_fb[index] >> shift) & 0x0F;
+                if (next != current)
+                {
+                    put_nibble(state->back_fb, x, y, next);
+                    changed++;
+                }
+            }
+        }
+    }
+    else
+    {
+        area = (EpdRect){0};
+    }
+
+    EPDHostStats *stats = &s_host.stats;
+    stats->updates++;
+    if (full_screen)
+        stats->full_updates++;
+    else
+        stats->area_updates++;
+    stats->pixels_driven += (uint64_t)area.width * area.height;
+    stats->pixels_changed += changed;
+
+    switch (mode & 0xFF)
+    {
+    case MODE_GC16:
+        stats->mode_counts[0]++;
+        break;
+    case MODE_DU:
+        stats->mode_counts[1]++;
+        break;
+    case MODE_INIT:
+        stats->mode_counts[2]++;
+        break;
+    default:
+        stats->mode_counts[3]++;
+        break;
+    }
+
+    EPDHostUpdate *entry = &s_host.log[s_host.log_count % EPD_HOST_UPDATE_LOG_SIZE];
+    entry->area = area;
+    entry->mode = mode;
+    entry->temperature = temperature;
+    entry->full_screen = full_screen;
+    entry->changed = changed;
+    s_host.log_count++;
+
+    if (s_host.dump_dir[0] != '\0')
+    {
+        char path[sizeof(s_host.dump_dir) + 32];
+        snprintf(path, sizeof(path), "%s/frame_%05u.pgm", s_host.dump_dir, (unsigned)s_host.dump_index++);
+        epd_host_write_pgm(path, state->back_fb);
+    }
+}
+
+enum EpdDrawError epd_hl_update_screen(EpdiyHighlevelState *state, enum EpdDrawMode mode, int temperature)
+{
+    EpdRect area = {.x = 0, .y = 0, .width = epd_width(), .height = epd_height()};
+    drive_panel(state, area, mode, temperature, true);
+    return EPD_DRAW_SUCCESS;
+}
+
+enum EpdDrawError epd_hl_update_area(EpdiyHighlevelState *state, enum EpdDrawMode mode, int temperature, EpdRect area)
+{
+    drive_panel(state, area_to_panel(area), mode, temperature, false);
+    return EPD_DRAW_SUCCESS;
+}
+
+void epd_host_reset_stats(void)
+{
+    memset(&s_host.stats, 0, sizeof(s_host.stats));
+    s_host.log_count = 0;
+}
+
+void epd_host_get_stats(EPDHostStats *stats)
+{
+    if (stats != NULL)
+    {
+        *stats = s_host.stats;
+    }
+}
+
+int epd_host_get_update_count(void)
+{
+    return s_host.log_count < EPD_HOST_UPDATE_LOG_SIZE ? (int)s_host.log_count : EPD_HOST_UPDATE_LOG_SIZE;
+}
+
+bool epd_host_get_update(int index, EPDHostUpdate *update)
+{
+    int count = epd_host_get_update_count();
+    if (update == NULL || index < 0 || index >= count)
+    {
+        return false;
+    }
+
+    uint32_t first = s_host.log_count - count;
+    *update = s_host.log[(first + index) % EPD_HOST_UPDATE_LOG_SIZE];
+    return true;
+}
+
+bool epd_host_write_pgm(const char *path, const uint8_t *framebuffer)
+{
+    if (path == NULL || framebuffer == NULL)
+    {
+        return false;
+    }
+
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to open %s", path);
+        return false;
+    }
+
+    // 4ビット値を0-255に広げて8ビットのグレースケールで保存する
+    fprintf(file, "P5\n%d %d\n255\n", HOST_WIDTH, HOST_HEIGHT);
+    uint8_t row[HOST_WIDTH];
+    for (int y = 0; y < HOST_HEIGHT; y++)
+    {
+        const uint8_t *src = framebuffer + y * (HOST_WIDTH / 2);
+        for (int x = 0; x < HOST_WIDTH; x += 2)
+        {
+            row[x] = (src[x / 2] & 0x0F) * 0x11;
+            row[x + 1] = (src[x / 2] >> 4) * 0x11;
+        }
+        fwrite(row, 1, sizeof(row), file);
+    }
+
+    bool ok = ferror(file) == 0;
+    fclose(file);
+    return ok;
+}
+
+bool epd_host_dump_panel(const char *path)
+{
+    return epd_host_write_pgm(path, s_host.back_fb);
+}
+
+const uint8_t *epd_host_get_panel(void)
+{
+    return s_host.back_fb;
+}
+
+void epd_host_set_dump_dir(const char *dir)
+{
+    if (dir == NULL)
+    {
+        s_host.dump_dir[0] = '\0';
+        return;
+    }
+    snprintf(s_host.dump_dir, sizeof(s_host.dump_dir), "%s", dir);
+    s_host.dump_index = 0;
+}
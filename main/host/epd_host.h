@@ -0,0 +1,106 @@
+/**
+ * @file epd_host.h
+ * @brief ホスト（Linux）用のディスプレイバックエンド
+ *
+ * epdiyの代わりにメモリ上の960x540（4ビット/ピクセル）フレームバッファを使い、
+ * 画面更新の呼び出し（領域とモード）を記録します。
+ * 表示内容はPGM形式で保存できるため、描画結果の比較や
+ * 描画速度・更新回数の計測を実機なしで行えます。
+ *
+ * 環境変数 EPD_HOST_DUMP_DIR を設定すると、画面更新のたびに
+ * そのディレクトリへ frame_00000.pgm から連番で表示内容を保存します。
+ */
+
+#ifndef EPD_HOST_H
+#define EPD_HOST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "epdiy.h"
+
+/**
+ * @brief 記録しておく画面更新の数（古いものから上書き）
+ */
+#ifndef EPD_HOST_UPDATE_LOG_SIZE
+#define EPD_HOST_UPDATE_LOG_SIZE 256
+#endif
+
+/**
+ * @brief 1回の画面更新の記録
+ */
+typedef struct
+{
+    EpdRect area;          // 更新した領域（パネル座標系、回転なし）
+    enum EpdDrawMode mode; // 更新モード
+    int temperature;       // 指定された温度
+    bool full_screen;      // epd_hl_update_screen() による全画面更新か
+    uint32_t changed;      // 表示内容が変化したピクセル数
+} EPDHostUpdate;
+
+/**
+ * @brief 画面更新の統計情報
+ */
+typedef struct
+{
+    uint32_t updates;        // 画面更新の回数
+    uint32_t full_updates;   // そのうち全画面更新の回数
+    uint32_t area_updates;   // そのうち部分更新の回数
+    uint64_t pixels_driven;  // 更新した領域の合計ピクセル数
+    uint64_t pixels_changed; // 表示内容が変化した合計ピクセル数
+    uint32_t mode_counts[4]; // モード別の回数（0:GC16, 1:DU, 2:INIT, 3:その他）
+} EPDHostStats;
+
+/**
+ * @brief 統計情報と更新の記録を消去する
+ */
+void epd_host_reset_stats(void);
+
+/**
+ * @brief 統計情報を取得する
+ * @param stats 統計情報の格納先
+ */
+void epd_host_get_stats(EPDHostStats *stats);
+
+/**
+ * @brief 記録している画面更新の数を返す
+ * @return 記録の数（最大 EPD_HOST_UPDATE_LOG_SIZE）
+ */
+int epd_host_get_update_count(void);
+
+/**
+ * @brief 記録している画面更新を取得する
+ * @param index 0が最も古い記録
+ * @param update 記録の格納先
+ * @return 取得できた場合はtrue
+ */
+bool epd_host_get_update(int index, EPDHostUpdate *update);
+
+/**
+ * @brief 4ビット/ピクセルのフレームバッファをPGM形式で保存する
+ * @param path 保存先のパス
+ * @param framebuffer フレームバッファ（960x540、偶数ピクセルが下位4ビット）
+ * @return 保存できた場合はtrue
+ */
+bool epd_host_write_pgm(const char *path, const uint8_t *framebuffer);
+
+/**
+ * @brief パネルに表示されている内容をPGM形式で保存する
+ * @param path 保存先のパス
+ * @return 保存できた場合はtrue
+ */
+bool epd_host_dump_panel(const char *path);
+
+/**
+ * @brief パネルに表示されている内容を返す
+ * @return 表示内容（960x540、4ビット/ピクセル）
+ */
+const uint8_t *epd_host_get_panel(void);
+
+/**
+ * @brief 画面更新のたびに表示内容を保存するディレクトリを設定する
+ * @param dir 保存先ディレクトリ（NULLの場合は保存しない）
+ */
+void epd_host_set_dump_dir(const char *dir);
+
+#endif // EPD_HOST_H
@@ -0,0 +1,151 @@
+/**
+ * @file epdiy.h
+ * @brief ホスト（Linux）ビルド用のepdiy互換ヘッダー
+ *
+ * 実機ではepdiyコンポーネントのヘッダーが使われます。
+ * ホストビルドではmainコンポーネントが使用する範囲だけを同じ名前・同じ型で宣言し、
+ * epd_host.c がメモリ上のフレームバッファで実装します。
+ */
+
+#ifndef EPD_HOST_EPDIY_H
+#define EPD_HOST_EPDIY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief 矩形領域
+ */
+typedef struct
+{
+    int x;
+    int y;
+    int width;
+    int height;
+} EpdRect;
+
+/**
+ * @brief 画面更新モード（値はepdiyと同じ）
+ */
+enum EpdDrawMode
+{
+    MODE_INIT = 0x0,
+    MODE_DU = 0x1,
+    MODE_GC16 = 0x2,
+    MODE_GC16_FAST = 0x3,
+    MODE_A2 = 0x4,
+    MODE_GL16 = 0x5,
+    MODE_GL16_FAST = 0x6,
+    MODE_DU4 = 0x7,
+    MODE_GL4 = 0xA,
+    MODE_GL16_INV = 0xB,
+    MODE_EPDIY_WHITE_TO_GL16 = 0x10,
+    MODE_EPDIY_BLACK_TO_GL16 = 0x11,
+    MODE_EPDIY_MONOCHROME = 0x12,
+    MODE_UNKNOWN_WAVEFORM = 0x3F,
+    PREVIOUSLY_WHITE = 0x200,
+    PREVIOUSLY_BLACK = 0x400,
+    INVERT = 0x800,
+};
+
+/**
+ * @brief 描画結果
+ */
+enum EpdDrawError
+{
+    EPD_DRAW_SUCCESS = 0x0,
+    EPD_DRAW_INVALID_PACKING_MODE = 0x1,
+    EPD_DRAW_LOOKUP_NOT_IMPLEMENTED = 0x2,
+    EPD_DRAW_STRING_INVALID = 0x4,
+    EPD_DRAW_NO_DRAWABLE_CHARACTERS = 0x8,
+    EPD_DRAW_FAILED_ALLOC = 0x10,
+    EPD_DRAW_GLYPH_FALLBACK_FAILED = 0x20,
+    EPD_DRAW_INVALID_CROP = 0x40,
+    EPD_DRAW_MODE_NOT_FOUND = 0x80,
+    EPD_DRAW_NO_PHASES_AVAILABLE = 0x100,
+    EPD_DRAW_INVALID_FONT = 0x200,
+    EPD_DRAW_EMPTY_LINE_QUEUE = 0x400,
+};
+
+/**
+ * @brief 画面の回転
+ */
+enum EpdRotation
+{
+    EPD_ROT_LANDSCAPE = 0,
+    EPD_ROT_PORTRAIT = 1,
+    EPD_ROT_INVERTED_LANDSCAPE = 2,
+    EPD_ROT_INVERTED_PORTRAIT = 3,
+};
+
+/**
+ * @brief 初期化オプション
+ */
+enum EpdInitOptions
+{
+    EPD_OPTIONS_DEFAULT = 0,
+    EPD_LUT_1K = 1,
+    EPD_LUT_64K = 2,
+    EPD_FEED_QUEUE_8 = 4,
+    EPD_FEED_QUEUE_32 = 8,
+};
+
+/**
+ * @brief ディスプレイの仕様
+ */
+typedef struct
+{
+    int width;     // 幅（ピクセル）
+    int height;    // 高さ（ピクセル）
+    int bus_width; // データバス幅
+    int bus_speed; // バス速度（MHz）
+} EpdDisplay_t;
+
+/**
+ * @brief 波形データ（ホストでは使用しない）
+ */
+typedef struct
+{
+    int num_modes;
+} EpdWaveform;
+
+/**
+ * @brief ボード定義（ホストでは使用しない）
+ */
+typedef struct
+{
+    void (*init)(uint32_t epd_row_width);
+    void (*deinit)(void);
+    void (*poweron)(void *state);
+    void (*poweroff)(void *state);
+    float (*get_temperature)(void);
+} EpdBoardDefinition;
+
+extern const EpdDisplay_t ED047TC1;
+extern const EpdWaveform epdiy_ED047TC1;
+
+void epd_init(const EpdBoardDefinition *board, const EpdDisplay_t *display, enum EpdInitOptions options);
+void epd_deinit(void);
+void epd_poweron(void);
+void epd_poweroff(void);
+float epd_ambient_temperature(void);
+const EpdDisplay_t *epd_get_display(void);
+
+void epd_set_rotation(enum EpdRotation rotation);
+enum EpdRotation epd_get_rotation(void);
+int epd_width(void);
+int epd_height(void);
+int epd_rotated_display_width(void);
+int epd_rotated_display_height(void);
+
+void epd_draw_pixel(int x, int y, uint8_t color, uint8_t *framebuffer);
+void epd_draw_hline(int x, int y, int length, uint8_t color, uint8_t *framebuffer);
+void epd_draw_vline(int x, int y, int length, uint8_t color, uint8_t *framebuffer);
+void epd_draw_circle(int x, int y, int r, uint8_t color, uint8_t *framebuffer);
+void epd_fill_circle(int x, int y, int r, uint8_t color, uint8_t *framebuffer);
+void epd_draw_line(int x0, int y0, int x1, int y1, uint8_t color, uint8_t *framebuffer);
+void epd_draw_rect(EpdRect rect, uint8_t color, uint8_t *framebuffer);
+void epd_fill_rect(EpdRect rect, uint8_t color, uint8_t *framebuffer);
+void epd_copy_to_framebuffer(EpdRect image_area, const uint8_t *image_data, uint8_t *framebuffer);
+
+#endif // EPD_HOST_EPDIY_H
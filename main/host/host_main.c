@@ -0,0 +1,266 @@
+/**
+ * @file host_main.c
+ * @brief ホスト（Linux）ビルド用のエントリーポイント
+ *
+ * 実機なしで描画処理を実行し、描画時間と画面更新の回数を計測します。
+ * 結果は1行の "EPD_HOST_STATS key=value ..." 形式で出力するため、CIで比較できます。
+ * 引数にディレクトリを指定すると、各シナリオ後の表示内容をPGMで保存します。
+ * --bench を指定すると、描画処理のベンチマーク（epd_bench）も実行します。
+ *
+ *   idf.py --preview set-target linux && idf.py build
+ *   ./build/esp32s3_paper_test.elf [--bench] [出力ディレクトリ]
+ *
+ * 統計と表示内容は golden/ の基準と比較できます（違いがあれば失敗します）。
+ *
+ *   python main/host/check_golden.py build/esp32s3_paper_test.elf
+ *   python main/host/check_golden.py build/esp32s3_paper_test.elf --update  # 基準を更新
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "esp_log.h"
+
+#include "epd_wrapper.h"
+#include "epd_transition.h"
+#include "epd_text.h"
+#include "epd_glyph_cache.h"
+#include "Mplus2-Light_16.h"
+#include "epd_bench.h"
+#include "epd_host.h"
+
+static const char *TAG = "host_main";
+
+// main() の引数（ESP-IDFのLinuxターゲットではapp_mainから参照できないため保持する）
+static const char *s_output_dir = NULL;
+static bool s_run_bench = false;
+
+/**
+ * @brief 単調増加する時刻をマイクロ秒で返す
+ */
+static int64_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief 表示内容を出力ディレクトリに保存する
+ */
+static void dump_panel(const char *name)
+{
+    if (s_output_dir == NULL)
+    {
+        return;
+    }
+
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.pgm", s_output_dir, name);
+    if (epd_host_dump_panel(path))
+    {
+        ESP_LOGI(TAG, "Saved %s", path);
+    }
+}
+
+/**
+ * @brief 統計情報をシナリオ名付きで1行に出力する
+ */
+static void print_stats(const char *scenario, int64_t elapsed_us)
+{
+    EPDHostStats stats;
+    epd_host_get_stats(&stats);
+    printf("EPD_HOST_STATS scenario=%s time_us=%lld updates=%u full=%u area=%u "
+           "pixels_driven=%llu pixels_changed=%llu gc16=%u du=%u init=%u other=%u\n",
+           scenario, (long long)elapsed_us, (unsigned)stats.updates,
+           (unsigned)stats.full_updates, (unsigned)stats.area_updates,
+           (unsigned long long)stats.pixels_driven, (unsigned long long)stats.pixels_changed,
+           (unsigned)stats.mode_counts[0], (unsigned)stats.mode_counts[1],
+           (unsigned)stats.mode_counts[2], (unsigned)stats.mode_counts[3]);
+}
+
+/**
+ * @brief 複数行テキストの描画時間を計測する
+ */
+static void run_text_scenario(EPDWrapper *wrapper)
+{
+    EPDTextConfig text_config;
+    epd_text_config_init(&text_config, &Mplus2_Light_16);
+    text_config.text_color = 0x00;
+    text_config.char_spacing = 2;
+    text_config.line_spacing = 5;
+    text_config.box_padding = 5;
+
+    const char *text =
+        "これは、複数行テキスト表示なんですよです。「禁則処理」も考慮されます。\n"
+        "改行も正しく処理されてなんとなんと「折返し」も自動的に行われます。\n"
+        "長～い行は自動的に折り返されて、矩形領。域内に収まるように表示されます。"
+        "句読点（、。）やカッコ「」などは行頭・行末禁則処理の対象です。";
+
+    epd_wrapper_fill(wrapper, 0xFF);
+    epd_host_reset_stats();
+
+    int64_t start = now_us();
+    EpdRect horizontal = {.x = 20, .y = 20, .width = 440, .height = 500};
+    text_config.vertical = false;
+    epd_text_draw_multiline(wrapper, &horizontal, text, &text_config);
+
+    EpdRect vertical = {.x = 500, .y = 20, .width = 440, .height = 500};
+    text_config.vertical = true;
+    epd_text_draw_multiline(wrapper, &vertical, text, &text_config);
+
+    epd_wrapper_update_screen(wrapper, MODE_GC16);
+    int64_t elapsed = now_us() - start;
+
+    print_stats("text", elapsed);
+    dump_panel("text");
+}
+
+/**
+ * @brief 図形（直線・矩形・円）の描画結果を確認する
+ *
+ * 傾きと向きの異なる直線と、クリップ矩形で切り取られる図形を描く。
+ * 表示内容を基準画像と比較して、実機（epdiy）と同じ点を描くことを確かめるためのシナリオ。
+ */
+static void run_shapes_scenario(EPDWrapper *wrapper)
+{
+    epd_wrapper_fill(wrapper, 0xFF);
+    epd_host_reset_stats();
+
+    int64_t start = now_us();
+
+    // 中心から放射状に、緩やかな傾き・急な傾き・水平・垂直の直線を両方向に描く
+    for (int i = 0; i <= 16; i++)
+    {
+        int dx = (i <= 8) ? 200 : 200 - (i - 8) * 25;
+        int dy = (i <= 8) ? i * 25 : 200;
+        epd_wrapper_draw_line(wrapper, 240, 270, 240 + dx, 270 + dy / 2, 0x00);
+        epd_wrapper_draw_line(wrapper, 240, 270, 240 - dx, 270 - dy / 2, 0x00);
+        epd_wrapper_draw_line(wrapper, 240 + dy / 2, 270 - dx, 240, 270, 0x00);
+    }
+    epd_wrapper_draw_rect(wrapper, 30, 30, 420, 480, 0x80);
+    epd_wrapper_draw_circle(wrapper, 240, 270, 120, 0x40);
+
+    // クリップ矩形で一部が切り取られる図形
+    epd_wrapper_push_clip(wrapper, 520, 60, 380, 420);
+    for (int i = 0; i < 12; i++)
+    {
+        epd_wrapper_draw_line(wrapper, 480 + i * 40, 20, 940 - i * 35, 520, 0x00);
+    }
+    epd_wrapper_fill_circle(wrapper, 560, 100, 80, 0x60);
+    epd_wrapper_draw_circle(wrapper, 880, 460, 100, 0x00);
+    epd_wrapper_fill_rect(wrapper, 700, 420, 300, 100, 0xA0);
+    epd_wrapper_pop_clip(wrapper);
+
+    epd_wrapper_update_screen(wrapper, MODE_GC16);
+    int64_t elapsed = now_us() - start;
+
+    print_stats("shapes", elapsed);
+    dump_panel("shapes");
+}
+
+/**
+ * @brief スライドトランジションの更新回数と時間を計測する
+ */
+static void run_transition_scenario(EPDWrapper *wrapper)
+{
+    EPDTransition transition;
+    if (!epd_transition_init(wrapper, &transition, 16))
+    {
+        ESP_LOGE(TAG, "Failed to initialize transition");
+        return;
+    }
+
+    // 次の画面として格子模様を描く
+    uint8_t *next_fb = epd_transition_get_next_framebuffer(&transition);
+    int width = epd_wrapper_get_width(wrapper);
+    int height = epd_wrapper_get_height(wrapper);
+    uint8_t *front_fb = epd_wrapper_get_framebuffer(wrapper);
+    memcpy(next_fb, front_fb, width * height / 2);
+    for (int y = 0; y < height; y += 60)
+    {
+        epd_draw_hline(0, y, width, 0x00, next_fb);
+    }
+    for (int x = 0; x < width; x += 60)
+    {
+        epd_draw_vline(x, 0, height, 0x00, next_fb);
+    }
+
+    if (!epd_transition_prepare(wrapper, &transition, TRANSITION_SLIDE_LEFT, MODE_DU))
+    {
+        ESP_LOGE(TAG, "Failed to prepare transition");
+        epd_transition_deinit(wrapper, &transition);
+        return;
+    }
+
+    epd_host_reset_stats();
+    int64_t start = now_us();
+    while (transition.is_active && epd_transition_step(wrapper, &transition))
+    {
+    }
+    int64_t elapsed = now_us() - start;
+
+    epd_transition_deinit(wrapper, &transition);
+
+    print_stats("transition", elapsed);
+    dump_panel("transition");
+}
+
+void app_main(void)
+{
+    static EPDWrapper epd;
+
+    if (!epd_wrapper_init(&epd))
+    {
+        ESP_LOGE(TAG, "Failed to initialize EPD Wrapper");
+        exit(1);
+    }
+
+    if (!epd_glyph_cache_init(EPD_GLYPH_CACHE_DEFAULT_BUDGET))
+    {
+        ESP_LOGW(TAG, "Glyph cache unavailable, drawing glyphs directly");
+    }
+    epd_text_register_font(&Mplus2_Light_16);
+
+    epd_wrapper_power_on(&epd);
+
+    run_text_scenario(&epd);
+    run_shapes_scenario(&epd);
+    run_transition_scenario(&epd);
+
+    if (s_run_bench)
+    {
+        EPDBenchResult results[EPD_BENCH_MAX_RESULTS];
+        int count = epd_bench_run_all(&epd, results, EPD_BENCH_MAX_RESULTS);
+        epd_bench_print(results, count);
+    }
+
+    epd_wrapper_power_off(&epd);
+    epd_glyph_cache_deinit();
+    epd_wrapper_deinit(&epd);
+
+    // Linuxターゲットではapp_mainから戻ってもプロセスが終了しないため明示的に終了する
+    fflush(stdout);
+    exit(0);
+}
+
+/**
+ * @brief 出力ディレクトリとオプションを引数から受け取る
+ *
+ * ESP-IDFのLinuxターゲットはmain()を提供するため、コンストラクタで引数を読む。
+ */
+__attribute__((constructor)) static void parse_arguments(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--bench") == 0)
+        {
+            s_run_bench = true;
+        }
+        else
+        {
+            s_output_dir = argv[i];
+        }
+    }
+}